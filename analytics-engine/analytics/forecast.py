@@ -15,6 +15,9 @@ import numpy as np
 from typing import Dict, List, Any, Optional, Tuple
 from datetime import datetime, timedelta
 import warnings
+
+from . import native
+
 warnings.filterwarnings('ignore')
 
 
@@ -28,6 +31,11 @@ def prepare_time_series(df: pd.DataFrame) -> pd.Series:
     Returns:
         Daily expense series
     """
+    buckets = native.resample(df['Date'], df['Amount'], 'day', zero_fill=True)
+    if buckets is not None:
+        starts, totals, _ = buckets
+        return pd.Series(totals, index=pd.DatetimeIndex(starts))
+    
     # Aggregate daily spending
     daily = df.groupby(df['Date'].dt.date)['Amount'].sum()
     daily.index = pd.to_datetime(daily.index)
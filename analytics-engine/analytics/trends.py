@@ -15,6 +15,8 @@ import numpy as np
 from datetime import datetime, timedelta
 from typing import Dict, List, Any, Optional
 
+from . import native
+
 
 def load_expenses(file_path: str) -> pd.DataFrame:
     """
@@ -42,6 +44,11 @@ def calculate_monthly_spending(df: pd.DataFrame) -> Dict[str, float]:
     Returns:
         Dictionary with month as key and total spending as value
     """
+    buckets = native.resample(df['Date'], df['Amount'], 'month', zero_fill=False)
+    if buckets is not None:
+        starts, totals, _ = buckets
+        return {str(start)[:7]: float(total) for start, total in zip(starts, totals)}
+    
     df['YearMonth'] = df['Date'].dt.to_period('M')
     monthly = df.groupby('YearMonth')['Amount'].sum()
     
@@ -58,6 +65,10 @@ def calculate_category_breakdown(df: pd.DataFrame) -> Dict[str, Any]:
     Returns:
         Dictionary with category statistics
     """
+    native_breakdown = native.category_breakdown(df['Amount'].to_numpy(), df['Category'].tolist())
+    if native_breakdown is not None:
+        return native_breakdown
+    
     category_spending = df.groupby('Category')['Amount'].agg(['sum', 'count', 'mean'])
     total_spending = df['Amount'].sum()
     
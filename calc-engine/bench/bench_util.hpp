@@ -0,0 +1,137 @@
+/**
+ * Benchmark Utilities
+ * 
+ * Timing and synthetic data helpers shared by the benchmark targets.
+ */
+
+#ifndef EXPENSE_BENCH_UTIL_HPP
+#define EXPENSE_BENCH_UTIL_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace expense {
+namespace bench {
+
+/**
+ * Synthetic expense amounts rounded to paise, so duplicates occur.
+ */
+inline std::vector<double> make_amounts(size_t n, unsigned seed) {
+    std::mt19937_64 rng(seed);
+    std::lognormal_distribution<double> dist(4.0, 1.0);
+    std::vector<double> out(n);
+    for (auto& v : out) {
+        v = std::round(dist(rng) * 100.0) / 100.0;
+    }
+    return out;
+}
+
+/**
+ * Daily-style amounts with a RENT-sized spike (15,000-40,000) every 30th
+ * value, so the tail is heavy and outliers are real.
+ */
+inline std::vector<double> make_rent_spikes(size_t n, unsigned seed) {
+    std::vector<double> out = make_amounts(n, seed);
+    std::mt19937_64 rng(seed + 1);
+    std::uniform_real_distribution<double> rent(15000.0, 40000.0);
+    for (size_t i = 29; i < n; i += 30) {
+        out[i] = std::round(rent(rng) * 100.0) / 100.0;
+    }
+    return out;
+}
+
+/**
+ * Amounts drawn from a few hundred price points (49.00, 99.00, ...) with
+ * a skewed popularity, so almost every value repeats (mode-heavy).
+ */
+inline std::vector<double> make_price_points(size_t n, unsigned seed, size_t distinct = 200) {
+    std::mt19937_64 rng(seed);
+    std::geometric_distribution<size_t> pick(4.0 / static_cast<double>(distinct));
+    std::vector<double> out(n);
+    for (auto& v : out) {
+        size_t k = pick(rng) % distinct;
+        v = static_cast<double>(k * 50 + 49);
+    }
+    return out;
+}
+
+/**
+ * Ascending copy (best case for sort-based methods, worst for naive
+ * quickselect pivots).
+ */
+inline std::vector<double> sorted_copy(std::vector<double> data) {
+    std::sort(data.begin(), data.end());
+    return data;
+}
+
+/**
+ * Best-of-N wall time in milliseconds.
+ */
+template <typename Fn>
+double time_best_ms(int reps, Fn&& fn) {
+    double best = 1e300;
+    for (int r = 0; r < reps; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        if (ms < best) best = ms;
+    }
+    return best;
+}
+
+/**
+ * Per-call timings from measure(), in nanoseconds.
+ */
+struct Timing {
+    double min_ns = 0.0;
+    double median_ns = 0.0;
+    double mean_ns = 0.0;
+    size_t iterations = 1;     // calls per sample
+    int samples = 0;
+};
+
+/**
+ * Time fn with warm-up and repetition control. The number of calls per
+ * sample is doubled until one sample takes at least min_sample_ms, so
+ * sub-microsecond calls on tiny inputs stay above clock resolution;
+ * calibration and `warmup` extra samples are discarded.
+ */
+template <typename Fn>
+Timing measure(int warmup, int reps, double min_sample_ms, Fn&& fn) {
+    using clock = std::chrono::steady_clock;
+    auto sample_ms = [&](size_t iterations) {
+        auto start = clock::now();
+        for (size_t i = 0; i < iterations; ++i) fn();
+        return std::chrono::duration<double, std::milli>(clock::now() - start).count();
+    };
+    
+    Timing t;
+    while (sample_ms(t.iterations) < min_sample_ms && t.iterations < (size_t(1) << 30)) {
+        t.iterations *= 2;
+    }
+    for (int w = 0; w < warmup; ++w) sample_ms(t.iterations);
+    
+    std::vector<double> per_call;
+    for (int r = 0; r < std::max(1, reps); ++r) {
+        per_call.push_back(sample_ms(t.iterations) * 1e6 / static_cast<double>(t.iterations));
+    }
+    std::sort(per_call.begin(), per_call.end());
+    
+    t.samples = static_cast<int>(per_call.size());
+    t.min_ns = per_call.front();
+    size_t mid = per_call.size() / 2;
+    t.median_ns = per_call.size() % 2 ? per_call[mid] : (per_call[mid - 1] + per_call[mid]) / 2.0;
+    double total = 0.0;
+    for (double v : per_call) total += v;
+    t.mean_ns = total / static_cast<double>(per_call.size());
+    return t;
+}
+
+} // namespace bench
+} // namespace expense
+
+#endif // EXPENSE_BENCH_UTIL_HPP
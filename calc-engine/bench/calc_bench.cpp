@@ -0,0 +1,431 @@
+/**
+ * Expense Calculator - Benchmarks
+ * 
+ * Measures the statistics library against reference implementations.
+ * 
+ * Usage:
+ *   calc_bench [size] [repetitions]
+ * 
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#include "statistics.hpp"
+#include "simd_kernels.hpp"
+#include "summation.hpp"
+#include "json_writer.hpp"
+#include "rolling_engine.hpp"
+#include "zone_map.hpp"
+#include "range_index.hpp"
+#include "expense_cube.hpp"
+#include "bench_util.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace expense;
+using bench::make_amounts;
+using bench::time_best_ms;
+
+namespace {
+
+/**
+ * Pre-selection percentile: full copy + sort per call.
+ */
+double legacy_percentile(std::vector<double> data, double p) {
+    std::sort(data.begin(), data.end());
+    if (p == 0) return data.front();
+    if (p == 100) return data.back();
+    double index = (p / 100.0) * (data.size() - 1);
+    size_t lower = static_cast<size_t>(std::floor(index));
+    size_t upper = static_cast<size_t>(std::ceil(index));
+    if (lower == upper) return data[lower];
+    double weight = index - lower;
+    return data[lower] * (1 - weight) + data[upper] * weight;
+}
+
+/**
+ * Pre-fusion calculate_all: three copies + three sorts plus separate
+ * passes for sum, variance, minmax and the mode hash map.
+ */
+StatisticsResult legacy_calculate_all(const std::vector<double>& data) {
+    StatisticsResult result;
+    if (data.empty()) return result;
+    
+    result.count = data.size();
+    result.sum = StatisticsCalculator::sum(data);
+    result.mean = result.sum / static_cast<double>(result.count);
+    result.median = legacy_percentile(data, 50);
+    result.mode = StatisticsCalculator::mode(data);
+    result.variance = StatisticsCalculator::variance(data);
+    result.stddev = std::sqrt(result.variance);
+    
+    auto minmax = std::minmax_element(data.begin(), data.end());
+    result.min = *minmax.first;
+    result.max = *minmax.second;
+    result.range = result.max - result.min;
+    
+    result.q1 = legacy_percentile(data, 25);
+    result.q3 = legacy_percentile(data, 75);
+    result.iqr = result.q3 - result.q1;
+    return result;
+}
+
+/**
+ * Pre-writer moving average rendering via ostringstream.
+ */
+std::string legacy_to_json(const MovingAverageResult& r) {
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(2);
+    oss << "{\"window_size\":" << r.window_size << ",";
+    oss << "\"current_average\":" << r.current_average << ",";
+    oss << "\"values\":[";
+    for (size_t i = 0; i < r.values.size(); ++i) {
+        if (i > 0) oss << ",";
+        oss << r.values[i];
+    }
+    oss << "]}";
+    return oss.str();
+}
+
+/**
+ * Ill-conditioned input with a known exact sum: n/2 small amounts
+ * hidden under +big/-big pairs, all exact binary fractions.
+ */
+std::vector<double> make_cancelling(size_t n, uint64_t seed, double* exact_sum) {
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<int64_t> small(1, int64_t(1) << 20);
+    std::uniform_int_distribution<int64_t> big(int64_t(1) << 30, int64_t(1) << 40);
+    
+    std::vector<double> out;
+    out.reserve(n);
+    int64_t scaled_total = 0;
+    while (out.size() + 2 <= n) {
+        int64_t s = small(rng);
+        double b = static_cast<double>(big(rng));
+        scaled_total += s;
+        out.push_back(b + static_cast<double>(s) / 128.0);
+        out.push_back(-b);
+    }
+    std::shuffle(out.begin(), out.end(), rng);
+    *exact_sum = static_cast<double>(scaled_total) / 128.0;
+    return out;
+}
+
+volatile double sink = 0.0;
+
+template <typename Summation>
+void bench_summation(const std::vector<double>& data, const std::vector<double>& cancelling,
+                     double exact, int reps) {
+    const size_t n = data.size();
+    double ms = time_best_ms(reps, [&] {
+        sink = sink + Summation::sum(data.data(), n);
+    });
+    double got = Summation::sum(cancelling.data(), cancelling.size());
+    std::cout << "  " << std::setw(9) << Summation::NAME << "  " << std::setw(8) << ms << " ms  "
+              << std::setw(7) << static_cast<double>(n * sizeof(double)) / 1e6 / ms << " GB/s"
+              << "  cancelling rel err " << std::scientific << std::setprecision(2)
+              << std::abs(got - exact) / exact << std::fixed << std::setprecision(3) << "\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000;
+    int reps = argc > 2 ? std::atoi(argv[2]) : 10;
+    
+    std::vector<double> data = make_amounts(n, 42);
+    
+    double legacy_ms = time_best_ms(reps, [&] {
+        sink = sink + legacy_calculate_all(data).iqr;
+    });
+    double fused_ms = time_best_ms(reps, [&] {
+        sink = sink + StatisticsCalculator::calculate_all(data).iqr;
+    });
+    
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "calculate_all n=" << n << " reps=" << reps << "\n";
+    std::cout << "  legacy: " << legacy_ms << " ms\n";
+    std::cout << "  fused:  " << fused_ms << " ms\n";
+    std::cout << "  speedup: " << (legacy_ms / fused_ms) << "x\n";
+    
+    const std::vector<double> levels = {50, 90, 95, 99};
+    double sort_ms = time_best_ms(reps, [&] {
+        for (double p : levels) sink = sink + legacy_percentile(data, p);
+    });
+    double select_ms = time_best_ms(reps, [&] {
+        sink = sink + StatisticsCalculator::quantiles(data, levels)[0];
+    });
+    
+    std::cout << "quantiles p50/p90/p95/p99 n=" << n << "\n";
+    std::cout << "  sort per percentile: " << sort_ms << " ms\n";
+    std::cout << "  multi-select:        " << select_ms << " ms\n";
+    std::cout << "  speedup: " << (sort_ms / select_ms) << "x\n";
+    
+    
+    std::vector<Money> paise;
+    paise.reserve(n);
+    for (double v : data) paise.push_back(Money::from_double(v));
+    
+    double sum_double_ms = time_best_ms(reps, [&] {
+        sink = sink + StatisticsCalculator::sum(data);
+    });
+    double sum_money_ms = time_best_ms(reps, [&] {
+        sink = sink + static_cast<double>(StatisticsCalculator::sum(paise).paise());
+    });
+    double all_money_ms = time_best_ms(reps, [&] {
+        sink = sink + StatisticsCalculator::calculate_all(paise).iqr;
+    });
+    
+    std::cout << "money vs double n=" << n << "\n";
+    std::cout << "  sum double: " << sum_double_ms << " ms\n";
+    std::cout << "  sum money:  " << sum_money_ms << " ms\n";
+    std::cout << "  calculate_all money: " << all_money_ms << " ms\n";
+    
+    // Reduction kernel throughput per instruction set
+    std::vector<double> other = make_amounts(n, 7);
+    const double mb = static_cast<double>(n * sizeof(double)) / 1e6;
+    const kernels::Isa isas[] = {
+        kernels::Isa::Scalar, kernels::Isa::SSE2, kernels::Isa::AVX2, kernels::Isa::AVX512
+    };
+    
+    std::cout << "reduction kernels n=" << n << " (GB/s)\n";
+    for (kernels::Isa isa : isas) {
+        if (!kernels::isa_supported(isa)) continue;
+        const kernels::KernelTable& t = kernels::table(isa);
+        
+        double sum_ms = time_best_ms(reps, [&] { sink = sink + t.sum(data.data(), n); });
+        double sq_ms = time_best_ms(reps, [&] { sink = sink + t.sum_sq_dev(data.data(), n, 50.0); });
+        double mm_ms = time_best_ms(reps, [&] {
+            double lo, hi;
+            t.min_max(data.data(), n, &lo, &hi);
+            sink = sink + lo + hi;
+        });
+        double dot_ms = time_best_ms(reps, [&] { sink = sink + t.dot(data.data(), other.data(), n); });
+        double co_ms = time_best_ms(reps, [&] {
+            double sxx, syy, sxy;
+            t.co_moments(data.data(), other.data(), n, 50.0, 50.0, &sxx, &syy, &sxy);
+            sink = sink + sxy;
+        });
+        
+        std::cout << "  " << std::setw(7) << kernels::isa_name(isa)
+                  << "  sum " << mb / sum_ms
+                  << "  sum_sq_dev " << mb / sq_ms
+                  << "  min_max " << mb / mm_ms
+                  << "  dot " << 2 * mb / dot_ms
+                  << "  co_moments " << 2 * mb / co_ms << "\n";
+    }
+    
+    // Summation policies: throughput on amounts, error on a cancelling set
+    double exact_sum = 0.0;
+    std::vector<double> cancelling = make_cancelling(n, 11, &exact_sum);
+    std::cout << "summation policies n=" << n << " (" << kernels::isa_name(kernels::detect_isa()) << ")\n";
+    bench_summation<summation::Naive>(data, cancelling, exact_sum, reps);
+    bench_summation<summation::Pairwise>(data, cancelling, exact_sum, reps);
+    bench_summation<summation::Neumaier>(data, cancelling, exact_sum, reps);
+    bench_summation<summation::Binned>(data, cancelling, exact_sum, reps);
+    
+    // Rolling median: sorting each window vs the incremental kernel
+    const size_t naive_n = std::min<size_t>(n, 20000);
+    std::cout << "rolling median n=" << naive_n << " (sort per window vs incremental)\n";
+    for (int rolling_window : {7, 30, 365, 2000}) {
+        if (static_cast<size_t>(rolling_window) > naive_n) continue;
+        double naive_ms = time_best_ms(reps, [&] {
+            std::vector<double> window_buf(rolling_window);
+            for (size_t i = 0; i + rolling_window <= naive_n; ++i) {
+                std::copy(data.begin() + i, data.begin() + i + rolling_window, window_buf.begin());
+                std::nth_element(window_buf.begin(), window_buf.begin() + rolling_window / 2,
+                                 window_buf.end());
+                sink = sink + window_buf[rolling_window / 2];
+            }
+        });
+        double rolling_ms = time_best_ms(reps, [&] {
+            sink = sink + StatisticsCalculator::rolling_median(data.data(), naive_n, rolling_window)
+                              .current_average;
+        });
+        std::cout << "  window " << std::setw(4) << rolling_window << ": " << naive_ms << " ms vs "
+                  << rolling_ms << " ms  (" << naive_ms / rolling_ms << "x)\n";
+    }
+    
+    // Dashboard series: one pass per (window, stat) vs one fused sweep
+    const std::vector<int> dashboard_windows = {7, 30, 90};
+    const std::vector<RollingStat> dashboard_stats = {
+        RollingStat::Mean, RollingStat::Stddev, RollingStat::Min, RollingStat::Max
+    };
+    double separate_ms = time_best_ms(reps, [&] {
+        for (int w : dashboard_windows) {
+            for (RollingStat stat : dashboard_stats) {
+                sink = sink + RollingEngine().add(w, {stat}).run(data).series[0].values.back();
+            }
+        }
+    });
+    RollingEngine dashboard;
+    for (int w : dashboard_windows) dashboard.add(w, dashboard_stats);
+    double sweep_ms = time_best_ms(reps, [&] {
+        sink = sink + dashboard.run(data).series.back().values.back();
+    });
+    std::cout << "rolling dashboard n=" << n << " (3 windows x mean/stddev/min/max)\n";
+    std::cout << "  separate passes: " << separate_ms << " ms\n";
+    std::cout << "  one sweep:       " << sweep_ms << " ms  (" << separate_ms / sweep_ms << "x)\n";
+    
+    // Date-range totals: full scan vs zone map, as history grows
+    std::cout << "date-range total, 90-day window (us per query)\n";
+    for (size_t rows : {n / 10, n, n * 10}) {
+        std::vector<double> amounts = make_amounts(rows, 11);
+        ExpenseTable history;
+        history.reserve(rows);
+        for (size_t i = 0; i < rows; ++i) {
+            history.append(amounts[i], static_cast<int32_t>(i / 8), Category::Food, "", "");
+        }
+        ZoneMap zones(history);
+        const int32_t days = static_cast<int32_t>(rows / 8);
+        std::mt19937 rng(5);
+        std::vector<int32_t> starts(1024);
+        for (int32_t& start : starts) start = static_cast<int32_t>(rng() % static_cast<uint32_t>(days + 1));
+        
+        const size_t scan_queries = 16;
+        double scan_ms = time_best_ms(reps, [&] {
+            for (size_t q = 0; q < scan_queries; ++q) {
+                Money total;
+                for (size_t i = 0; i < rows; ++i) {
+                    int32_t date = history.dates()[i];
+                    if (date >= starts[q] && date <= starts[q] + 89) total += Money::from_double(history.amounts()[i]);
+                }
+                sink = sink + total.to_double();
+            }
+        });
+        double zone_ms = time_best_ms(reps, [&] {
+            for (int32_t start : starts) sink = sink + zones.total(start, start + 89).total.to_double();
+        });
+        std::cout << "  rows=" << std::setw(9) << rows << "  scan " << std::setw(10)
+                  << scan_ms * 1000 / scan_queries << "  zone map " << std::setw(7)
+                  << zone_ms * 1000 / static_cast<double>(starts.size()) << "\n";
+    }
+    
+    // Edit one expense, then ask a 30-day total and busiest day: rescan
+    // the rows vs the Fenwick / segment tree index
+    std::cout << "edit + 30-day total/max day (us per edit+query)\n";
+    for (size_t rows : {n / 10, n, n * 10}) {
+        std::vector<double> amounts = make_amounts(rows, 13);
+        std::vector<int32_t> dates(rows);
+        std::vector<Money> paise_rows(rows);
+        ExpenseTable history;
+        history.reserve(rows);
+        for (size_t i = 0; i < rows; ++i) {
+            dates[i] = static_cast<int32_t>(i / 8);
+            paise_rows[i] = Money::from_double(amounts[i]);
+            history.append(amounts[i], dates[i], Category::Food, "", "");
+        }
+        DailyTotals index(history);
+        const int32_t days = dates.back() + 1;
+        std::mt19937 rng(17);
+        
+        const size_t rescan_ops = 16;
+        double rescan_ms = time_best_ms(reps, [&] {
+            std::vector<int64_t> window(30);
+            for (size_t op = 0; op < rescan_ops; ++op) {
+                paise_rows[rng() % rows] += Money::from_paise(100);
+                int32_t from = static_cast<int32_t>(rng() % static_cast<uint32_t>(days));
+                std::fill(window.begin(), window.end(), 0);
+                Money total;
+                for (size_t i = 0; i < rows; ++i) {
+                    if (dates[i] >= from && dates[i] < from + 30) {
+                        total += paise_rows[i];
+                        window[static_cast<size_t>(dates[i] - from)] += paise_rows[i].paise();
+                    }
+                }
+                sink = sink + total.to_double() + static_cast<double>(*std::max_element(window.begin(), window.end()));
+            }
+        });
+        const size_t index_ops = 4096;
+        double index_ms = time_best_ms(reps, [&] {
+            for (size_t op = 0; op < index_ops; ++op) {
+                size_t row = rng() % rows;
+                index.update(dates[row], Money(), dates[row], Money::from_paise(100));
+                int32_t from = static_cast<int32_t>(rng() % static_cast<uint32_t>(days));
+                sink = sink + index.total(from, from + 29).to_double() +
+                       index.day_extremes(from, from + 29).max.to_double();
+            }
+        });
+        std::cout << "  rows=" << std::setw(9) << rows << "  rescan " << std::setw(10)
+                  << rescan_ms * 1000 / rescan_ops << "  index " << std::setw(7)
+                  << index_ms * 1000 / index_ops << "\n";
+    }
+    
+    // Dashboard roll-ups for one user (a year by category, every month):
+    // group-by scan of the user's rows vs the cube
+    std::cout << "user year by category + by month (us per dashboard)\n";
+    for (size_t rows : {n / 10, n, n * 10}) {
+        const int64_t users = 100;
+        std::vector<double> amounts = make_amounts(rows, 19);
+        std::vector<ExpenseTable> tables(static_cast<size_t>(users));
+        for (size_t i = 0; i < rows; ++i) {
+            tables[i % static_cast<size_t>(users)].append(
+                amounts[i], 18000 + static_cast<int32_t>(i % 1800),
+                static_cast<Category>(i % CATEGORY_COUNT), "", "");
+        }
+        ExpenseCube cube;
+        for (int64_t u = 0; u < users; ++u) cube.add(u, tables[static_cast<size_t>(u)]);
+        CubeQuery year;
+        year.month_from = month_index(2020, 1);
+        year.month_to = month_index(2020, 12);
+        const int32_t year_from = parse_iso_date("2020-01-01");
+        const int32_t year_to = parse_iso_date("2020-12-31");
+    
+        const size_t scan_queries = 8;
+        double scan_ms = time_best_ms(reps, [&] {
+            for (size_t q = 0; q < scan_queries; ++q) {
+                const ExpenseTable& table = tables[q % tables.size()];
+                std::array<Money, CATEGORY_COUNT> categories{};
+                std::vector<Money> months(static_cast<size_t>(cube.months()));
+                for (size_t i = 0; i < table.size(); ++i) {
+                    const int32_t date = table.dates()[i];
+                    const Money amount = Money::from_double(table.amounts()[i]);
+                    if (date >= year_from && date <= year_to) categories[table.categories()[i]] += amount;
+                    months[static_cast<size_t>(month_index(date) - cube.first_month())] += amount;
+                }
+                sink = sink + categories[0].to_double() + months[0].to_double();
+            }
+        });
+        const size_t cube_queries = 1024;
+        double cube_ms = time_best_ms(reps, [&] {
+            for (size_t q = 0; q < cube_queries; ++q) {
+                year.user = static_cast<int64_t>(q % static_cast<size_t>(users));
+                CubeQuery all_months;
+                all_months.user = year.user;
+                sink = sink + cube.by_category(year)[0].total().to_double() +
+                       static_cast<double>(cube.by_month(all_months).cells.size());
+            }
+        });
+        std::cout << "  rows=" << std::setw(9) << rows << "  scan " << std::setw(10)
+                  << scan_ms * 1000 / scan_queries << "  cube " << std::setw(7)
+                  << cube_ms * 1000 / cube_queries << "\n";
+    }
+    
+    // Moving average rendering
+    MovingAverageResult sma = StatisticsCalculator::moving_average(data, 7);
+    JsonWriter writer;
+    double ostream_ms = time_best_ms(reps, [&] {
+        sink = sink + static_cast<double>(legacy_to_json(sma).size());
+    });
+    double writer_ms = time_best_ms(reps, [&] {
+        writer.clear();
+        sma.write_json(writer);
+        sink = sink + static_cast<double>(writer.size());
+    });
+    const double json_mb = static_cast<double>(writer.size()) / 1e6;
+    
+    std::cout << "moving average to_json n=" << n << " (" << json_mb << " MB)\n";
+    std::cout << "  ostringstream: " << ostream_ms << " ms\n";
+    std::cout << "  JsonWriter:    " << writer_ms << " ms  " << json_mb / writer_ms * 1000 << " MB/s\n";
+    std::cout << "  speedup: " << (ostream_ms / writer_ms) << "x\n";
+    
+    return 0;
+}
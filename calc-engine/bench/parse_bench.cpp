@@ -0,0 +1,141 @@
+/**
+ * Expense Calculator - Parse Benchmark
+ * 
+ * Compares the iostream ingestion path (operator>> per value) with the
+ * block-read + std::from_chars path in ingest.hpp, then measures CSV
+ * export ingestion (csv_ingest.hpp) on one thread and on the shared pool,
+ * and loading the same rows from a binary snapshot (snapshot.hpp).
+ * 
+ * Usage:
+ *   parse_bench [values] [repetitions]
+ * 
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#include "csv_ingest.hpp"
+#include "ingest.hpp"
+#include "snapshot.hpp"
+#include "bench_util.hpp"
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace expense;
+
+namespace {
+
+volatile double sink = 0.0;
+
+/**
+ * Render rows in the ExpenseService.exportToCsv format (every field
+ * quoted; some descriptions with commas, quotes and newlines).
+ */
+std::string make_expense_csv(const std::vector<double>& amounts) {
+    static const char* const categories[] = {"FOOD", "TRANSPORT", "RENT", "GROCERIES", "TRAVEL"};
+    static const char* const descriptions[] = {"Lunch", "Cab, airport", "Monthly \"\"rent\"\"",
+                                                "Weekly\nshopping"};
+    static const char* const merchants[] = {"Swiggy", "Uber", "Landlord", "BigBasket", "IRCTC"};
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(2);
+    out << "\"ID\",\"Amount\",\"Category\",\"Description\",\"Date\",\"Merchant\","
+           "\"Payment Method\",\"Recurring\"\n";
+    for (size_t i = 0; i < amounts.size(); ++i) {
+        int day = 1 + static_cast<int>(i % 28);
+        out << '"' << i + 1 << "\",\"" << amounts[i] << "\",\"" << categories[i % 5] << "\",\""
+            << descriptions[i % 4] << "\",\"2024-03-" << (day < 10 ? "0" : "") << day << "\",\""
+            << merchants[i % 5] << "\",\"UPI\",\"" << (i % 7 == 0 ? "true" : "false") << "\"\n";
+    }
+    return out.str();
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    int reps = argc > 2 ? std::atoi(argv[2]) : 3;
+    
+    // Render the CLI input format once: count line, then one amount per line.
+    std::vector<double> amounts = bench::make_amounts(n, 42);
+    std::ostringstream rendered;
+    rendered << std::fixed << std::setprecision(2) << n << "\n";
+    for (double v : amounts) rendered << v << "\n";
+    const std::string text = rendered.str();
+    const double mb = static_cast<double>(text.size()) / 1e6;
+    
+    double iostream_ms = bench::time_best_ms(reps, [&] {
+        std::istringstream in(text);
+        size_t count;
+        in >> count;
+        std::vector<double> values;
+        values.reserve(count);
+        double v;
+        for (size_t i = 0; i < count && (in >> v); ++i) values.push_back(v);
+        sink = sink + values.back();
+    });
+    
+    double from_chars_ms = bench::time_best_ms(reps, [&] {
+        AmountBatch batch = parse_amounts(text.data(), text.data() + text.size());
+        sink = sink + batch.amounts.back();
+    });
+    
+    double exact_ms = bench::time_best_ms(reps, [&] {
+        AmountBatch batch = parse_amounts(text.data(), text.data() + text.size(), true);
+        sink = sink + static_cast<double>(batch.exact.back().paise());
+    });
+    
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "parse n=" << n << " (" << mb << " MB) reps=" << reps << "\n";
+    std::cout << "  iostream:            " << iostream_ms << " ms  " << mb / iostream_ms * 1000 << " MB/s\n";
+    std::cout << "  from_chars:          " << from_chars_ms << " ms  " << mb / from_chars_ms * 1000 << " MB/s\n";
+    std::cout << "  from_chars + exact:  " << exact_ms << " ms  " << mb / exact_ms * 1000 << " MB/s\n";
+    std::cout << "  speedup: " << iostream_ms / from_chars_ms << "x\n";
+    
+    // CSV export: same amounts as full expense rows
+    const std::string csv = make_expense_csv(amounts);
+    const double csv_gb = static_cast<double>(csv.size()) / 1e9;
+    ThreadPool single(1);
+    ExecutionPolicy one_thread;
+    one_thread.pool = &single;
+    
+    double csv_serial_ms = bench::time_best_ms(reps, [&] {
+        ExpenseTable table = parse_expense_csv(csv.data(), csv.data() + csv.size(), one_thread);
+        sink = sink + table.amounts()[table.size() - 1];
+    });
+    
+    double csv_parallel_ms = bench::time_best_ms(reps, [&] {
+        ExpenseTable table = parse_expense_csv(csv.data(), csv.data() + csv.size(), execution::par);
+        sink = sink + table.amounts()[table.size() - 1];
+    });
+    
+    std::cout << "csv rows=" << n << " (" << csv_gb * 1000 << " MB)\n";
+    std::cout << std::setprecision(2);
+    std::cout << "  1 thread:            " << csv_serial_ms << " ms  " << csv_gb / csv_serial_ms * 1000 << " GB/s\n";
+    std::cout << "  " << ThreadPool::shared().size() << " threads:           " << csv_parallel_ms << " ms  "
+              << csv_gb / csv_parallel_ms * 1000 << " GB/s\n";
+    
+    // Snapshot of the same rows: full decode vs footer-only total
+    const std::string snapshot = encode_snapshot(
+        parse_expense_csv(csv.data(), csv.data() + csv.size(), one_thread));
+    
+    double decode_ms = bench::time_best_ms(reps, [&] {
+        ExpenseTable table = SnapshotReader(snapshot.data(), snapshot.size()).read();
+        sink = sink + table.amounts()[table.size() - 1];
+    });
+    
+    double footer_ms = bench::time_best_ms(reps, [&] {
+        SnapshotReader reader(snapshot.data(), snapshot.size());
+        sink = sink + static_cast<double>(reader.summary().amount_sum);
+    });
+    
+    std::cout << "snapshot (" << static_cast<double>(snapshot.size()) / 1e6 << " MB, "
+              << static_cast<double>(csv.size()) / static_cast<double>(snapshot.size()) << "x smaller)\n";
+    std::cout << "  decode all columns:  " << decode_ms << " ms  " << csv_serial_ms / decode_ms
+              << "x faster than CSV\n";
+    std::cout << "  footer total:        " << footer_ms * 1000 << " us\n";
+    
+    return 0;
+}
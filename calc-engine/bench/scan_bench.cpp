@@ -0,0 +1,82 @@
+/**
+ * Expense Calculator - Scan Benchmark
+ *
+ * Thread scaling of the parallel SMA/EMA in parallel_scan.hpp and the
+ * ExecutionPolicy calculate_all against the sequential
+ * StatisticsCalculator versions.
+ *
+ * Usage:
+ *   scan_bench [values] [repetitions] [max_threads]
+ *
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#include "execution.hpp"
+#include "parallel_scan.hpp"
+#include "statistics.hpp"
+#include "thread_pool.hpp"
+#include "bench_util.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace expense;
+
+namespace {
+
+volatile double sink = 0.0;
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20000000;
+    int reps = argc > 2 ? std::atoi(argv[2]) : 3;
+    unsigned max_threads = argc > 3 ? static_cast<unsigned>(std::atoi(argv[3]))
+                                    : std::max(1u, std::thread::hardware_concurrency());
+
+    std::vector<double> data = bench::make_amounts(n, 42);
+    const int window = 30;
+    const double alpha = 0.05;
+
+    double seq_sma_ms = bench::time_best_ms(reps, [&] {
+        sink = sink + StatisticsCalculator::moving_average(data, window).current_average;
+    });
+    double seq_ema_ms = bench::time_best_ms(reps, [&] {
+        sink = sink + StatisticsCalculator::exponential_moving_average(data, alpha).current_average;
+    });
+
+    double seq_all_ms = bench::time_best_ms(reps, [&] {
+        sink = sink + StatisticsCalculator::calculate_all(data).median;
+    });
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "n=" << n << ", SMA window " << window << ", EMA alpha " << alpha << "\n";
+    std::cout << "  sequential    SMA " << std::setw(8) << seq_sma_ms << " ms   EMA "
+              << std::setw(8) << seq_ema_ms << " ms   calculate_all " << std::setw(8) << seq_all_ms << " ms\n";
+
+    for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+        ThreadPool pool(threads);
+        ExecutionPolicy policy;
+        policy.pool = &pool;
+        double sma_ms = bench::time_best_ms(reps, [&] {
+            sink = sink + parallel_moving_average(data, window, policy).current_average;
+        });
+        double ema_ms = bench::time_best_ms(reps, [&] {
+            sink = sink + parallel_exponential_moving_average(data, alpha, policy).current_average;
+        });
+        double all_ms = bench::time_best_ms(reps, [&] {
+            sink = sink + StatisticsCalculator::calculate_all(policy, data).median;
+        });
+        std::cout << "  " << std::setw(3) << threads << " threads   SMA " << std::setw(8) << sma_ms
+                  << " ms (" << seq_sma_ms / sma_ms << "x)   EMA " << std::setw(8) << ema_ms
+                  << " ms (" << seq_ema_ms / ema_ms << "x)   calculate_all " << std::setw(8) << all_ms
+                  << " ms (" << seq_all_ms / all_ms << "x)\n";
+        if (threads < max_threads && threads * 2 > max_threads) threads = max_threads / 2;
+    }
+
+    return 0;
+}
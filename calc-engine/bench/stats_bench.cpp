@@ -0,0 +1,336 @@
+/**
+ * Expense Calculator - Statistics Benchmark Suite
+ *
+ * Microbenchmarks every StatisticsCalculator method over synthetic
+ * expense datasets and input sizes, and writes the results as JSON for
+ * regression tracking (progress goes to stderr).
+ *
+ * Datasets:
+ *   lognormal    log-normal amounts rounded to paise
+ *   rent_spikes  lognormal plus a 15,000-40,000 RENT row every 30 values
+ *   duplicates   200 price points with skewed popularity (mode-heavy)
+ *   sorted       lognormal, ascending
+ *
+ * Usage:
+ *   stats_bench [--sizes 10,1K,100K,1M] [--datasets a,b] [--filter a,b]
+ *               [--warmup N] [--reps N] [--min-sample-ms MS]
+ *               [--threads N] [--json FILE]
+ *   stats_bench --sizes 10M,100M --filter sum,calculate_all --json big.json
+ *
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#include "execution.hpp"
+#include "json_writer.hpp"
+#include "simd_kernels.hpp"
+#include "statistics.hpp"
+#include "thread_pool.hpp"
+#include "bench_util.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace expense;
+
+namespace {
+
+volatile double sink = 0.0;
+
+const char* const DATASET_NAMES[] = {"lognormal", "rent_spikes", "duplicates", "sorted"};
+
+struct Config {
+    std::vector<size_t> sizes = {10, 1000, 100000, 1000000};
+    std::vector<std::string> datasets;     // empty = all
+    std::vector<std::string> filters;      // empty = all methods
+    int warmup = 1;
+    int reps = 5;
+    double min_sample_ms = 2.0;
+    unsigned threads = 0;
+    std::string json_path;
+};
+
+/**
+ * One generated input plus the derived inputs some methods need, built
+ * on first use so a filtered run at 100M does not allocate them.
+ */
+class Dataset {
+public:
+    Dataset(std::string name, std::vector<double> values)
+        : name_(std::move(name)), values_(std::move(values)) {}
+
+    const std::string& name() const { return name_; }
+    const std::vector<double>& values() const { return values_; }
+    size_t size() const { return values_.size(); }
+
+    const std::vector<Money>& money() const {
+        if (money_.size() != values_.size()) {
+            money_.reserve(values_.size());
+            for (double v : values_) money_.push_back(Money::from_double(v));
+        }
+        return money_;
+    }
+
+    /**
+     * Second series for correlation (independent lognormal amounts).
+     */
+    const std::vector<double>& other() const {
+        if (other_.size() != values_.size()) other_ = bench::make_amounts(values_.size(), 99);
+        return other_;
+    }
+
+    /**
+     * Month lengths covering the values as daily amounts.
+     */
+    const std::vector<int>& months() const {
+        if (months_.empty()) {
+            const int lengths[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+            size_t covered = 0;
+            for (size_t m = 0; covered < values_.size(); ++m) {
+                months_.push_back(lengths[m % 12]);
+                covered += static_cast<size_t>(lengths[m % 12]);
+            }
+        }
+        return months_;
+    }
+
+private:
+    std::string name_;
+    std::vector<double> values_;
+    mutable std::vector<Money> money_;
+    mutable std::vector<double> other_;
+    mutable std::vector<int> months_;
+};
+
+struct Method {
+    const char* name;
+    std::function<double(const Dataset&)> run;
+};
+
+std::vector<Method> all_methods() {
+    using SC = StatisticsCalculator;
+    return {
+        {"calculate_all", [](const Dataset& d) { return SC::calculate_all(d.values()).iqr; }},
+        {"calculate_all_money", [](const Dataset& d) { return SC::calculate_all(d.money()).iqr; }},
+        {"calculate_all_par", [](const Dataset& d) {
+            return SC::calculate_all(execution::par, d.values()).iqr;
+        }},
+        {"calculate_all_binned", [](const Dataset& d) {
+            return SC::calculate_all<summation::Binned>(d.values()).variance;
+        }},
+        {"sum", [](const Dataset& d) { return SC::sum(d.values()); }},
+        {"sum_money", [](const Dataset& d) {
+            return static_cast<double>(SC::sum(d.money()).paise());
+        }},
+        {"sum_pairwise", [](const Dataset& d) { return SC::sum<summation::Pairwise>(d.values()); }},
+        {"sum_neumaier", [](const Dataset& d) { return SC::sum<summation::Neumaier>(d.values()); }},
+        {"sum_binned", [](const Dataset& d) { return SC::sum<summation::Binned>(d.values()); }},
+        {"sum_par", [](const Dataset& d) {
+            return SC::sum(execution::par, d.values().data(), d.size());
+        }},
+        {"mean", [](const Dataset& d) { return SC::mean(d.values()); }},
+        {"median", [](const Dataset& d) { return SC::median(d.values()); }},
+        {"mode", [](const Dataset& d) { return SC::mode(d.values()); }},
+        {"mode_money", [](const Dataset& d) { return static_cast<double>(SC::mode(d.money()).paise()); }},
+        {"variance", [](const Dataset& d) { return SC::variance(d.values()); }},
+        {"sample_variance", [](const Dataset& d) { return SC::sample_variance(d.values()); }},
+        {"stddev", [](const Dataset& d) { return SC::stddev(d.values()); }},
+        {"sample_stddev", [](const Dataset& d) { return SC::sample_stddev(d.values()); }},
+        {"percentile_p90", [](const Dataset& d) { return SC::percentile(d.values(), 90); }},
+        {"quantiles_p50_p90_p95_p99", [](const Dataset& d) {
+            return SC::quantiles(d.values(), {50, 90, 95, 99})[3];
+        }},
+        {"moving_average_7", [](const Dataset& d) {
+            return SC::moving_average(d.values(), 7).current_average;
+        }},
+        {"exponential_moving_average", [](const Dataset& d) {
+            return SC::exponential_moving_average(d.values(), 0.1).current_average;
+        }},
+        {"rolling_median_30", [](const Dataset& d) {
+            return SC::rolling_median(d.values(), 30).current_average;
+        }},
+        {"rolling_quantile_30_p90", [](const Dataset& d) {
+            return SC::rolling_quantile(d.values(), 30, 90).current_average;
+        }},
+        {"correlation", [](const Dataset& d) {
+            return SC::correlation(d.values(), d.other()).pearson_coefficient;
+        }},
+        {"detect_outliers", [](const Dataset& d) {
+            return static_cast<double>(SC::detect_outliers(d.values()).size());
+        }},
+        {"monthly_totals", [](const Dataset& d) {
+            return SC::monthly_totals(d.values(), d.months()).back();
+        }},
+    };
+}
+
+Dataset make_dataset(const std::string& name, size_t n) {
+    if (name == "rent_spikes") return Dataset(name, bench::make_rent_spikes(n, 42));
+    if (name == "duplicates") return Dataset(name, bench::make_price_points(n, 42));
+    if (name == "sorted") return Dataset(name, bench::sorted_copy(bench::make_amounts(n, 42)));
+    return Dataset(name, bench::make_amounts(n, 42));
+}
+
+/**
+ * Split "a,b,c" into its items.
+ */
+std::vector<std::string> split_list(const std::string& text) {
+    std::vector<std::string> items;
+    size_t pos = 0;
+    while (pos <= text.size()) {
+        size_t comma = text.find(',', pos);
+        if (comma == std::string::npos) comma = text.size();
+        if (comma > pos) items.push_back(text.substr(pos, comma - pos));
+        pos = comma + 1;
+    }
+    return items;
+}
+
+/**
+ * Parse "100", "10K" or "100M" (decimal multipliers).
+ */
+bool parse_size(const std::string& text, size_t& out) {
+    char* end = nullptr;
+    unsigned long long value = std::strtoull(text.c_str(), &end, 10);
+    if (end == text.c_str()) return false;
+    if (*end == 'K' || *end == 'k') { value *= 1000ULL; ++end; }
+    else if (*end == 'M' || *end == 'm') { value *= 1000000ULL; ++end; }
+    if (*end != '\0' || value == 0) return false;
+    out = static_cast<size_t>(value);
+    return true;
+}
+
+bool matches(const std::string& name, const std::vector<std::string>& filters) {
+    if (filters.empty()) return true;
+    for (const std::string& f : filters) {
+        if (name.find(f) != std::string::npos) return true;
+    }
+    return false;
+}
+
+void print_usage() {
+    std::cerr << "Usage: stats_bench [options]\n";
+    std::cerr << "  --sizes LIST        Input sizes, e.g. 10,1K,100K,1M,10M,100M (default 10,1K,100K,1M)\n";
+    std::cerr << "  --datasets LIST     lognormal,rent_spikes,duplicates,sorted (default all)\n";
+    std::cerr << "  --filter LIST       Only methods whose name contains one of LIST\n";
+    std::cerr << "  --warmup N          Discarded samples before timing (default 1)\n";
+    std::cerr << "  --reps N            Timed samples per benchmark (default 5)\n";
+    std::cerr << "  --min-sample-ms MS  Repeat calls until one sample takes MS (default 2)\n";
+    std::cerr << "  --threads N         Shared pool size for the _par methods\n";
+    std::cerr << "  --json FILE         Write results to FILE instead of stdout\n";
+}
+
+bool parse_args(int argc, char* argv[], Config& config) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (arg == "--sizes" && has_value) {
+            config.sizes.clear();
+            for (const std::string& item : split_list(argv[++i])) {
+                size_t n;
+                if (!parse_size(item, n)) return false;
+                config.sizes.push_back(n);
+            }
+        } else if (arg == "--datasets" && has_value) {
+            config.datasets = split_list(argv[++i]);
+            for (const std::string& name : config.datasets) {
+                bool known = false;
+                for (const char* candidate : DATASET_NAMES) known = known || name == candidate;
+                if (!known) return false;
+            }
+        } else if (arg == "--filter" && has_value) {
+            config.filters = split_list(argv[++i]);
+        } else if (arg == "--warmup" && has_value) {
+            config.warmup = std::atoi(argv[++i]);
+        } else if (arg == "--reps" && has_value) {
+            config.reps = std::atoi(argv[++i]);
+        } else if (arg == "--min-sample-ms" && has_value) {
+            config.min_sample_ms = std::atof(argv[++i]);
+        } else if (arg == "--threads" && has_value) {
+            config.threads = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--json" && has_value) {
+            config.json_path = argv[++i];
+        } else {
+            return false;
+        }
+    }
+    return !config.sizes.empty();
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Config config;
+    if (!parse_args(argc, argv, config)) {
+        print_usage();
+        return 1;
+    }
+    ThreadPoolOptions pool;
+    pool.threads = config.threads;
+    ThreadPool::configure_shared(pool);
+
+    const std::vector<std::string> dataset_names = config.datasets.empty()
+        ? std::vector<std::string>(std::begin(DATASET_NAMES), std::end(DATASET_NAMES))
+        : config.datasets;
+    const std::vector<Method> methods = all_methods();
+
+    JsonWriter out;
+    out.raw("{\"benchmark\":\"stats_bench\",\"version\":\"1.0.0\",\"isa\":");
+    out.string(kernels::isa_name(kernels::detect_isa()));
+    out.raw(",\"threads\":").integer(static_cast<int>(ThreadPool::shared().size()));
+    out.raw(",\"config\":{\"warmup\":").integer(config.warmup);
+    out.raw(",\"reps\":").integer(config.reps);
+    out.raw(",\"min_sample_ms\":").number(config.min_sample_ms, 3);
+    out.raw("},\"results\":[");
+
+    std::cerr << std::fixed << std::setprecision(1);
+    bool first = true;
+    for (size_t n : config.sizes) {
+        for (const std::string& dataset_name : dataset_names) {
+            Dataset dataset = make_dataset(dataset_name, n);
+            for (const Method& method : methods) {
+                if (!matches(method.name, config.filters)) continue;
+
+                bench::Timing t = bench::measure(config.warmup, config.reps, config.min_sample_ms,
+                                                 [&] { sink = sink + method.run(dataset); });
+                double ns_per_element = t.median_ns / static_cast<double>(n);
+
+                if (!first) out.raw(',');
+                first = false;
+                out.raw("{\"method\":").string(method.name);
+                out.raw(",\"dataset\":").string(dataset.name());
+                out.raw(",\"n\":").integer(static_cast<unsigned long long>(n));
+                out.raw(",\"iterations\":").integer(static_cast<unsigned long long>(t.iterations));
+                out.raw(",\"samples\":").integer(t.samples);
+                out.raw(",\"min_ns\":").number(t.min_ns, 1);
+                out.raw(",\"median_ns\":").number(t.median_ns, 1);
+                out.raw(",\"mean_ns\":").number(t.mean_ns, 1);
+                out.raw(",\"ns_per_element\":").number(ns_per_element, 3);
+                out.raw(",\"elements_per_sec\":").number(1e9 / ns_per_element, 0);
+                out.raw('}');
+
+                std::cerr << std::setw(28) << std::left << method.name << std::right
+                          << std::setw(12) << dataset.name() << std::setw(11) << n
+                          << std::setw(14) << t.median_ns << " ns  "
+                          << std::setprecision(3) << ns_per_element << " ns/elem\n"
+                          << std::setprecision(1);
+            }
+        }
+    }
+    out.raw("]}\n");
+
+    FILE* file = config.json_path.empty() ? stdout : std::fopen(config.json_path.c_str(), "w");
+    if (!file) {
+        std::cerr << "Cannot write " << config.json_path << "\n";
+        return 1;
+    }
+    bool written = std::fwrite(out.data(), 1, out.size(), file) == out.size();
+    if (file != stdout) written = std::fclose(file) == 0 && written;
+    return written ? 0 : 1;
+}
@@ -0,0 +1,68 @@
+/**
+ * Execution Policy Header
+ *
+ * Selects parallel execution for the StatisticsCalculator overloads that
+ * take a policy first, as in std::sort(std::execution::par, ...):
+ *
+ *   StatisticsCalculator::calculate_all(execution::par, data, n);
+ *
+ * Inputs are split into fixed-size chunks (256 KB of doubles by default,
+ * about one L2 cache) that run as ThreadPool tasks. Chunk boundaries
+ * depend only on n and chunk_size, and per-chunk partial results are
+ * combined in chunk order, so a policy call returns bit-identical
+ * results on 1 or 64 threads. They can differ from the sequential
+ * overloads in the last bits, since the summation order differs.
+ *
+ * Interview Talking Points:
+ * - Determinism by fixing the decomposition, not the schedule
+ * - Cache-sized chunks as the unit of parallel work
+ * - Policy objects as an overload-selection tag with configuration
+ *
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#ifndef EXPENSE_EXECUTION_HPP
+#define EXPENSE_EXECUTION_HPP
+
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <cstddef>
+
+namespace expense {
+
+struct ExecutionPolicy {
+    static constexpr size_t DEFAULT_CHUNK_SIZE = 32768;     // doubles (256 KB)
+
+    ThreadPool* pool = nullptr;        // nullptr = ThreadPool::shared()
+    size_t chunk_size = 0;             // elements per task; 0 = DEFAULT_CHUNK_SIZE
+
+    ThreadPool& executor() const { return pool ? *pool : ThreadPool::shared(); }
+    size_t chunk() const { return chunk_size ? chunk_size : DEFAULT_CHUNK_SIZE; }
+    size_t chunks(size_t n) const { return (n + chunk() - 1) / chunk(); }
+
+    /**
+     * Call fn(c, first, last) for every chunk [first, last) of [0, n).
+     */
+    template <typename Fn>
+    void for_each_chunk(size_t n, Fn&& fn) const {
+        const size_t size = chunk();
+        executor().parallel_for(chunks(n), [&](size_t c) {
+            size_t first = c * size;
+            fn(c, first, std::min(n, first + size));
+        });
+    }
+};
+
+namespace execution {
+
+/**
+ * Parallel execution on the shared pool with the default chunk size.
+ */
+inline const ExecutionPolicy par{};
+
+} // namespace execution
+
+} // namespace expense
+
+#endif // EXPENSE_EXECUTION_HPP
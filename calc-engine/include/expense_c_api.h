@@ -0,0 +1,109 @@
+/**
+ * C API Header
+ * 
+ * Plain C entry points into the statistics library for FFI callers
+ * (Python ctypes, Go cgo, ...). Built as the expense_stats_c shared
+ * library. Results use the same fixed double layouts as the JNI *Into
+ * methods; nothing is allocated for the caller.
+ * 
+ * Every function returns EXPENSE_OK or a negative EXPENSE_ERR_* code;
+ * expense_last_error() describes the most recent failure on the calling
+ * thread.
+ * 
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#ifndef EXPENSE_C_API_H
+#define EXPENSE_C_API_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Define EXPENSE_C_API_DLL when consuming the Windows DLL */
+#if defined(_WIN32) && defined(EXPENSE_C_API_BUILD)
+#  define EXPENSE_API __declspec(dllexport)
+#elif defined(_WIN32) && defined(EXPENSE_C_API_DLL)
+#  define EXPENSE_API __declspec(dllimport)
+#elif defined(_WIN32)
+#  define EXPENSE_API
+#else
+#  define EXPENSE_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define EXPENSE_OK 0
+#define EXPENSE_ERR_INVALID (-1)     /* bad argument or input data */
+#define EXPENSE_ERR_BUFFER (-2)      /* output buffer too small */
+
+/* Doubles in the statistics layout (see StatisticsResult::to_array) */
+#define EXPENSE_STATS_FIELDS 13
+
+/* Doubles per group before the quantiles (see GroupStats) */
+#define EXPENSE_GROUP_FIELDS 7
+
+/* expense_group_by_category flags */
+#define EXPENSE_GROUP_VARIANCE 1u
+
+/**
+ * Statistics over amounts[0, n) into out[0, EXPENSE_STATS_FIELDS).
+ */
+EXPENSE_API int expense_calculate_stats(const double* amounts, size_t n,
+                                        double* out, size_t out_len);
+
+/**
+ * Statistics for each segment [offsets[s], offsets[s + 1]) of amounts,
+ * s < offset_count - 1, computed in parallel. out is field-major: field f
+ * of segment s is out[f * segments + s] (fields as in
+ * expense_calculate_stats), so out_len must be at least
+ * EXPENSE_STATS_FIELDS * segments.
+ */
+EXPENSE_API int expense_calculate_segmented(const double* amounts, size_t n,
+                                            const size_t* offsets, size_t offset_count,
+                                            double* out, size_t out_len);
+
+/**
+ * Per-group aggregation of amounts[i] by codes[i] (< group_count <= 256).
+ * Writes group_count blocks of
+ *   EXPENSE_GROUP_FIELDS + percentile_count
+ * doubles: count, sum, mean, min, max, percentage, variance, quantiles.
+ * Variance is computed only with EXPENSE_GROUP_VARIANCE (0 otherwise).
+ */
+EXPENSE_API int expense_group_by_category(const double* amounts, const uint8_t* codes, size_t n,
+                                          uint32_t group_count,
+                                          const double* percentiles, size_t percentile_count,
+                                          unsigned flags, double* out, size_t out_len);
+
+/* expense_resample periods (ISO weeks start on Monday) */
+#define EXPENSE_PERIOD_DAY 0
+#define EXPENSE_PERIOD_WEEK 1
+#define EXPENSE_PERIOD_MONTH 2
+#define EXPENSE_PERIOD_YEAR 3
+
+/**
+ * Calendar resampling of amounts[i] on dates[i] (days since 1970-01-01,
+ * any order) into buckets written to out_starts (bucket's first day),
+ * out_totals and out_counts. With zero_fill, empty buckets between the
+ * first and last transaction are included.
+ * 
+ * *produced receives the bucket count; if it exceeds capacity nothing is
+ * written and EXPENSE_ERR_BUFFER is returned.
+ */
+EXPENSE_API int expense_resample(const int32_t* dates, const double* amounts, size_t n,
+                                 int period, int zero_fill,
+                                 int32_t* out_starts, double* out_totals, uint32_t* out_counts,
+                                 size_t capacity, size_t* produced);
+
+/**
+ * Message for the last failure on this thread ("" if none).
+ */
+EXPENSE_API const char* expense_last_error(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EXPENSE_C_API_H */
@@ -0,0 +1,231 @@
+/**
+ * Expense Cube Header
+ *
+ * Dense aggregate cube of count / sum / sum of squares per
+ * (user, month, category), replacing the full scans behind
+ * getSpendingByCategory, getMonthlySpending and the pandas groupbys the
+ * dashboard (Dashboard.jsx, Reports.jsx) asks for on every load:
+ *
+ *   ExpenseCube cube;
+ *   cube.add(user_id, table);                       // bulk load
+ *   cube.add(user_id, date, Category::Food, Money::parse("250"));
+ *   CubeQuery query;
+ *   query.user = user_id;
+ *   query.month_from = month_index(2024, 1);
+ *   query.month_to = month_index(2024, 12);
+ *   auto categories = cube.by_category(query);      // 2024 by category
+ *   auto months = cube.by_month(query);             // 2024 by month
+ *
+ * Every user owns CATEGORY_COUNT x months() cells over one shared month
+ * span, plus an ALL_USERS plane kept in step with every change, so
+ * roll-ups along any dimension read at most CATEGORY_COUNT x months
+ * cells: a few microseconds, independent of how many expenses there are.
+ * Inserts and deletes are O(1) delta updates (O(cells) when the month
+ * span has to grow, amortised by doubling).
+ *
+ * Sums are exact: paise in int64 and squares of paise in 128 bits, so a
+ * cube maintained by deltas equals one rebuilt from scratch, bit for bit.
+ *
+ * Persistence (serialize / save) writes only non-empty cells as varints;
+ * the ALL_USERS plane is recomputed on load.
+ *
+ * Interview Talking Points:
+ * - Data cube with an ALL member per dimension (Gray et al.)
+ * - Incremental view maintenance with exact (invertible) aggregates
+ * - Dense arrays for low-cardinality dimensions, sparse encoding on disk
+ *
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#ifndef EXPENSE_EXPENSE_CUBE_HPP
+#define EXPENSE_EXPENSE_CUBE_HPP
+
+#include "expense_table.hpp"
+#include "money.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace expense {
+
+constexpr uint32_t CUBE_VERSION = 1;
+
+/**
+ * Query wildcards: every user / every category.
+ */
+constexpr int64_t ALL_USERS = std::numeric_limits<int64_t>::min();
+constexpr int ALL_CATEGORIES = -1;
+
+/**
+ * Longest month span a cube may cover (10,000 years).
+ */
+constexpr size_t MAX_CUBE_MONTHS = 120000;
+
+/**
+ * Months since year 0: year * 12 + (month - 1).
+ */
+inline int32_t month_index(int year, unsigned month) {
+    return static_cast<int32_t>(year * 12 + static_cast<int>(month) - 1);
+}
+
+/**
+ * Month index of an epoch day.
+ */
+int32_t month_index(int32_t epoch_day);
+
+/**
+ * Aggregates of one cell or of a roll-up.
+ */
+struct CubeCell {
+    int64_t count = 0;
+    int64_t sum = 0;          // paise
+    uint64_t sum_sq_lo = 0;   // sum of squared paise, 128-bit
+    uint64_t sum_sq_hi = 0;
+
+    Money total() const { return Money::from_paise(sum); }
+    double mean() const;      // rupees; 0 when empty
+    double variance() const;  // population, rupees^2
+    double stddev() const;
+
+    CubeCell& operator+=(const CubeCell& other);
+    bool operator==(const CubeCell& other) const;
+    bool operator!=(const CubeCell& other) const { return !(*this == other); }
+};
+
+/**
+ * Slice of the cube. Months are inclusive month_index() values; the
+ * defaults select everything.
+ */
+struct CubeQuery {
+    int64_t user = ALL_USERS;
+    int category = ALL_CATEGORIES;      // or a Category ordinal
+    int32_t month_from = std::numeric_limits<int32_t>::min();
+    int32_t month_to = std::numeric_limits<int32_t>::max();
+};
+
+/**
+ * One cell per month of [first_month, first_month + cells.size()).
+ */
+struct MonthlyCells {
+    int32_t first_month = 0;
+    std::vector<CubeCell> cells;
+};
+
+class ExpenseCube {
+public:
+    /**
+     * Record one expense. Amounts must fit DECIMAL(12,2)-style ranges
+     * (|paise| < 2^62) for the sums to stay exact.
+     * @throws std::invalid_argument for ALL_USERS, an invalid category or
+     *         a month span beyond MAX_CUBE_MONTHS
+     * Time Complexity: O(1), amortised over span growth
+     */
+    void add(int64_t user, int32_t date, Category category, Money amount);
+
+    /**
+     * Remove one previously added expense.
+     * @throws std::invalid_argument if its cell holds no expenses
+     */
+    void remove(int64_t user, int32_t date, Category category, Money amount);
+
+    /**
+     * An expense was edited (remove the old version, add the new one).
+     */
+    void update(int64_t user, int32_t old_date, Category old_category, Money old_amount,
+                int32_t new_date, Category new_category, Money new_amount);
+
+    /**
+     * Add every row of a user's table (amounts rounded to paise).
+     */
+    void add(int64_t user, const ExpenseTable& table);
+
+    /**
+     * Roll the query's slice up to one cell.
+     * Time Complexity: O(months x categories in the slice)
+     */
+    CubeCell total(const CubeQuery& query) const;
+
+    /**
+     * One cell per category (index = Category ordinal); the query's
+     * category is ignored.
+     */
+    std::array<CubeCell, CATEGORY_COUNT> by_category(const CubeQuery& query) const;
+
+    /**
+     * One cell per month of the query's range clipped to the cube's span.
+     */
+    MonthlyCells by_month(const CubeQuery& query) const;
+
+    /**
+     * Users with expenses in the slice, ascending by id; the query's user
+     * is ignored.
+     * Time Complexity: O(users x months x categories in the slice)
+     */
+    std::vector<std::pair<int64_t, CubeCell>> by_user(const CubeQuery& query) const;
+
+    size_t user_count() const { return user_ids_.size() - 1; }
+    int32_t first_month() const { return first_month_; }
+    size_t months() const { return months_; }
+
+    // ==================== Persistence ====================
+
+    std::string serialize() const;
+
+    /**
+     * @throws std::runtime_error if the bytes are not a valid cube
+     */
+    static ExpenseCube deserialize(const char* data, size_t size);
+
+    /**
+     * @throws std::runtime_error if the file cannot be written / read
+     */
+    void save(const std::string& path) const;
+    static ExpenseCube load(const std::string& path);
+
+private:
+    static constexpr size_t NO_SLOT = static_cast<size_t>(-1);
+
+    /**
+     * Slot of a user (0 is the ALL_USERS plane), created on first use;
+     * find_slot() returns NO_SLOT for unknown users instead.
+     */
+    size_t slot(int64_t user);
+    size_t find_slot(int64_t user) const;
+
+    /**
+     * Make month part of the span, re-laying out every plane if it grows.
+     */
+    void cover(int32_t month);
+    void apply(size_t slot, size_t month, size_t category, const CubeCell& delta, bool subtract);
+
+    size_t cell_index(size_t slot, size_t month, size_t category) const {
+        return (slot * months_ + month) * CATEGORY_COUNT + category;
+    }
+
+    /**
+     * Fold the query's categories of month offsets [first, last) into out.
+     */
+    void fold(size_t slot, const CubeQuery& query, size_t first, size_t last, CubeCell& out) const;
+
+    /**
+     * Month offsets [*first, *last) of the query within the span; false
+     * if they do not overlap.
+     */
+    bool month_range(const CubeQuery& query, size_t* first, size_t* last) const;
+
+    std::unordered_map<int64_t, size_t> slots_;
+    std::vector<int64_t> user_ids_ = {ALL_USERS};   // by slot
+    int32_t first_month_ = 0;
+    size_t months_ = 0;
+    std::vector<CubeCell> cells_;                    // [slot][month][category]
+};
+
+} // namespace expense
+
+#endif // EXPENSE_EXPENSE_CUBE_HPP
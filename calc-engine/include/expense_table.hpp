@@ -0,0 +1,210 @@
+/**
+ * Expense Table Header
+ * 
+ * Columnar (structure-of-arrays) in-memory store of expense records.
+ * Each attribute lives in its own contiguous array, so kernels that touch
+ * one or two columns (amount by category, amount by date) stream exactly
+ * the bytes they need and can hand the arrays straight to the statistics
+ * and SIMD routines.
+ * 
+ * Columns:
+ *   amount          double   rupees
+ *   date            int32    days since 1970-01-01
+ *   category        uint8    Category (mirrors com.tracker.model.Category)
+ *   merchant        uint32   id into merchants() dictionary
+ *   payment_method  uint32   id into payment_methods() dictionary
+ *   recurring       uint8    0 / 1
+ * 
+ * Interview Talking Points:
+ * - SoA vs AoS: cache-line utilisation for column scans
+ * - Dictionary encoding of low-cardinality strings
+ * - Zero-copy column views (pointer + length)
+ * 
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#ifndef EXPENSE_EXPENSE_TABLE_HPP
+#define EXPENSE_EXPENSE_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace expense {
+
+// ==================== Categories ====================
+
+/**
+ * Expense category codes, in com.tracker.model.Category ordinal order.
+ */
+enum class Category : uint8_t {
+    Food, Transport, Utilities, Entertainment, Shopping, Healthcare, Education,
+    Travel, Groceries, Subscriptions, Rent, Insurance, Savings, Other
+};
+
+constexpr size_t CATEGORY_COUNT = 14;
+
+/**
+ * Java enum constant name ("FOOD", "TRANSPORT", ...).
+ */
+const char* category_name(Category category);
+
+/**
+ * Inverse of category_name().
+ * @throws std::invalid_argument for unknown names
+ */
+Category parse_category(const std::string& name);
+
+// ==================== Dates ====================
+
+/**
+ * Days since 1970-01-01 for a proleptic Gregorian date (month 1-12).
+ */
+int32_t days_from_civil(int year, unsigned month, unsigned day);
+
+/**
+ * Inverse of days_from_civil().
+ */
+void civil_from_days(int32_t days, int* year, unsigned* month, unsigned* day);
+
+/**
+ * Parse "YYYY-MM-DD" into epoch days.
+ * @throws std::invalid_argument if malformed or out of range
+ */
+int32_t parse_iso_date(const std::string& text);
+
+// ==================== Dictionary ====================
+
+/**
+ * Append-only string interning: each distinct string gets the next id.
+ */
+class StringDictionary {
+public:
+    uint32_t intern(const std::string& value);
+
+    /**
+     * @throws std::out_of_range for unknown ids
+     */
+    const std::string& name(uint32_t id) const { return names_.at(id); }
+
+    size_t size() const { return names_.size(); }
+
+private:
+    std::vector<std::string> names_;
+    std::unordered_map<std::string, uint32_t> ids_;
+};
+
+// ==================== Table ====================
+
+/**
+ * Read-only view over a column: pointer + length, no ownership.
+ * Invalidated by any append or reorder of the owning table.
+ */
+template <typename T>
+struct ColumnView {
+    const T* data = nullptr;
+    size_t size = 0;
+
+    const T* begin() const { return data; }
+    const T* end() const { return data + size; }
+    const T& operator[](size_t i) const { return data[i]; }
+    bool empty() const { return size == 0; }
+};
+
+/**
+ * One row, as passed to append() and returned by row().
+ */
+struct ExpenseRecord {
+    double amount = 0.0;
+    int32_t date = 0;
+    Category category = Category::Other;
+    uint32_t merchant = 0;
+    uint32_t payment_method = 0;
+    bool recurring = false;
+};
+
+class ExpenseTable {
+public:
+    ExpenseTable() = default;
+
+    void reserve(size_t rows);
+    void clear();
+
+    /**
+     * Append one row. Ids must come from this table's dictionaries.
+     * Time Complexity: O(1) amortised
+     */
+    void append(const ExpenseRecord& record);
+
+    /**
+     * Append one row, interning merchant and payment method names.
+     */
+    void append(double amount, int32_t date, Category category,
+                const std::string& merchant, const std::string& payment_method,
+                bool recurring = false);
+
+    /**
+     * Append every row of another table, re-interning its merchant and
+     * payment method ids into this table's dictionaries (e.g. to merge
+     * tables built in parallel).
+     * Time Complexity: O(rows + distinct names)
+     */
+    void append(const ExpenseTable& other);
+
+    /**
+     * Reorder all columns by ascending date; rows with equal dates keep
+     * their insertion order. No-op when already sorted.
+     * Time Complexity: O(n log n), plus one gather per column
+     */
+    void sort_by_date();
+
+    /**
+     * True when dates are non-decreasing (tracked incrementally on append).
+     */
+    bool sorted_by_date() const { return sorted_by_date_; }
+
+    size_t size() const { return amounts_.size(); }
+    bool empty() const { return amounts_.empty(); }
+
+    /**
+     * Gather row i across columns.
+     */
+    ExpenseRecord row(size_t i) const;
+
+    // Zero-copy column views
+    ColumnView<double> amounts() const { return view(amounts_); }
+    ColumnView<int32_t> dates() const { return view(dates_); }
+    ColumnView<uint8_t> categories() const { return view(categories_); }
+    ColumnView<uint32_t> merchant_ids() const { return view(merchant_ids_); }
+    ColumnView<uint32_t> payment_method_ids() const { return view(payment_method_ids_); }
+    ColumnView<uint8_t> recurring() const { return view(recurring_); }
+
+    StringDictionary& merchants() { return merchants_; }
+    const StringDictionary& merchants() const { return merchants_; }
+    StringDictionary& payment_methods() { return payment_methods_; }
+    const StringDictionary& payment_methods() const { return payment_methods_; }
+
+private:
+    template <typename T>
+    static ColumnView<T> view(const std::vector<T>& column) {
+        return {column.data(), column.size()};
+    }
+
+    std::vector<double> amounts_;
+    std::vector<int32_t> dates_;
+    std::vector<uint8_t> categories_;
+    std::vector<uint32_t> merchant_ids_;
+    std::vector<uint32_t> payment_method_ids_;
+    std::vector<uint8_t> recurring_;
+
+    StringDictionary merchants_;
+    StringDictionary payment_methods_;
+    bool sorted_by_date_ = true;
+};
+
+} // namespace expense
+
+#endif // EXPENSE_EXPENSE_TABLE_HPP
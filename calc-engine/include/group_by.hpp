@@ -0,0 +1,100 @@
+/**
+ * Group-By Header
+ *
+ * Per-category aggregation of amounts keyed by small integer codes
+ * (normally Category ordinals). Native replacement for
+ * df.groupby('Category')['Amount'].agg(['sum', 'count', 'mean']) and the
+ * spending-by-category SQL query.
+ *
+ * Interview Talking Points:
+ * - Direct-indexed accumulator array instead of a hash map
+ * - Single pass for sum/count/min/max; extra passes only when asked
+ * - Counting-sort scatter so per-group quantiles reuse multi-selection
+ *
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#ifndef EXPENSE_GROUP_BY_HPP
+#define EXPENSE_GROUP_BY_HPP
+
+#include "expense_table.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace expense {
+
+class JsonWriter;
+
+/**
+ * Aggregates for one group. Empty groups have count 0 and all-zero fields.
+ */
+struct GroupStats {
+    size_t count = 0;
+    double sum = 0.0;
+    double mean = 0.0;
+    double min = 0.0;
+    double max = 0.0;
+    double percentage = 0.0;   // share of the grand total, 0-100
+    double variance = 0.0;     // population; only with GroupByOptions::variance
+    std::vector<double> quantiles;   // one per GroupByOptions::percentiles
+
+    /**
+     * Fixed binary layout: count, sum, mean, min, max, percentage,
+     * variance, then the quantiles. Must match com.tracker.jni.StatsLayout.
+     */
+    static constexpr size_t FIELD_COUNT = 7;
+};
+
+struct GroupByOptions {
+    bool variance = false;
+    std::vector<double> percentiles;   // 0-100; empty for none
+};
+
+struct GroupByResult {
+    std::vector<GroupStats> groups;    // indexed by code
+    std::vector<double> percentiles;
+    double total = 0.0;
+    bool has_variance = false;
+
+    /**
+     * JSON keyed by category name (non-empty groups only), with the same
+     * total/count/average/percentage keys as the analytics engine.
+     */
+    std::string to_json() const;
+    void write_json(JsonWriter& out) const;
+
+    /**
+     * Doubles per group in to_array(): FIELD_COUNT + percentiles.size().
+     */
+    size_t stride() const { return GroupStats::FIELD_COUNT + percentiles.size(); }
+
+    /**
+     * Write groups.size() * stride() doubles, one block per code.
+     */
+    void to_array(double* out) const;
+};
+
+/**
+ * Aggregate amounts[i] into group codes[i].
+ * Time Complexity: O(n) plus O(n) per quantile pass
+ *
+ * @param group_count Number of codes (at most 256)
+ * @throws std::invalid_argument if a code is >= group_count or a
+ *         percentile is outside [0, 100]
+ */
+GroupByResult group_by_category(const double* amounts, const uint8_t* codes, size_t n,
+                                size_t group_count = CATEGORY_COUNT,
+                                const GroupByOptions& options = GroupByOptions());
+
+/**
+ * Aggregate a table's amount column by its category column.
+ */
+GroupByResult group_by_category(const ExpenseTable& table,
+                                const GroupByOptions& options = GroupByOptions());
+
+} // namespace expense
+
+#endif // EXPENSE_GROUP_BY_HPP
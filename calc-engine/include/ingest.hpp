@@ -0,0 +1,161 @@
+/**
+ * Amount Ingestion Header
+ * 
+ * Bulk parsing of whitespace-separated amounts from an in-memory buffer,
+ * a memory-mapped file or a block-read stream, using std::from_chars
+ * (locale-independent, no iostream overhead).
+ * 
+ * Input Format:
+ *   Optional first line: number of values (N)
+ *   Then: amounts separated by whitespace (normally one per line)
+ * 
+ * Interview Talking Points:
+ * - std::from_chars for allocation-free, locale-free number parsing
+ * - mmap for zero-copy file access
+ * - Precise line/column diagnostics
+ * 
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#ifndef EXPENSE_INGEST_HPP
+#define EXPENSE_INGEST_HPP
+
+#include "money.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace expense {
+
+/**
+ * Parse failure with a 1-based source position.
+ */
+class ParseError : public std::runtime_error {
+public:
+    ParseError(const std::string& message, size_t line, size_t column);
+    
+    size_t line() const { return line_; }
+    size_t column() const { return column_; }
+
+private:
+    size_t line_;
+    size_t column_;
+};
+
+/**
+ * How to treat a leading count line.
+ */
+enum class CountHeader {
+    /**
+     * The first token is a count only when it is a plain integer equal
+     * to the number of values that follow; otherwise every token is a
+     * value, so a count that does not match its data is read as data.
+     * Use None for headerless data whose first value could be mistaken
+     * for a count.
+     */
+    Auto,
+    
+    /**
+     * Every token is a value.
+     */
+    None
+};
+
+/**
+ * Parsed amounts. `exact` is filled only when parsing in exact mode.
+ */
+struct AmountBatch {
+    std::vector<double> amounts;
+    std::vector<Money> exact;
+    bool had_count = false;
+};
+
+/**
+ * Parse amounts from [first, last).
+ * 
+ * @param exact Also parse each token as exact paise (Money)
+ * @throws ParseError on malformed input
+ */
+AmountBatch parse_amounts(const char* first, const char* last,
+                          bool exact = false,
+                          CountHeader header = CountHeader::Auto);
+
+/**
+ * Parsed (amount, category) pairs for group-by requests.
+ */
+struct CategorizedBatch {
+    std::vector<double> amounts;
+    std::vector<uint8_t> codes;        // Category ordinals
+    bool had_count = false;
+};
+
+/**
+ * Parse "amount CATEGORY" pairs from [first, last), where CATEGORY is a
+ * com.tracker.model.Category constant name (e.g. "250.00 FOOD").
+ * 
+ * The optional count line holds the number of pairs. Because pairs
+ * start with an amount and continue with a name, a leading integer
+ * followed by another number is unambiguously a count.
+ * 
+ * @throws ParseError on malformed input, unknown categories or a count
+ *         that does not match the number of pairs
+ */
+CategorizedBatch parse_categorized(const char* first, const char* last,
+                                   CountHeader header = CountHeader::Auto);
+
+/**
+ * Amounts for many independent series (e.g. one per user), back to back.
+ * Segment s is amounts[offsets[s], offsets[s + 1]).
+ */
+struct SegmentedBatch {
+    std::vector<double> amounts;
+    std::vector<size_t> offsets;       // segments + 1 entries, starting at 0
+    
+    size_t segments() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+};
+
+/**
+ * Parse one segment per line from [first, last): whitespace-separated
+ * amounts, no count header. Blank lines are empty segments; blank lines
+ * after the last amount are ignored.
+ * 
+ * @throws ParseError on malformed amounts
+ */
+SegmentedBatch parse_segmented(const char* first, const char* last);
+
+/**
+ * Read a whole stream in large blocks (no per-value I/O).
+ */
+std::string read_stream(std::FILE* stream);
+
+/**
+ * Read-only view of a file, memory-mapped where supported.
+ */
+class MappedFile {
+public:
+    /**
+     * @throws std::runtime_error if the file cannot be opened
+     */
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+    
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    bool mapped_ = false;
+    std::string fallback_;
+};
+
+} // namespace expense
+
+#endif // EXPENSE_INGEST_HPP
@@ -0,0 +1,125 @@
+/**
+ * JSON Writer Header
+ *
+ * Minimal append-only JSON emitter for the result types. Numbers are
+ * formatted with std::to_chars (fixed precision, locale-independent) into
+ * a reusable char buffer; no per-field strings or stream objects.
+ *
+ * Two sinks:
+ * - Memory: the buffer grows as needed and is read back with data()/str().
+ *   clear() keeps the capacity, so one writer can serve many responses.
+ * - File descriptor: the buffer is a fixed-size staging area that is
+ *   flushed with write(2) whenever it fills, so multi-megabyte moving
+ *   average arrays never exist as a single string.
+ *
+ * The writer does not track structure; callers emit separators with raw().
+ *
+ * Interview Talking Points:
+ * - std::to_chars vs ostringstream: no locale, no virtual dispatch, no allocation
+ * - Bounded-memory streaming output
+ *
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#ifndef EXPENSE_JSON_WRITER_HPP
+#define EXPENSE_JSON_WRITER_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace expense {
+
+class JsonWriter {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 4 * 1024;
+    static constexpr size_t STREAM_CAPACITY = 64 * 1024;
+
+    /**
+     * In-memory writer with an initial buffer of `capacity` bytes.
+     */
+    explicit JsonWriter(size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * Writer that streams to `fd` through a `capacity`-byte buffer.
+     * The descriptor is not owned.
+     */
+    static JsonWriter stream(int fd, size_t capacity = STREAM_CAPACITY);
+
+    /**
+     * Flushes pending output in streaming mode.
+     */
+    ~JsonWriter();
+
+    JsonWriter(JsonWriter&& other) noexcept;
+    JsonWriter& operator=(JsonWriter&&) = delete;
+    JsonWriter(const JsonWriter&) = delete;
+    JsonWriter& operator=(const JsonWriter&) = delete;
+
+    // ==================== Emitters ====================
+
+    JsonWriter& raw(const char* text, size_t length);
+    JsonWriter& raw(const char* text) { return raw(text, std::strlen(text)); }
+    JsonWriter& raw(char c);
+
+    /**
+     * Fixed-notation number with `precision` decimals (like std::fixed).
+     */
+    JsonWriter& number(double value, int precision);
+
+    JsonWriter& integer(long long value);
+    JsonWriter& integer(unsigned long long value);
+    JsonWriter& integer(int value) { return integer(static_cast<long long>(value)); }
+    JsonWriter& integer(unsigned long value) { return integer(static_cast<unsigned long long>(value)); }
+
+    /**
+     * Quoted string; quotes, backslashes and control characters are escaped.
+     */
+    JsonWriter& string(const char* text, size_t length);
+    JsonWriter& string(const std::string& text) { return string(text.data(), text.size()); }
+
+    // ==================== Buffer Control ====================
+
+    /**
+     * Make room for at least `bytes` more output (memory mode only).
+     */
+    void reserve(size_t bytes);
+
+    /**
+     * Discard buffered output, keeping the allocation.
+     */
+    void clear() { size_ = 0; }
+
+    /**
+     * Write buffered output to the descriptor. No-op in memory mode.
+     * @return false once any write has failed
+     */
+    bool flush();
+
+    bool ok() const { return ok_; }
+    bool streaming() const { return fd_ >= 0; }
+
+    // Buffered (memory mode: all) output
+    const char* data() const { return buffer_.data(); }
+    size_t size() const { return size_; }
+    std::string str() const { return std::string(buffer_.data(), size_); }
+
+private:
+    JsonWriter(int fd, size_t capacity);
+
+    /**
+     * Ensure `bytes` contiguous free bytes, flushing or growing the buffer.
+     */
+    char* ensure(size_t bytes);
+
+    std::vector<char> buffer_;
+    size_t size_ = 0;
+    int fd_ = -1;
+    bool ok_ = true;
+};
+
+} // namespace expense
+
+#endif // EXPENSE_JSON_WRITER_HPP
@@ -0,0 +1,89 @@
+/**
+ * Money Type Header
+ * 
+ * Fixed-point currency amount stored as an integer number of paise,
+ * matching the DECIMAL(12,2) `expenses.amount` column exactly.
+ * 
+ * Interview Talking Points:
+ * - Fixed-point arithmetic avoids floating-point drift in totals
+ * - Trivially copyable wrapper: std::vector<Money> is a flat int64 array,
+ *   so integer reductions vectorize
+ * 
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#ifndef EXPENSE_MONEY_HPP
+#define EXPENSE_MONEY_HPP
+
+#include <cstdint>
+#include <cmath>
+#include <string>
+#include <type_traits>
+
+namespace expense {
+
+/**
+ * Currency amount in paise (1/100 of a rupee).
+ * 
+ * Sums are exact as long as they fit in int64 (about 9.2e16 rupees).
+ */
+class Money {
+public:
+    constexpr Money() = default;
+    
+    static constexpr Money from_paise(int64_t paise) { return Money(paise); }
+    
+    /**
+     * Round a floating-point rupee amount to the nearest paisa.
+     */
+    static Money from_double(double amount) {
+        return Money(static_cast<int64_t>(std::llround(amount * 100.0)));
+    }
+    
+    /**
+     * Parse an exact decimal string such as "1500", "-12.5" or "85.30".
+     * 
+     * @throws std::invalid_argument if the text is not a decimal with
+     *         at most two fraction digits
+     */
+    static Money parse(const std::string& text);
+    
+    /**
+     * Parse the characters in [first, last); same rules as above.
+     */
+    static Money parse(const char* first, const char* last);
+    
+    constexpr int64_t paise() const { return paise_; }
+    
+    double to_double() const { return static_cast<double>(paise_) / 100.0; }
+    
+    /**
+     * Format with exactly two fraction digits, e.g. "85.30".
+     */
+    std::string to_string() const;
+    
+    constexpr Money operator+(Money other) const { return Money(paise_ + other.paise_); }
+    constexpr Money operator-(Money other) const { return Money(paise_ - other.paise_); }
+    Money& operator+=(Money other) { paise_ += other.paise_; return *this; }
+    Money& operator-=(Money other) { paise_ -= other.paise_; return *this; }
+    
+    constexpr bool operator==(Money other) const { return paise_ == other.paise_; }
+    constexpr bool operator!=(Money other) const { return paise_ != other.paise_; }
+    constexpr bool operator<(Money other) const { return paise_ < other.paise_; }
+    constexpr bool operator>(Money other) const { return paise_ > other.paise_; }
+    constexpr bool operator<=(Money other) const { return paise_ <= other.paise_; }
+    constexpr bool operator>=(Money other) const { return paise_ >= other.paise_; }
+
+private:
+    constexpr explicit Money(int64_t paise) : paise_(paise) {}
+    
+    int64_t paise_ = 0;
+};
+
+static_assert(sizeof(Money) == sizeof(int64_t), "Money must stay a bare int64");
+static_assert(std::is_trivially_copyable<Money>::value, "Money must be trivially copyable");
+
+} // namespace expense
+
+#endif // EXPENSE_MONEY_HPP
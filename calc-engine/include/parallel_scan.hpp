@@ -0,0 +1,62 @@
+/**
+ * Parallel Scan Header
+ *
+ * Multi-threaded simple and exponential moving averages for very long
+ * series (multi-year, per-transaction backfills). Results have the same
+ * shape as StatisticsCalculator::moving_average and
+ * exponential_moving_average and agree with them to rounding.
+ *
+ * - SMA: every output chunk recomputes its first window sum directly and
+ *   then slides, so chunks are independent. Chunks are at least a few
+ *   windows long, which bounds the extra work.
+ * - EMA: y[i] = a*x[i] + b*y[i-1] (b = 1 - a) is a linear recurrence.
+ *   Pass 1 scans each chunk from a zero carry; a short sequential pass
+ *   chains the chunk carries (y_end = z_end + b^len * y_in); pass 2 adds
+ *   b^(k+1) * y_in to the k-th value of each chunk, stopping once the
+ *   power drops below eps^2. The fix-up runs four lanes with independent
+ *   power chains so it vectorises.
+ *
+ * Deterministic: chunk boundaries depend only on n, the window and
+ * ExecutionPolicy::chunk_size, never on the thread count or scheduling,
+ * so 1 and 64 threads produce bit-identical output.
+ *
+ * Interview Talking Points:
+ * - Linear recurrences as associative scans with carry propagation
+ * - Chunked two-pass parallel scan (reduce, carry, fix-up)
+ * - Determinism by fixing the decomposition, not the schedule
+ *
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#ifndef EXPENSE_PARALLEL_SCAN_HPP
+#define EXPENSE_PARALLEL_SCAN_HPP
+
+#include "execution.hpp"
+#include "statistics.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace expense {
+
+/**
+ * Parallel moving_average(); window clamped to n as there.
+ * Time Complexity: O(n / threads) plus O(window) per chunk
+ */
+MovingAverageResult parallel_moving_average(const double* data, size_t n, int window,
+                                            const ExecutionPolicy& policy = execution::par);
+MovingAverageResult parallel_moving_average(const std::vector<double>& data, int window,
+                                            const ExecutionPolicy& policy = execution::par);
+
+/**
+ * Parallel exponential_moving_average(); y[0] = x[0], alpha in (0, 1].
+ * Time Complexity: O(n / threads + chunks)
+ */
+MovingAverageResult parallel_exponential_moving_average(const double* data, size_t n, double alpha,
+                                                        const ExecutionPolicy& policy = execution::par);
+MovingAverageResult parallel_exponential_moving_average(const std::vector<double>& data, double alpha,
+                                                        const ExecutionPolicy& policy = execution::par);
+
+} // namespace expense
+
+#endif // EXPENSE_PARALLEL_SCAN_HPP
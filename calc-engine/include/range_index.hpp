@@ -0,0 +1,243 @@
+/**
+ * Range Index Header
+ *
+ * Updatable indexes for "total spent between date A and B" while
+ * expenses are created, edited and deleted (ExpenseController):
+ *
+ *   DailyTotals days(table);
+ *   Money q1 = days.total(parse_iso_date("2024-01-01"), parse_iso_date("2024-03-31"));
+ *   days.update(old_date, old_amount, new_date, new_amount);   // an edit
+ *
+ * FenwickTree keeps prefix sums with O(log n) point updates;
+ * MinMaxTree is an iterative segment tree for range min/max with O(log n)
+ * point assignment (a sparse table answers min/max in O(1) but must be
+ * rebuilt on every change). DailyTotals combines them over one slot per
+ * calendar day. All three are exact for Money, so any sequence of adds
+ * and removes leaves the same totals as a fresh build.
+ *
+ * Interview Talking Points:
+ * - Binary indexed tree: lowest-set-bit walks for prefix sums
+ * - Bottom-up segment tree without recursion or padding to 2^k
+ * - Sparse table vs segment tree: O(1) static queries vs O(log n) updates
+ *
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#ifndef EXPENSE_RANGE_INDEX_HPP
+#define EXPENSE_RANGE_INDEX_HPP
+
+#include "expense_table.hpp"
+#include "money.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace expense {
+
+// ==================== Fenwick Tree ====================
+
+/**
+ * Prefix sums over n slots with point updates. T needs T(), + and -
+ * (double, int64_t, Money).
+ */
+template <typename T>
+class FenwickTree {
+public:
+    explicit FenwickTree(size_t n = 0) : tree_(n + 1, T()) {}
+
+    /**
+     * Build from initial values.
+     * Time Complexity: O(n)
+     */
+    explicit FenwickTree(const std::vector<T>& values) : tree_(values.size() + 1, T()) {
+        for (size_t i = 1; i < tree_.size(); ++i) {
+            tree_[i] = tree_[i] + values[i - 1];
+            size_t parent = i + (i & (~i + 1));
+            if (parent < tree_.size()) tree_[parent] = tree_[parent] + tree_[i];
+        }
+    }
+
+    size_t size() const { return tree_.size() - 1; }
+
+    /**
+     * values[i] += delta.
+     * Time Complexity: O(log n)
+     */
+    void add(size_t i, T delta) {
+        for (size_t k = i + 1; k < tree_.size(); k += k & (~k + 1)) {
+            tree_[k] = tree_[k] + delta;
+        }
+    }
+
+    /**
+     * Sum of values[0, end).
+     * Time Complexity: O(log n)
+     */
+    T prefix(size_t end) const {
+        T total = T();
+        for (size_t k = std::min(end, size()); k > 0; k &= k - 1) {
+            total = total + tree_[k];
+        }
+        return total;
+    }
+
+    /**
+     * Sum of values[first, last); empty when first >= last.
+     */
+    T sum(size_t first, size_t last) const {
+        return first < last ? prefix(last) - prefix(first) : T();
+    }
+
+private:
+    std::vector<T> tree_;   // 1-based; tree_[k] sums (k - lowbit(k), k]
+};
+
+// ==================== Min/Max Segment Tree ====================
+
+template <typename T>
+struct MinMax {
+    T min = T();
+    T max = T();
+};
+
+/**
+ * Range minimum and maximum over n slots with point assignment. T needs
+ * operator<.
+ */
+template <typename T>
+class MinMaxTree {
+public:
+    explicit MinMaxTree(size_t n = 0) : n_(n), nodes_(2 * n) {}
+
+    /**
+     * Build from initial values.
+     * Time Complexity: O(n)
+     */
+    explicit MinMaxTree(const std::vector<T>& values) : n_(values.size()), nodes_(2 * values.size()) {
+        for (size_t i = 0; i < n_; ++i) nodes_[n_ + i] = {values[i], values[i]};
+        for (size_t k = n_; k-- > 1;) nodes_[k] = merge(nodes_[2 * k], nodes_[2 * k + 1]);
+    }
+
+    size_t size() const { return n_; }
+
+    /**
+     * values[i] = value.
+     * Time Complexity: O(log n)
+     */
+    void set(size_t i, T value) {
+        size_t k = n_ + i;
+        nodes_[k] = {value, value};
+        for (k /= 2; k >= 1; k /= 2) nodes_[k] = merge(nodes_[2 * k], nodes_[2 * k + 1]);
+    }
+
+    /**
+     * Min and max of values[first, last).
+     * @throws std::out_of_range if the range is empty or past the end
+     * Time Complexity: O(log n)
+     */
+    MinMax<T> range(size_t first, size_t last) const {
+        if (first >= last || last > n_) {
+            throw std::out_of_range("MinMaxTree range is empty or out of bounds");
+        }
+        MinMax<T> result = nodes_[n_ + first];
+        for (size_t lo = n_ + first, hi = n_ + last; lo < hi; lo /= 2, hi /= 2) {
+            if (lo & 1) result = merge(result, nodes_[lo++]);
+            if (hi & 1) result = merge(result, nodes_[--hi]);
+        }
+        return result;
+    }
+
+private:
+    static MinMax<T> merge(const MinMax<T>& a, const MinMax<T>& b) {
+        return {b.min < a.min ? b.min : a.min, a.max < b.max ? b.max : a.max};
+    }
+
+    size_t n_;
+    std::vector<MinMax<T>> nodes_;   // leaves at [n, 2n), node k covers 2k and 2k + 1
+};
+
+// ==================== Daily Totals ====================
+
+/**
+ * Per-day spending over a span of epoch days, with O(log days) edits and
+ * range queries. Days without expenses count as zero; adding an expense
+ * outside the span grows it (amortised O(1) per day added).
+ */
+class DailyTotals {
+public:
+    /**
+     * Empty span; the first add() sets it.
+     */
+    DailyTotals() = default;
+
+    /**
+     * Zero totals for every day in [first_day, last_day].
+     * @throws std::invalid_argument if last_day < first_day
+     */
+    DailyTotals(int32_t first_day, int32_t last_day);
+
+    /**
+     * Totals of every row of table (amounts rounded to paise).
+     * Time Complexity: O(rows + days)
+     */
+    explicit DailyTotals(const ExpenseTable& table);
+
+    /**
+     * An expense was created / deleted / edited.
+     * Time Complexity: O(log days), plus growth when date is outside
+     * the span
+     */
+    void add(int32_t date, Money amount);
+    void remove(int32_t date, Money amount);
+    void update(int32_t old_date, Money old_amount, int32_t new_date, Money new_amount);
+
+    /**
+     * Total and number of expenses dated within [from, to].
+     * Time Complexity: O(log days)
+     */
+    Money total(int32_t from, int32_t to) const;
+    size_t count(int32_t from, int32_t to) const;
+
+    /**
+     * Smallest and largest single-day total within [from, to]; days
+     * outside the span count as zero.
+     * @throws std::invalid_argument if to < from
+     * Time Complexity: O(log days)
+     */
+    MinMax<Money> day_extremes(int32_t from, int32_t to) const;
+
+    /**
+     * Total of one day.
+     */
+    Money day(int32_t date) const { return total(date, date); }
+
+    int32_t first_day() const { return first_day_; }
+    size_t days() const { return totals_.size(); }
+
+private:
+    /**
+     * Make date part of the span, rebuilding the trees if it grows.
+     */
+    void cover(int32_t date);
+    void rebuild();
+    void apply(int32_t date, Money amount, int64_t count_delta);
+
+    /**
+     * Slots [*first, *last) of the covered part of [from, to].
+     */
+    void slots(int32_t from, int32_t to, size_t* first, size_t* last) const;
+
+    int32_t first_day_ = 0;
+    std::vector<Money> totals_;      // per day, the source for rebuilds
+    std::vector<int64_t> counts_;
+    FenwickTree<Money> total_tree_;
+    FenwickTree<int64_t> count_tree_;
+    MinMaxTree<Money> extremes_;
+};
+
+} // namespace expense
+
+#endif // EXPENSE_RANGE_INDEX_HPP
@@ -0,0 +1,113 @@
+/**
+ * Resampling Header
+ * 
+ * Calendar-aware bucketing of sparse (epoch-day, amount) transactions
+ * into dense daily, ISO-weekly, calendar-monthly or yearly series.
+ * Month lengths and leap years come from the civil-date conversion in
+ * expense_table.hpp, so callers no longer supply days-per-month.
+ * 
+ * Two strategies with identical results:
+ * - Sorted: one pass over the transactions in date order. Input that is
+ *   already ordered (e.g. a sorted ExpenseTable) is used as is; otherwise
+ *   a stable index sort comes first.
+ * - Counting: for unordered input whose date span is bounded (relative to
+ *   n), amounts are accumulated into a per-day array indexed by
+ *   date - min_date instead of sorting.
+ * Both sum per day first and then fold days into buckets, so the rounding
+ * is the same either way.
+ * 
+ * Interview Talking Points:
+ * - Counting sort vs comparison sort: O(n + range) vs O(n log n)
+ * - Epoch-day arithmetic for ISO weeks, months and leap years
+ * - Zero-filled dense output for time-series consumers
+ * 
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#ifndef EXPENSE_RESAMPLE_HPP
+#define EXPENSE_RESAMPLE_HPP
+
+#include "expense_table.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace expense {
+
+class JsonWriter;
+
+/**
+ * Bucket width. Weeks start on Monday (ISO 8601).
+ */
+enum class Period { Day, IsoWeek, Month, Year };
+
+enum class ResampleStrategy { Auto, Counting, Sorted };
+
+struct ResampleOptions {
+    Period period = Period::Month;
+    bool zero_fill = true;              // emit empty buckets between first and last
+    ResampleStrategy strategy = ResampleStrategy::Auto;
+};
+
+/**
+ * Buckets in ascending date order.
+ */
+struct ResampleResult {
+    Period period = Period::Month;
+    std::vector<int32_t> starts;        // epoch day of each bucket's first day
+    std::vector<double> totals;
+    std::vector<uint32_t> counts;       // transactions per bucket
+
+    size_t size() const { return starts.size(); }
+
+    /**
+     * "2024-03-15", "2024-W11", "2024-03" or "2024".
+     */
+    std::string label(size_t i) const;
+
+    /**
+     * {"period":"month","buckets":[{"period":"2024-03","total":..,"count":..},...]}
+     */
+    std::string to_json() const;
+    void write_json(JsonWriter& out) const;
+};
+
+/**
+ * Epoch day of the first day of the bucket containing `day`.
+ */
+int32_t period_start(int32_t day, Period period);
+
+/**
+ * Epoch day of the bucket after the one starting at `start`.
+ */
+int32_t next_period_start(int32_t start, Period period);
+
+/**
+ * "day", "week", "month" or "year".
+ */
+const char* period_name(Period period);
+
+/**
+ * Inverse of period_name().
+ * @throws std::invalid_argument for unknown names
+ */
+Period parse_period(const std::string& name);
+
+/**
+ * Bucket amounts[i] by dates[i] (days since 1970-01-01); any order.
+ * Time Complexity: O(n + days spanned) counting, O(n log n) sorted
+ */
+ResampleResult resample(const int32_t* dates, const double* amounts, size_t n,
+                        const ResampleOptions& options = ResampleOptions());
+
+/**
+ * Resample a table's date and amount columns.
+ */
+ResampleResult resample(const ExpenseTable& table,
+                        const ResampleOptions& options = ResampleOptions());
+
+} // namespace expense
+
+#endif // EXPENSE_RESAMPLE_HPP
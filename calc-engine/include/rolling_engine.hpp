@@ -0,0 +1,113 @@
+/**
+ * Rolling Engine Header
+ * 
+ * Computes several rolling statistics over several window sizes in one
+ * sweep of the data (e.g. 7/30/90-value mean, stddev, min and max for a
+ * dashboard), instead of one moving_average() call and one scan per
+ * series.
+ * 
+ * Per window, in O(1) amortised per step:
+ * - sum/mean: compensated (Neumaier) running sum, so adding and removing
+ *   values does not accumulate drift
+ * - variance/stddev: compensated sums of shifted values and their squares
+ * - min/max: monotonic queues of indices
+ * Output series are sized up front and written in place.
+ * 
+ * Interview Talking Points:
+ * - Monotonic deque for sliding-window extrema
+ * - Compensated summation for add/remove running sums
+ * - Fusing many passes into one cache-friendly sweep
+ * 
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#ifndef EXPENSE_ROLLING_ENGINE_HPP
+#define EXPENSE_ROLLING_ENGINE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace expense {
+
+class JsonWriter;
+
+enum class RollingStat : uint8_t { Sum, Mean, Variance, Stddev, Min, Max };
+
+constexpr size_t ROLLING_STAT_COUNT = 6;
+
+/**
+ * "sum", "mean", "variance", "stddev", "min" or "max".
+ */
+const char* rolling_stat_name(RollingStat stat);
+
+/**
+ * Inverse of rolling_stat_name().
+ * @throws std::invalid_argument for unknown names
+ */
+RollingStat parse_rolling_stat(const std::string& name);
+
+/**
+ * One window size and the statistics wanted over it.
+ */
+struct WindowSpec {
+    int window = 0;
+    std::vector<RollingStat> stats;
+};
+
+/**
+ * One output series. Like moving_average(), a window larger than the
+ * data is clamped to n and the series has n - window + 1 values.
+ */
+struct RollingSeries {
+    int window = 0;             // as requested
+    int effective_window = 0;   // clamped to the data length
+    RollingStat stat = RollingStat::Mean;
+    std::vector<double> values;
+};
+
+struct RollingResult {
+    std::vector<RollingSeries> series;     // in spec order, then stat order
+
+    /**
+     * Series for the requested window and stat, or nullptr.
+     */
+    const RollingSeries* find(int window, RollingStat stat) const;
+
+    /**
+     * [{"window_size":7,"stat":"mean","values":[...]},...]
+     */
+    std::string to_json() const;
+    void write_json(JsonWriter& out) const;
+};
+
+class RollingEngine {
+public:
+    RollingEngine() = default;
+    explicit RollingEngine(std::vector<WindowSpec> specs);
+
+    /**
+     * @throws std::invalid_argument if window <= 0 or stats is empty
+     */
+    RollingEngine& add(int window, std::vector<RollingStat> stats);
+
+    /**
+     * Compute every requested series in one pass over data.
+     * Time Complexity: O(n * windows) amortised
+     */
+    RollingResult run(const double* data, size_t n) const;
+    RollingResult run(const std::vector<double>& data) const {
+        return run(data.data(), data.size());
+    }
+
+    const std::vector<WindowSpec>& specs() const { return specs_; }
+
+private:
+    std::vector<WindowSpec> specs_;
+};
+
+} // namespace expense
+
+#endif // EXPENSE_ROLLING_ENGINE_HPP
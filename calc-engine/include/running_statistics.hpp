@@ -0,0 +1,115 @@
+/**
+ * Running Statistics Header
+ * 
+ * Mergeable streaming accumulator for incremental expense statistics.
+ * Lets per-user state be updated on each insert/delete instead of
+ * re-scanning the full history.
+ * 
+ * Interview Talking Points:
+ * - Welford's online algorithm for numerically stable variance
+ * - Chan's parallel algorithm for merging partial accumulators
+ * - Compact, versioned binary serialization for persistence
+ * 
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#ifndef EXPENSE_RUNNING_STATISTICS_HPP
+#define EXPENSE_RUNNING_STATISTICS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace expense {
+
+/**
+ * Streaming accumulator tracking count, sum, mean, M2, min and max.
+ * 
+ * push/remove/merge are O(1). Min and max carry occurrence counts so
+ * removing one of several equal extremes keeps them exact; removing the
+ * last occurrence marks them stale (see extrema_exact()).
+ */
+class RunningStatistics {
+public:
+    RunningStatistics() = default;
+    
+    /**
+     * Add one value.
+     * Time Complexity: O(1)
+     */
+    void push(double value);
+    
+    /**
+     * Remove a value previously pushed (e.g. a deleted expense).
+     * Time Complexity: O(1)
+     * 
+     * @return false if the accumulator is empty
+     */
+    bool remove(double value);
+    
+    /**
+     * Combine another accumulator into this one (Chan et al.).
+     * Time Complexity: O(1)
+     */
+    void merge(const RunningStatistics& other);
+    
+    /**
+     * Reset to the empty state.
+     */
+    void clear();
+    
+    size_t count() const { return count_; }
+    double sum() const { return sum_; }
+    double mean() const { return mean_; }
+    double min() const { return min_; }
+    double max() const { return max_; }
+    
+    /**
+     * Population variance (matches StatisticsCalculator::variance).
+     */
+    double variance() const;
+    
+    /**
+     * Sample variance (matches StatisticsCalculator::sample_variance).
+     */
+    double sample_variance() const;
+    
+    double stddev() const;
+    double sample_stddev() const;
+    
+    /**
+     * False once the last occurrence of the min or max has been removed;
+     * the caller should rebuild from source data to refresh them.
+     */
+    bool extrema_exact() const { return extrema_exact_; }
+    
+    /**
+     * Encode to a fixed-size little-endian blob (SERIALIZED_SIZE bytes).
+     */
+    std::vector<uint8_t> serialize() const;
+    
+    /**
+     * Decode a blob produced by serialize().
+     * 
+     * @throws std::invalid_argument on a malformed or unknown-version blob
+     */
+    static RunningStatistics deserialize(const std::vector<uint8_t>& blob);
+    
+    static constexpr size_t SERIALIZED_SIZE = 4 + 5 * 8 + 3 * 8;
+
+private:
+    uint64_t count_ = 0;
+    double sum_ = 0.0;
+    double mean_ = 0.0;
+    double m2_ = 0.0;
+    double min_ = 0.0;
+    double max_ = 0.0;
+    uint64_t min_count_ = 0;
+    uint64_t max_count_ = 0;
+    bool extrema_exact_ = true;
+};
+
+} // namespace expense
+
+#endif // EXPENSE_RUNNING_STATISTICS_HPP
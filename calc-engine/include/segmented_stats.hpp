@@ -0,0 +1,89 @@
+/**
+ * Segmented Statistics Header
+ *
+ * Batch form of StatisticsCalculator::calculate_all for nightly jobs:
+ * one flat amounts array holding every user's expenses back to back,
+ * plus an offsets array marking where each user's segment starts. One
+ * call computes every segment on the work-stealing ThreadPool and
+ * returns the StatisticsResult fields as a struct of arrays, instead of
+ * one process or JNI call, vector and JSON string per user.
+ *
+ * Segments are sorted in a single scratch copy of the amounts, so the
+ * batch makes one allocation for all users rather than one per user.
+ * Each segment's numbers are identical to calculate_all on that segment
+ * alone, whatever the thread count.
+ *
+ * Interview Talking Points:
+ * - CSR-style offsets for ragged batches
+ * - Struct-of-arrays output for columnar consumers
+ * - Work stealing for skewed segment sizes
+ *
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#ifndef EXPENSE_SEGMENTED_STATS_HPP
+#define EXPENSE_SEGMENTED_STATS_HPP
+
+#include "statistics.hpp"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace expense {
+
+class JsonWriter;
+class ThreadPool;
+
+/**
+ * Per-segment statistics, field-major: field f of segment s is
+ * values[f * segments + s], with fields in StatisticsResult::to_array
+ * order (sum, mean, median, ..., count).
+ */
+struct SegmentedStats {
+    size_t segments = 0;
+    std::vector<double> values;
+
+    /**
+     * Column of one field across all segments.
+     */
+    const double* field(size_t f) const { return values.data() + f * segments; }
+
+    /**
+     * One segment's fields gathered back into a StatisticsResult.
+     */
+    StatisticsResult at(size_t s) const;
+
+    /**
+     * [{"sum":..,...,"count":..},...]: one StatisticsResult per segment.
+     */
+    std::string to_json() const;
+    void write_json(JsonWriter& out) const;
+};
+
+/**
+ * Statistics for each segment [offsets[s], offsets[s + 1]) of amounts,
+ * s < offset_count - 1. Empty segments produce all-zero fields.
+ *
+ * @param pool Pool to run on; nullptr for ThreadPool::shared()
+ * @throws std::invalid_argument if offsets are decreasing or exceed n
+ */
+SegmentedStats calculate_segmented(const double* amounts, size_t n,
+                                   const size_t* offsets, size_t offset_count,
+                                   ThreadPool* pool = nullptr);
+SegmentedStats calculate_segmented(const std::vector<double>& amounts,
+                                   const std::vector<size_t>& offsets,
+                                   ThreadPool* pool = nullptr);
+
+/**
+ * Same, writing the field-major values straight into out, which must
+ * hold StatisticsResult::FIELD_COUNT * (offset_count - 1) doubles (for
+ * FFI callers that own the output array).
+ */
+void calculate_segmented_into(const double* amounts, size_t n,
+                              const size_t* offsets, size_t offset_count,
+                              double* out, ThreadPool* pool = nullptr);
+
+} // namespace expense
+
+#endif // EXPENSE_SEGMENTED_STATS_HPP
@@ -0,0 +1,135 @@
+/**
+ * SIMD Reduction Kernels Header
+ * 
+ * Vectorized sum, sum of squared deviations, min/max, dot product and
+ * co-moments with SSE2 / AVX2 / AVX-512 variants selected at runtime
+ * via CPUID, plus the compensated and binned sums behind the summation
+ * policies in summation.hpp.
+ * 
+ * Interview Talking Points:
+ * - Runtime CPU dispatch through a function-pointer table
+ * - Per-ISA translation units compiled with their own target flags
+ * - Fixed 16-lane accumulation order, so every ISA returns
+ *   bit-identical results (same numbers on every machine)
+ * 
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#ifndef EXPENSE_SIMD_KERNELS_HPP
+#define EXPENSE_SIMD_KERNELS_HPP
+
+#include <cstddef>
+
+namespace expense {
+namespace kernels {
+
+/**
+ * Instruction set variants, in increasing order of capability.
+ */
+enum class Isa {
+    Scalar,
+    SSE2,
+    AVX2,
+    AVX512
+};
+
+/**
+ * Bins (folds) per binned sum; see summation::Binned.
+ */
+constexpr size_t BINNED_FOLDS = 3;
+
+/**
+ * Function table for one instruction set.
+ * 
+ * All reductions accumulate into 16 logical lanes (element i goes to
+ * lane i % 16) and combine the lanes with a fixed pairwise tree.
+ * Callers must pass n > 0 to min_max.
+ */
+struct KernelTable {
+    double (*sum)(const double* data, size_t n);
+    double (*sum_sq_dev)(const double* data, size_t n, double center);
+    void (*min_max)(const double* data, size_t n, double* out_min, double* out_max);
+    double (*dot)(const double* x, const double* y, size_t n);
+    void (*co_moments)(const double* x, const double* y, size_t n,
+                       double mean_x, double mean_y,
+                       double* out_sxx, double* out_syy, double* out_sxy);
+    double (*compensated_sum)(const double* data, size_t n);
+    double (*compensated_sum_sq_dev)(const double* data, size_t n, double center);
+    void (*binned_sum)(const double* data, size_t n, const double* sigma, double* out_bins);
+    void (*binned_sum_sq_dev)(const double* data, size_t n, double center,
+                              const double* sigma, double* out_bins);
+};
+
+/**
+ * Best instruction set supported by this CPU and OS (CPUID + XGETBV).
+ */
+Isa detect_isa();
+
+/**
+ * Whether the given variant is compiled in and runnable here.
+ */
+bool isa_supported(Isa isa);
+
+/**
+ * Kernel table for a specific variant.
+ * 
+ * @throws std::invalid_argument if the variant is not supported
+ */
+const KernelTable& table(Isa isa);
+
+/**
+ * Kernel table for detect_isa(), resolved once.
+ */
+const KernelTable& active();
+
+/**
+ * Human-readable variant name ("scalar", "sse2", "avx2", "avx512").
+ */
+const char* isa_name(Isa isa);
+
+// ==================== Dispatching Wrappers ====================
+
+inline double sum(const double* data, size_t n) {
+    return active().sum(data, n);
+}
+
+inline double sum_sq_dev(const double* data, size_t n, double center) {
+    return active().sum_sq_dev(data, n, center);
+}
+
+inline void min_max(const double* data, size_t n, double* out_min, double* out_max) {
+    active().min_max(data, n, out_min, out_max);
+}
+
+inline double dot(const double* x, const double* y, size_t n) {
+    return active().dot(x, y, n);
+}
+
+inline void co_moments(const double* x, const double* y, size_t n,
+                       double mean_x, double mean_y,
+                       double* out_sxx, double* out_syy, double* out_sxy) {
+    active().co_moments(x, y, n, mean_x, mean_y, out_sxx, out_syy, out_sxy);
+}
+
+inline double compensated_sum(const double* data, size_t n) {
+    return active().compensated_sum(data, n);
+}
+
+inline double compensated_sum_sq_dev(const double* data, size_t n, double center) {
+    return active().compensated_sum_sq_dev(data, n, center);
+}
+
+inline void binned_sum(const double* data, size_t n, const double* sigma, double* out_bins) {
+    active().binned_sum(data, n, sigma, out_bins);
+}
+
+inline void binned_sum_sq_dev(const double* data, size_t n, double center,
+                              const double* sigma, double* out_bins) {
+    active().binned_sum_sq_dev(data, n, center, sigma, out_bins);
+}
+
+} // namespace kernels
+} // namespace expense
+
+#endif // EXPENSE_SIMD_KERNELS_HPP
@@ -3,6 +3,10 @@
  * 
  * High-performance statistical calculations for expense analysis.
  * 
+ * sum, mean, variance, stddev and calculate_all also come as templates
+ * over a summation policy (summation.hpp) for callers that need
+ * compensated or reproducible totals.
+ * 
  * Interview Talking Points:
  * - Template metaprogramming for type flexibility
  * - Move semantics for efficient data handling
@@ -22,9 +26,14 @@
 #include <numeric>
 #include <stdexcept>
 #include <map>
+#include "money.hpp"
+#include "summation.hpp"
 
 namespace expense {
 
+class JsonWriter;
+struct ExecutionPolicy;
+
 /**
  * Statistical calculation results structure.
  */
@@ -44,6 +53,14 @@ struct StatisticsResult {
     size_t count = 0;
     
     std::string to_json() const;
+    void write_json(JsonWriter& out) const;
+    
+    /**
+     * Fixed binary layout: the fields above in declaration order, with
+     * count last. Must match com.tracker.jni.StatsLayout.
+     */
+    static constexpr size_t FIELD_COUNT = 13;
+    void to_array(double* out) const;
 };
 
 /**
@@ -55,6 +72,7 @@ struct MovingAverageResult {
     int window_size = 0;
     
     std::string to_json() const;
+    void write_json(JsonWriter& out) const;
 };
 
 /**
@@ -67,6 +85,17 @@ struct CorrelationResult {
     std::string direction;
     
     std::string to_json() const;
+    void write_json(JsonWriter& out) const;
+    
+    /**
+     * Fixed binary layout: pearson_coefficient, r_squared, strength code,
+     * direction code. Codes index STRENGTH_NAMES / DIRECTION_NAMES and
+     * must match com.tracker.jni.StatsLayout.
+     */
+    static constexpr size_t FIELD_COUNT = 4;
+    static const char* const STRENGTH_NAMES[6];
+    static const char* const DIRECTION_NAMES[3];
+    void to_array(double* out) const;
 };
 
 /**
@@ -78,18 +107,49 @@ class StatisticsCalculator {
 public:
     /**
      * Calculate comprehensive statistics for a dataset.
+     * Time Complexity: O(n log n) - one copy, one sort, one fused sweep
+     * 
+     * Median, quartiles, min/max and mode are read from a single sorted
+     * buffer; sum and variance are accumulated in the same sweep.
      * 
      * @param data Vector of expense amounts
      * @return StatisticsResult with all calculated values
      */
     static StatisticsResult calculate_all(const std::vector<double>& data);
     
+    /**
+     * Pointer overload for callers that own the buffer (e.g. a pinned JNI
+     * array); makes the one working copy needed for sorting and no other.
+     */
+    static StatisticsResult calculate_all(const double* data, size_t n);
+    
+    /**
+     * Same as calculate_all, using data itself as the sort buffer (it is
+     * left sorted). For callers that already hold a scratch copy, such as
+     * the segmented batch path.
+     */
+    static StatisticsResult calculate_all_in_place(double* data, size_t n);
+    
+    /**
+     * Calculate comprehensive statistics over exact paise amounts.
+     * Sum, min, max and mode are exact integers; result fields are in
+     * rupees, so to_json() needs no compensating rounding.
+     * Time Complexity: O(n log n)
+     */
+    static StatisticsResult calculate_all(const std::vector<Money>& data);
+    
     /**
      * Calculate the sum of values.
      * Time Complexity: O(n)
      */
     static double sum(const std::vector<double>& data);
     
+    /**
+     * Exact integer sum of paise amounts.
+     * Time Complexity: O(n), vectorized
+     */
+    static Money sum(const std::vector<Money>& data);
+    
     /**
      * Calculate the arithmetic mean.
      * Time Complexity: O(n)
@@ -98,7 +158,7 @@ public:
     
     /**
      * Calculate the median (middle value).
-     * Time Complexity: O(n log n) due to sorting
+     * Time Complexity: O(n) expected via selection
      */
     static double median(std::vector<double> data);
     
@@ -108,6 +168,12 @@ public:
      */
     static double mode(const std::vector<double>& data);
     
+    /**
+     * Most frequent paise amount; ties resolve to the smallest value.
+     * Time Complexity: O(n log n)
+     */
+    static Money mode(const std::vector<Money>& data);
+    
     /**
      * Calculate variance (population variance).
      * Time Complexity: O(n)
@@ -134,13 +200,27 @@ public:
     
     /**
      * Calculate percentile value.
-     * Time Complexity: O(n log n)
+     * Time Complexity: O(n) expected via selection
      * 
      * @param data Input data
      * @param percentile Percentile (0-100)
      */
     static double percentile(std::vector<double> data, double percentile);
     
+    /**
+     * Calculate several percentiles with one copy and one multi-rank
+     * selection pass. Uses the same linear interpolation as percentile().
+     * Time Complexity: O(n log k) expected for k percentiles
+     * 
+     * @param data Input data
+     * @param percentiles Percentiles (0-100), any order
+     * @return Values in the same order as percentiles
+     */
+    static std::vector<double> quantiles(const std::vector<double>& data,
+                                         const std::vector<double>& percentiles);
+    static std::vector<double> quantiles(const double* data, size_t n,
+                                         const std::vector<double>& percentiles);
+    
     /**
      * Calculate simple moving average.
      * Time Complexity: O(n)
@@ -149,6 +229,36 @@ public:
      * @param window Window size
      */
     static MovingAverageResult moving_average(const std::vector<double>& data, int window);
+    static MovingAverageResult moving_average(const double* data, size_t n, int window);
+    
+    /**
+     * Rolling median over a count window; robust to one-off large rows.
+     * Same shape as moving_average (n - window + 1 values, window clamped
+     * to n).
+     * Time Complexity: O(n log n)
+     * 
+     * @param data Input data
+     * @param window Window size
+     */
+    static MovingAverageResult rolling_median(const std::vector<double>& data, int window);
+    static MovingAverageResult rolling_median(const double* data, size_t n, int window);
+    
+    /**
+     * Rolling percentile over a count window, interpolated like
+     * percentile(). Each step updates the window incrementally instead of
+     * sorting it: small windows keep a sorted buffer (binary search plus
+     * a short shift), larger ones an order-statistic multiset (Fenwick
+     * tree over value ranks) with O(log n) insert, erase and k-th.
+     * Time Complexity: O(n log n)
+     * 
+     * @param data Input data
+     * @param window Window size
+     * @param percentile Percentile (0-100)
+     */
+    static MovingAverageResult rolling_quantile(const std::vector<double>& data, int window,
+                                                double percentile);
+    static MovingAverageResult rolling_quantile(const double* data, size_t n, int window,
+                                                double percentile);
     
     /**
      * Calculate exponential moving average.
@@ -158,32 +268,143 @@ public:
      * @param alpha Smoothing factor (0-1)
      */
     static MovingAverageResult exponential_moving_average(const std::vector<double>& data, double alpha);
+    static MovingAverageResult exponential_moving_average(const double* data, size_t n, double alpha);
     
     /**
      * Calculate Pearson correlation coefficient.
      * Time Complexity: O(n)
      */
     static CorrelationResult correlation(const std::vector<double>& x, const std::vector<double>& y);
+    static CorrelationResult correlation(const double* x, const double* y, size_t n);
     
     /**
      * Detect outliers using IQR method.
-     * Time Complexity: O(n log n)
+     * Time Complexity: O(n) expected
      * 
      * @param data Input data
      * @param threshold IQR multiplier (default 1.5)
      * @return Indices of outliers
      */
     static std::vector<size_t> detect_outliers(const std::vector<double>& data, double threshold = 1.5);
+    static std::vector<size_t> detect_outliers(const double* data, size_t n, double threshold = 1.5);
     
     /**
      * Calculate monthly totals from daily data.
      * Time Complexity: O(n)
      * 
+     * Requires a dense per-day array and caller-supplied month lengths;
+     * for dated transactions use resample() (resample.hpp) instead.
+     * 
      * @param amounts Daily amounts
      * @param days_in_months Vector of days in each month
      */
     static std::vector<double> monthly_totals(const std::vector<double>& amounts, 
                                                const std::vector<int>& days_in_months);
+    
+    // ==================== Parallel Overloads ====================
+    // Split the input into ExecutionPolicy chunks on a ThreadPool. Results
+    // are bit-identical for any thread count (see execution.hpp).
+    
+    /**
+     * calculate_all with a parallel sort and a chunked sweep. Order
+     * statistics match the sequential version exactly; sum, mean and
+     * variance agree to rounding.
+     * Time Complexity: O(n log n / threads) plus a final O(n) merge level
+     */
+    static StatisticsResult calculate_all(const ExecutionPolicy& policy, const double* data, size_t n);
+    static StatisticsResult calculate_all(const ExecutionPolicy& policy, const std::vector<double>& data);
+    
+    /**
+     * Sum of per-chunk SIMD sums, added in chunk order.
+     */
+    static double sum(const ExecutionPolicy& policy, const double* data, size_t n);
+    
+    /**
+     * Population variance: parallel mean, then parallel squared deviations.
+     */
+    static double variance(const ExecutionPolicy& policy, const double* data, size_t n);
+    
+    /**
+     * Ascending sort: chunks sorted in parallel, then merged pairwise in
+     * parallel rounds through one scratch buffer.
+     */
+    static void sort(const ExecutionPolicy& policy, double* data, size_t n);
+    
+    /**
+     * Pearson correlation from chunked sums and co-moments.
+     */
+    static CorrelationResult correlation(const ExecutionPolicy& policy,
+                                         const double* x, const double* y, size_t n);
+    
+    /**
+     * IQR outliers: quartiles by (sequential) selection, then a parallel
+     * scan whose per-chunk hits are concatenated in index order.
+     */
+    static std::vector<size_t> detect_outliers(const ExecutionPolicy& policy,
+                                               const double* data, size_t n,
+                                               double threshold = 1.5);
+    
+    // ==================== Summation Policies ====================
+    // sum<summation::Binned>(data, n) and friends; see summation.hpp for
+    // each policy's accuracy and cost.
+    
+    template <typename Summation>
+    static double sum(const double* data, size_t n) {
+        return Summation::sum(data, n);
+    }
+    
+    template <typename Summation>
+    static double sum(const std::vector<double>& data) {
+        return Summation::sum(data.data(), data.size());
+    }
+    
+    template <typename Summation>
+    static double mean(const std::vector<double>& data) {
+        if (data.empty()) return 0.0;
+        return sum<Summation>(data) / static_cast<double>(data.size());
+    }
+    
+    /**
+     * Population variance: policy mean, then policy sum of squared
+     * deviations from it.
+     */
+    template <typename Summation>
+    static double variance(const double* data, size_t n) {
+        if (n < 2) return 0.0;
+        double m = Summation::sum(data, n) / static_cast<double>(n);
+        return Summation::sum_sq_dev(data, n, m) / static_cast<double>(n);
+    }
+    
+    template <typename Summation>
+    static double variance(const std::vector<double>& data) {
+        return variance<Summation>(data.data(), data.size());
+    }
+    
+    template <typename Summation>
+    static double stddev(const std::vector<double>& data) {
+        return std::sqrt(variance<Summation>(data));
+    }
+    
+    /**
+     * calculate_all with sum, mean, variance and stddev recomputed under
+     * the policy (two more passes over data); order statistics unchanged.
+     */
+    template <typename Summation>
+    static StatisticsResult calculate_all(const double* data, size_t n) {
+        StatisticsResult result = calculate_all(data, n);
+        if (n == 0) return result;
+        result.sum = Summation::sum(data, n);
+        result.mean = result.sum / static_cast<double>(n);
+        result.variance = n < 2 ? 0.0
+            : Summation::sum_sq_dev(data, n, result.mean) / static_cast<double>(n);
+        result.stddev = std::sqrt(result.variance);
+        return result;
+    }
+    
+    template <typename Summation>
+    static StatisticsResult calculate_all(const std::vector<double>& data) {
+        return calculate_all<Summation>(data.data(), data.size());
+    }
 };
 
 } // namespace expense
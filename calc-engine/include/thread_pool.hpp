@@ -0,0 +1,131 @@
+/**
+ * Thread Pool Header
+ *
+ * Persistent work-stealing pool for data-parallel loops. parallel_for
+ * splits an index range into blocks, deals them out to per-worker deques
+ * and lets idle workers steal from the back of busy workers' deques, so
+ * uneven work (one user with 50,000 expenses next to many with 10)
+ * still keeps every thread busy. The calling thread works as worker 0.
+ *
+ * Tasks write their results by index, so output never depends on which
+ * thread ran a task. Workers can be pinned to CPUs (Linux) so a batch
+ * job does not migrate between cores or sockets mid-run.
+ *
+ * Interview Talking Points:
+ * - Work stealing: owners walk their blocks in order, thieves take the
+ *   far end, so both sides stay on contiguous memory
+ * - Persistent workers instead of a thread per call
+ * - Exceptions captured on workers and rethrown on the caller
+ *
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#ifndef EXPENSE_THREAD_POOL_HPP
+#define EXPENSE_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace expense {
+
+struct ThreadPoolOptions {
+    unsigned threads = 0;           // including the caller; 0 = hardware concurrency
+    
+    /**
+     * Pin worker t (t >= 1; the caller is never pinned) to CPU
+     * cpus[t % cpus.size()], or to CPU t when cpus is empty. Best effort:
+     * ignored where unsupported or refused by the OS.
+     */
+    bool pin_threads = false;
+    std::vector<unsigned> cpus;
+};
+
+class ThreadPool {
+public:
+    /**
+     * @param threads Total threads including the caller; 0 = hardware concurrency
+     */
+    explicit ThreadPool(unsigned threads = 0);
+    explicit ThreadPool(const ThreadPoolOptions& options);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Threads that take part in parallel_for, including the caller.
+     */
+    unsigned size() const { return static_cast<unsigned>(queues_.size()); }
+
+    /**
+     * Call fn(i) for every i in [0, count) and wait for all of them.
+     * Indices are grouped into blocks of at least `grain`. Calls from
+     * inside a task run inline. The first exception thrown by fn is
+     * rethrown here once every block has finished.
+     */
+    void parallel_for(size_t count, const std::function<void(size_t)>& fn, size_t grain = 1);
+
+    /**
+     * Workers successfully pinned to a CPU.
+     */
+    unsigned pinned() const { return pinned_; }
+
+    /**
+     * Process-wide pool, created on first use (sized to the hardware
+     * unless configure_shared() ran first).
+     */
+    static ThreadPool& shared();
+
+    /**
+     * Options for the shared pool (e.g. from --threads).
+     * @return false if the shared pool already exists and was left as is
+     */
+    static bool configure_shared(const ThreadPoolOptions& options);
+
+private:
+    struct Block {
+        size_t begin;
+        size_t end;
+    };
+
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Block> blocks;
+    };
+
+    void start(const ThreadPoolOptions& options);
+    void worker_loop(size_t self);
+    void run_blocks(size_t self);
+    bool pop_or_steal(size_t self, Block& block);
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> workers_;
+    unsigned pinned_ = 0;
+
+    std::mutex submit_mutex_;              // one parallel_for at a time
+
+    std::mutex state_mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    uint64_t generation_ = 0;
+    bool stopping_ = false;
+
+    const std::function<void(size_t)>* job_ = nullptr;
+    std::atomic<size_t> pending_{0};       // blocks not yet finished
+    std::atomic<bool> failed_{false};
+    std::exception_ptr error_;
+};
+
+} // namespace expense
+
+#endif // EXPENSE_THREAD_POOL_HPP
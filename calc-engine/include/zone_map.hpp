@@ -0,0 +1,145 @@
+/**
+ * Zone Map Header
+ *
+ * Block-level min/max/sum index over an ExpenseTable for the dashboard's
+ * date-range queries (ExpenseRepository.getSpendingInRange and
+ * findByUserAndExpenseDateBetween):
+ *
+ *   ZoneMap zones(table);                         // table sorted by date
+ *   RangeTotal q1 = zones.total(parse_iso_date("2024-01-01"),
+ *                               parse_iso_date("2024-03-31"));
+ *
+ * Rows are grouped into zones of ZONE_ROWS consecutive rows; each zone
+ * records its date and amount range, row count and exact total. A query
+ * skips zones that cannot match, takes the stored total of zones that
+ * match entirely and scans only the rest. On a date-sorted table the
+ * overlapping zones are found by binary search and the fully covered
+ * ones are totalled from a prefix sum, so a date-range total costs
+ * O(log zones + 2 * ZONE_ROWS) however long the history is. Unsorted
+ * tables still benefit from pruning but visit every zone's footer.
+ *
+ * Totals are exact Money (amounts rounded to whole paise, like the
+ * DECIMAL(12,2) column), so they do not depend on how a range splits
+ * into zones.
+ *
+ * Interview Talking Points:
+ * - Zone maps / block range indexes (Oracle, Redshift, Parquet stats)
+ * - Predicate pushdown: prune on metadata before touching rows
+ * - Prefix sums over block totals for O(1) interior ranges
+ *
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#ifndef EXPENSE_ZONE_MAP_HPP
+#define EXPENSE_ZONE_MAP_HPP
+
+#include "expense_table.hpp"
+#include "money.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace expense {
+
+/**
+ * Default rows per zone: 8 KB of amounts and 4 KB of dates, so a
+ * boundary scan stays in L1.
+ */
+constexpr size_t ZONE_ROWS = 1024;
+
+/**
+ * Conjunctive predicate; both ranges are inclusive, as in SQL BETWEEN.
+ * Amount bounds are rounded to whole paise, like the amounts. The
+ * defaults match every row.
+ */
+struct RangeQuery {
+    int32_t date_from = std::numeric_limits<int32_t>::min();
+    int32_t date_to = std::numeric_limits<int32_t>::max();
+    double amount_min = -std::numeric_limits<double>::infinity();
+    double amount_max = std::numeric_limits<double>::infinity();
+};
+
+/**
+ * Query answer plus how each zone was handled.
+ */
+struct RangeTotal {
+    Money total;
+    size_t count = 0;
+    size_t zones_skipped = 0;    // disjoint from the predicate
+    size_t zones_summed = 0;     // answered from the zone total
+    size_t zones_scanned = 0;    // partially matching, rows checked
+};
+
+/**
+ * Stored statistics of one zone (amounts in paise).
+ */
+struct Zone {
+    int32_t date_min = 0;
+    int32_t date_max = 0;
+    int64_t amount_min = 0;
+    int64_t amount_max = 0;
+    int64_t sum = 0;
+};
+
+class ZoneMap {
+public:
+    /**
+     * Build the zones over table's date and amount columns. The map
+     * reads the table's columns, so any append or reorder of the table
+     * invalidates it (as with ColumnView). Amounts must be finite.
+     *
+     * @throws std::invalid_argument if zone_rows is 0
+     * Time Complexity: O(n)
+     */
+    explicit ZoneMap(const ExpenseTable& table, size_t zone_rows = ZONE_ROWS);
+
+    /**
+     * Total and count of rows matching query.
+     * Time Complexity: O(log zones + zone_rows) for a date range on a
+     * sorted table; otherwise O(zones + zone_rows * partial zones)
+     */
+    RangeTotal total(const RangeQuery& query) const;
+
+    /**
+     * Total of rows with date_from <= date <= date_to.
+     */
+    RangeTotal total(int32_t date_from, int32_t date_to) const;
+
+    /**
+     * Indices of rows matching query, ascending.
+     * Time Complexity: as total(), plus O(result)
+     */
+    std::vector<size_t> select(const RangeQuery& query) const;
+
+    size_t zone_rows() const { return zone_rows_; }
+    const std::vector<Zone>& zones() const { return zones_; }
+    bool sorted_by_date() const { return sorted_; }
+
+private:
+    enum class Overlap { None, Partial, Full };
+
+    /**
+     * lo / hi: the query's amount bounds in paise.
+     */
+    Overlap classify(const Zone& zone, const RangeQuery& query, int64_t lo, int64_t hi) const;
+    size_t zone_begin(size_t z) const { return z * zone_rows_; }
+    size_t zone_end(size_t z) const;
+
+    /**
+     * Zones [first, last) that can overlap the query's date range.
+     */
+    void candidate_zones(const RangeQuery& query, size_t* first, size_t* last) const;
+
+    ColumnView<double> amounts_;
+    ColumnView<int32_t> dates_;
+    size_t zone_rows_;
+    bool sorted_;
+    std::vector<Zone> zones_;
+    std::vector<int64_t> prefix_;    // prefix_[z] = sum of zones [0, z), paise
+};
+
+} // namespace expense
+
+#endif // EXPENSE_ZONE_MAP_HPP
@@ -9,14 +9,95 @@
  * - JNI for native code integration
  * - Memory management across language boundaries
  * - Performance optimization with native code
+ * - Zero-copy access: arrays are pinned with GetPrimitiveArrayCritical
+ *   and released with JNI_ABORT (read-only, nothing copied back)
+ * - *Into variants fill a caller-provided double[] with a fixed layout
+ *   (see com.tracker.jni.StatsLayout) instead of building JSON
+ * - Segmented batch call: thousands of users per JNI transition
  */
 
 #include <jni.h>
 #include "statistics.hpp"
+#include "group_by.hpp"
+#include "rolling_engine.hpp"
+#include "segmented_stats.hpp"
+#include "json_writer.hpp"
 #include <string>
+#include <vector>
 
 using namespace expense;
 
+namespace {
+
+const char* const ARRAY_ERROR_JSON =
+    "{\"success\":false,\"error\":\"Failed to get array elements\"}";
+
+/**
+ * Read-only pinned view of a Java primitive array.
+ * 
+ * No JNI calls may be made while a view is held, so callers compute
+ * inside a scope and build Java results after it ends. That includes
+ * GetArrayLength: when pinning several arrays, read every length first
+ * and use the (env, array, length) constructor.
+ */
+template <typename Element, typename Array>
+class PinnedArray {
+public:
+    /**
+     * Pin a single array (its length is read before pinning).
+     */
+    PinnedArray(JNIEnv* env, Array array)
+        : PinnedArray(env, array, array != nullptr ? env->GetArrayLength(array) : 0) {}
+    
+    /**
+     * Pin an array whose length the caller read before any pin was taken.
+     */
+    PinnedArray(JNIEnv* env, Array array, jsize length)
+        : env_(env), array_(array) {
+        if (array_ != nullptr) {
+            size_ = static_cast<size_t>(length);
+            data_ = static_cast<const Element*>(env_->GetPrimitiveArrayCritical(array_, nullptr));
+        }
+    }
+    
+    ~PinnedArray() {
+        if (data_ != nullptr) {
+            env_->ReleasePrimitiveArrayCritical(array_, const_cast<Element*>(data_), JNI_ABORT);
+        }
+    }
+    
+    PinnedArray(const PinnedArray&) = delete;
+    PinnedArray& operator=(const PinnedArray&) = delete;
+    
+    const Element* data() const { return data_; }
+    size_t size() const { return size_; }
+    bool ok() const { return data_ != nullptr; }
+
+private:
+    JNIEnv* env_;
+    Array array_;
+    const Element* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+using PinnedDoubles = PinnedArray<jdouble, jdoubleArray>;
+using PinnedBytes = PinnedArray<jbyte, jbyteArray>;
+
+/**
+ * Address of a direct DoubleBuffer, validated against the requested count.
+ */
+double* direct_doubles(JNIEnv* env, jobject buffer, jint count) {
+    if (buffer == nullptr || count < 0) return nullptr;
+    
+    void* address = env->GetDirectBufferAddress(buffer);
+    jlong capacity = env->GetDirectBufferCapacity(buffer);
+    
+    if (address == nullptr || capacity < count) return nullptr;
+    return static_cast<double*>(address);
+}
+
+} // namespace
+
 extern "C" {
 
 /**
@@ -27,90 +108,178 @@ extern "C" {
  * @param amounts Java double array with expense amounts
  * @return JSON string with statistics
  */
-JNIEXPORT jstring JNICALL Java_com_tracker_native_StatsBridge_calculateStats(
+JNIEXPORT jstring JNICALL Java_com_tracker_jni_StatsBridge_calculateStats(
     JNIEnv *env, jobject obj, jdoubleArray amounts) {
     
-    // Get array elements
-    jsize len = env->GetArrayLength(amounts);
-    jdouble* body = env->GetDoubleArrayElements(amounts, nullptr);
+    StatisticsResult stats;
+    {
+        PinnedDoubles data(env, amounts);
+        if (!data.ok()) {
+            return env->NewStringUTF(ARRAY_ERROR_JSON);
+        }
+        stats = StatisticsCalculator::calculate_all(data.data(), data.size());
+    }
     
-    if (body == nullptr) {
-        return env->NewStringUTF("{\"success\":false,\"error\":\"Failed to get array elements\"}");
+    return env->NewStringUTF(stats.to_json().c_str());
+}
+
+/**
+ * Calculate comprehensive statistics from a direct DoubleBuffer.
+ * The buffer must use native byte order; values [0, count) are read.
+ */
+JNIEXPORT jstring JNICALL Java_com_tracker_jni_StatsBridge_calculateStatsDirect(
+    JNIEnv *env, jobject obj, jobject amounts, jint count) {
+    
+    const double* data = direct_doubles(env, amounts, count);
+    if (data == nullptr) {
+        return env->NewStringUTF("{\"success\":false,\"error\":\"Invalid direct buffer\"}");
     }
     
-    // Convert to vector
-    std::vector<double> data(body, body + len);
+    StatisticsResult stats = StatisticsCalculator::calculate_all(data, static_cast<size_t>(count));
     
-    // Release array elements
-    env->ReleaseDoubleArrayElements(amounts, body, 0);
+    return env->NewStringUTF(stats.to_json().c_str());
+}
+
+/**
+ * Calculate comprehensive statistics from exact paise amounts.
+ * 
+ * @param amounts Java long array with expense amounts in paise
+ * @return JSON string with statistics
+ */
+JNIEXPORT jstring JNICALL Java_com_tracker_jni_StatsBridge_calculateStatsExact(
+    JNIEnv *env, jobject obj, jlongArray amounts) {
+    
+    if (amounts == nullptr) {
+        return env->NewStringUTF(ARRAY_ERROR_JSON);
+    }
+    jsize len = env->GetArrayLength(amounts);
+    
+    // Money is a bare int64, so the region copies straight into the vector.
+    std::vector<Money> data(len);
+    env->GetLongArrayRegion(amounts, 0, len, reinterpret_cast<jlong*>(data.data()));
     
-    // Calculate statistics
     StatisticsResult stats = StatisticsCalculator::calculate_all(data);
     
-    // Return JSON string
     return env->NewStringUTF(stats.to_json().c_str());
 }
 
 /**
  * Calculate moving average from a Java double array.
  */
-JNIEXPORT jstring JNICALL Java_com_tracker_native_StatsBridge_calculateMovingAverage(
+JNIEXPORT jstring JNICALL Java_com_tracker_jni_StatsBridge_calculateMovingAverage(
     JNIEnv *env, jobject obj, jdoubleArray amounts, jint window) {
     
-    jsize len = env->GetArrayLength(amounts);
-    jdouble* body = env->GetDoubleArrayElements(amounts, nullptr);
-    
-    if (body == nullptr) {
-        return env->NewStringUTF("{\"success\":false,\"error\":\"Failed to get array elements\"}");
+    MovingAverageResult result;
+    {
+        PinnedDoubles data(env, amounts);
+        if (!data.ok()) {
+            return env->NewStringUTF(ARRAY_ERROR_JSON);
+        }
+        result = StatisticsCalculator::moving_average(data.data(), data.size(), window);
     }
     
-    std::vector<double> data(body, body + len);
-    env->ReleaseDoubleArrayElements(amounts, body, 0);
-    
-    MovingAverageResult result = StatisticsCalculator::moving_average(data, window);
-    
     return env->NewStringUTF(result.to_json().c_str());
 }
 
 /**
  * Calculate exponential moving average.
  */
-JNIEXPORT jstring JNICALL Java_com_tracker_native_StatsBridge_calculateEMA(
+JNIEXPORT jstring JNICALL Java_com_tracker_jni_StatsBridge_calculateEMA(
     JNIEnv *env, jobject obj, jdoubleArray amounts, jdouble alpha) {
     
-    jsize len = env->GetArrayLength(amounts);
-    jdouble* body = env->GetDoubleArrayElements(amounts, nullptr);
+    MovingAverageResult result;
+    {
+        PinnedDoubles data(env, amounts);
+        if (!data.ok()) {
+            return env->NewStringUTF(ARRAY_ERROR_JSON);
+        }
+        result = StatisticsCalculator::exponential_moving_average(data.data(), data.size(), alpha);
+    }
+    
+    return env->NewStringUTF(result.to_json().c_str());
+}
+
+/**
+ * Calculate a rolling percentile (50 for the rolling median).
+ * 
+ * @return JSON string with the same shape as calculateMovingAverage
+ */
+JNIEXPORT jstring JNICALL Java_com_tracker_jni_StatsBridge_calculateRollingQuantile(
+    JNIEnv *env, jobject obj, jdoubleArray amounts, jint window, jdouble percentile) {
+    
+    if (percentile < 0 || percentile > 100) {
+        return env->NewStringUTF("{\"success\":false,\"error\":\"Percentile must be between 0 and 100\"}");
+    }
     
-    if (body == nullptr) {
-        return env->NewStringUTF("{\"success\":false,\"error\":\"Failed to get array elements\"}");
+    MovingAverageResult result;
+    {
+        PinnedDoubles data(env, amounts);
+        if (!data.ok()) {
+            return env->NewStringUTF(ARRAY_ERROR_JSON);
+        }
+        result = StatisticsCalculator::rolling_quantile(data.data(), data.size(), window, percentile);
     }
     
-    std::vector<double> data(body, body + len);
-    env->ReleaseDoubleArrayElements(amounts, body, 0);
+    return env->NewStringUTF(result.to_json().c_str());
+}
+
+/**
+ * Rolling mean, stddev, min and max for every window size, computed in
+ * one sweep (see RollingEngine).
+ * 
+ * @return JSON array of {"window_size","stat","values"} series
+ */
+JNIEXPORT jstring JNICALL Java_com_tracker_jni_StatsBridge_calculateRolling(
+    JNIEnv *env, jobject obj, jdoubleArray amounts, jintArray windows) {
     
-    MovingAverageResult result = StatisticsCalculator::exponential_moving_average(data, alpha);
+    RollingResult result;
+    std::string error;
+    try {
+        // Window list is tiny; copy it rather than pin
+        jsize window_count = windows ? env->GetArrayLength(windows) : 0;
+        std::vector<jint> sizes(static_cast<size_t>(window_count));
+        if (window_count > 0) {
+            env->GetIntArrayRegion(windows, 0, window_count, sizes.data());
+        }
+        
+        RollingEngine engine;
+        for (jint w : sizes) {
+            engine.add(w, {RollingStat::Mean, RollingStat::Stddev, RollingStat::Min, RollingStat::Max});
+        }
+        
+        PinnedDoubles data(env, amounts);
+        if (!data.ok()) {
+            error = "Failed to get array elements";
+        } else {
+            result = engine.run(data.data(), data.size());
+        }
+    } catch (const std::exception& e) {
+        error = e.what();
+    }
     
+    if (!error.empty()) {
+        JsonWriter json;
+        json.raw("{\"success\":false,\"error\":").string(error).raw('}');
+        return env->NewStringUTF(json.str().c_str());
+    }
     return env->NewStringUTF(result.to_json().c_str());
 }
 
 /**
  * Detect outliers in expense data.
  */
-JNIEXPORT jintArray JNICALL Java_com_tracker_native_StatsBridge_detectOutliers(
+JNIEXPORT jintArray JNICALL Java_com_tracker_jni_StatsBridge_detectOutliers(
     JNIEnv *env, jobject obj, jdoubleArray amounts, jdouble threshold) {
     
-    jsize len = env->GetArrayLength(amounts);
-    jdouble* body = env->GetDoubleArrayElements(amounts, nullptr);
-    
-    if (body == nullptr) {
-        return env->NewIntArray(0);
+    std::vector<size_t> outliers;
+    {
+        PinnedDoubles data(env, amounts);
+        if (!data.ok()) {
+            return env->NewIntArray(0);
+        }
+        outliers = StatisticsCalculator::detect_outliers(data.data(), data.size(), threshold);
     }
     
-    std::vector<double> data(body, body + len);
-    env->ReleaseDoubleArrayElements(amounts, body, 0);
-    
-    std::vector<size_t> outliers = StatisticsCalculator::detect_outliers(data, threshold);
-    
     // Convert to jintArray
     jintArray result = env->NewIntArray(static_cast<jsize>(outliers.size()));
     if (result != nullptr && !outliers.empty()) {
@@ -124,34 +293,355 @@ JNIEXPORT jintArray JNICALL Java_com_tracker_native_StatsBridge_detectOutliers(
 /**
  * Calculate correlation between two datasets.
  */
-JNIEXPORT jstring JNICALL Java_com_tracker_native_StatsBridge_calculateCorrelation(
+JNIEXPORT jstring JNICALL Java_com_tracker_jni_StatsBridge_calculateCorrelation(
     JNIEnv *env, jobject obj, jdoubleArray x_arr, jdoubleArray y_arr) {
     
-    jsize len_x = env->GetArrayLength(x_arr);
-    jsize len_y = env->GetArrayLength(y_arr);
-    
-    if (len_x != len_y) {
+    if (x_arr == nullptr || y_arr == nullptr) {
         return env->NewStringUTF("{\"success\":false,\"error\":\"Arrays must have same length\"}");
     }
+    const jsize length = env->GetArrayLength(x_arr);
+    if (env->GetArrayLength(y_arr) != length) {
+        return env->NewStringUTF("{\"success\":false,\"error\":\"Arrays must have same length\"}");
+    }
+    
+    CorrelationResult result;
+    bool pinned = false;
+    {
+        // Nested Get/ReleasePrimitiveArrayCritical pairs are permitted, but
+        // no other JNI call: the length was read above, and both pins are
+        // released before the error string below is created.
+        PinnedDoubles x(env, x_arr, length);
+        PinnedDoubles y(env, y_arr, length);
+        pinned = x.ok() && y.ok();
+        if (pinned) {
+            result = StatisticsCalculator::correlation(x.data(), y.data(), x.size());
+        }
+    }
+    
+    if (!pinned) {
+        return env->NewStringUTF(ARRAY_ERROR_JSON);
+    }
+    
+    return env->NewStringUTF(result.to_json().c_str());
+}
+
+// ==================== Binary Result Entry Points ====================
+
+/**
+ * Fill out[0, StatisticsResult::FIELD_COUNT) with statistics.
+ * 
+ * @return false if an array is unavailable or out is too small
+ */
+JNIEXPORT jboolean JNICALL Java_com_tracker_jni_StatsBridge_calculateStatsInto(
+    JNIEnv *env, jobject obj, jdoubleArray amounts, jdoubleArray out) {
+    
+    if (out == nullptr ||
+        env->GetArrayLength(out) < static_cast<jsize>(StatisticsResult::FIELD_COUNT)) {
+        return JNI_FALSE;
+    }
+    
+    double fields[StatisticsResult::FIELD_COUNT];
+    {
+        PinnedDoubles data(env, amounts);
+        if (!data.ok()) {
+            return JNI_FALSE;
+        }
+        StatisticsCalculator::calculate_all(data.data(), data.size()).to_array(fields);
+    }
     
-    jdouble* x_body = env->GetDoubleArrayElements(x_arr, nullptr);
-    jdouble* y_body = env->GetDoubleArrayElements(y_arr, nullptr);
+    env->SetDoubleArrayRegion(out, 0, static_cast<jsize>(StatisticsResult::FIELD_COUNT), fields);
+    return JNI_TRUE;
+}
+
+/**
+ * Direct-buffer variant: reads amounts[0, count) and writes the
+ * statistics layout into out, both in place.
+ */
+JNIEXPORT jboolean JNICALL Java_com_tracker_jni_StatsBridge_calculateStatsDirectInto(
+    JNIEnv *env, jobject obj, jobject amounts, jint count, jobject out) {
+    
+    const double* data = direct_doubles(env, amounts, count);
+    double* fields = direct_doubles(env, out, static_cast<jint>(StatisticsResult::FIELD_COUNT));
+    if (data == nullptr || fields == nullptr) {
+        return JNI_FALSE;
+    }
+    
+    StatisticsCalculator::calculate_all(data, static_cast<size_t>(count)).to_array(fields);
+    return JNI_TRUE;
+}
+
+/**
+ * Write moving-average values into out.
+ * 
+ * @return Number of values written, or -(required length) if out is too
+ *         small (nothing is written), or 0 if amounts is unavailable
+ */
+JNIEXPORT jint JNICALL Java_com_tracker_jni_StatsBridge_calculateMovingAverageInto(
+    JNIEnv *env, jobject obj, jdoubleArray amounts, jint window, jdoubleArray out) {
+    
+    MovingAverageResult result;
+    {
+        PinnedDoubles data(env, amounts);
+        if (!data.ok()) {
+            return 0;
+        }
+        result = StatisticsCalculator::moving_average(data.data(), data.size(), window);
+    }
+    
+    jsize produced = static_cast<jsize>(result.values.size());
+    if (out == nullptr || env->GetArrayLength(out) < produced) {
+        return -produced;
+    }
+    env->SetDoubleArrayRegion(out, 0, produced, result.values.data());
+    return produced;
+}
+
+/**
+ * Write EMA values into out; same return contract as
+ * calculateMovingAverageInto.
+ */
+JNIEXPORT jint JNICALL Java_com_tracker_jni_StatsBridge_calculateEMAInto(
+    JNIEnv *env, jobject obj, jdoubleArray amounts, jdouble alpha, jdoubleArray out) {
+    
+    MovingAverageResult result;
+    {
+        PinnedDoubles data(env, amounts);
+        if (!data.ok()) {
+            return 0;
+        }
+        result = StatisticsCalculator::exponential_moving_average(data.data(), data.size(), alpha);
+    }
+    
+    jsize produced = static_cast<jsize>(result.values.size());
+    if (out == nullptr || env->GetArrayLength(out) < produced) {
+        return -produced;
+    }
+    env->SetDoubleArrayRegion(out, 0, produced, result.values.data());
+    return produced;
+}
+
+/**
+ * Write rolling percentile values into out; same return contract as
+ * calculateMovingAverageInto (0 also for a percentile outside 0-100).
+ */
+JNIEXPORT jint JNICALL Java_com_tracker_jni_StatsBridge_calculateRollingQuantileInto(
+    JNIEnv *env, jobject obj, jdoubleArray amounts, jint window, jdouble percentile,
+    jdoubleArray out) {
+    
+    if (percentile < 0 || percentile > 100) {
+        return 0;
+    }
+    
+    MovingAverageResult result;
+    {
+        PinnedDoubles data(env, amounts);
+        if (!data.ok()) {
+            return 0;
+        }
+        result = StatisticsCalculator::rolling_quantile(data.data(), data.size(), window, percentile);
+    }
+    
+    jsize produced = static_cast<jsize>(result.values.size());
+    if (out == nullptr || env->GetArrayLength(out) < produced) {
+        return -produced;
+    }
+    env->SetDoubleArrayRegion(out, 0, produced, result.values.data());
+    return produced;
+}
+
+/**
+ * Fill out[0, CorrelationResult::FIELD_COUNT) with the correlation layout.
+ * 
+ * @return false if the arrays differ in length, are unavailable, or out
+ *         is too small
+ */
+JNIEXPORT jboolean JNICALL Java_com_tracker_jni_StatsBridge_calculateCorrelationInto(
+    JNIEnv *env, jobject obj, jdoubleArray x_arr, jdoubleArray y_arr, jdoubleArray out) {
+    
+    if (x_arr == nullptr || y_arr == nullptr || out == nullptr) {
+        return JNI_FALSE;
+    }
+    const jsize length = env->GetArrayLength(x_arr);
+    if (env->GetArrayLength(y_arr) != length ||
+        env->GetArrayLength(out) < static_cast<jsize>(CorrelationResult::FIELD_COUNT)) {
+        return JNI_FALSE;
+    }
+    
+    double fields[CorrelationResult::FIELD_COUNT];
+    bool pinned = false;
+    {
+        // Lengths read above: no JNI call between the two pins
+        PinnedDoubles x(env, x_arr, length);
+        PinnedDoubles y(env, y_arr, length);
+        pinned = x.ok() && y.ok();
+        if (pinned) {
+            StatisticsCalculator::correlation(x.data(), y.data(), x.size()).to_array(fields);
+        }
+    }
     
-    if (x_body == nullptr || y_body == nullptr) {
-        if (x_body) env->ReleaseDoubleArrayElements(x_arr, x_body, 0);
-        if (y_body) env->ReleaseDoubleArrayElements(y_arr, y_body, 0);
-        return env->NewStringUTF("{\"success\":false,\"error\":\"Failed to get array elements\"}");
+    if (!pinned) {
+        return JNI_FALSE;
     }
     
-    std::vector<double> x(x_body, x_body + len_x);
-    std::vector<double> y(y_body, y_body + len_y);
+    env->SetDoubleArrayRegion(out, 0, static_cast<jsize>(CorrelationResult::FIELD_COUNT), fields);
+    return JNI_TRUE;
+}
+
+// ==================== Category Breakdown ====================
+
+/**
+ * Per-category breakdown of amounts[i] by categories[i] (Category
+ * ordinals), with variance and p50/p90 per category.
+ * 
+ * @return JSON string with the breakdown
+ */
+JNIEXPORT jstring JNICALL Java_com_tracker_jni_StatsBridge_calculateCategoryBreakdown(
+    JNIEnv *env, jobject obj, jdoubleArray amounts, jbyteArray categories) {
     
-    env->ReleaseDoubleArrayElements(x_arr, x_body, 0);
-    env->ReleaseDoubleArrayElements(y_arr, y_body, 0);
+    GroupByOptions options;
+    options.variance = true;
+    options.percentiles = {50, 90};
     
-    CorrelationResult result = StatisticsCalculator::correlation(x, y);
+    GroupByResult result;
+    std::string error;
+    // Both lengths are read before either array is pinned
+    const jsize length = amounts != nullptr ? env->GetArrayLength(amounts) : 0;
+    if (amounts == nullptr || categories == nullptr) {
+        error = "Failed to get array elements";
+    } else if (env->GetArrayLength(categories) != length) {
+        error = "Amounts and categories must have the same length";
+    } else {
+        PinnedDoubles data(env, amounts, length);
+        PinnedBytes codes(env, categories, length);
+        if (!data.ok() || !codes.ok()) {
+            error = "Failed to get array elements";
+        } else {
+            try {
+                result = group_by_category(data.data(), reinterpret_cast<const uint8_t*>(codes.data()),
+                                           data.size(), CATEGORY_COUNT, options);
+            } catch (const std::exception& e) {
+                error = e.what();
+            }
+        }
+    }
     
+    if (!error.empty()) {
+        JsonWriter json;
+        json.raw("{\"success\":false,\"error\":").string(error).raw('}');
+        return env->NewStringUTF(json.str().c_str());
+    }
     return env->NewStringUTF(result.to_json().c_str());
 }
 
+/**
+ * Fill out with CATEGORY_COUNT blocks of
+ * GroupStats::FIELD_COUNT + percentiles.length doubles (see StatsLayout).
+ * 
+ * @param percentiles Per-category quantiles to compute (0-100), may be empty
+ * @param variance Also compute per-category variance
+ * @return Number of categories written, -(required length) if out is too
+ *         small (nothing is written), or 0 on invalid input
+ */
+JNIEXPORT jint JNICALL Java_com_tracker_jni_StatsBridge_calculateCategoryBreakdownInto(
+    JNIEnv *env, jobject obj, jdoubleArray amounts, jbyteArray categories,
+    jdoubleArray percentiles, jboolean variance, jdoubleArray out) {
+    
+    GroupByOptions options;
+    options.variance = variance == JNI_TRUE;
+    if (percentiles != nullptr) {
+        options.percentiles.resize(static_cast<size_t>(env->GetArrayLength(percentiles)));
+        env->GetDoubleArrayRegion(percentiles, 0, static_cast<jsize>(options.percentiles.size()),
+                                  options.percentiles.data());
+    }
+    
+    jsize required = static_cast<jsize>(CATEGORY_COUNT *
+                                        (GroupStats::FIELD_COUNT + options.percentiles.size()));
+    if (out == nullptr || env->GetArrayLength(out) < required) {
+        return -required;
+    }
+    
+    if (amounts == nullptr || categories == nullptr) {
+        return 0;
+    }
+    // Both lengths are read before either array is pinned
+    const jsize length = env->GetArrayLength(amounts);
+    if (env->GetArrayLength(categories) != length) {
+        return 0;
+    }
+    
+    std::vector<double> fields(static_cast<size_t>(required));
+    bool computed = false;
+    {
+        PinnedDoubles data(env, amounts, length);
+        PinnedBytes codes(env, categories, length);
+        if (data.ok() && codes.ok()) {
+            try {
+                group_by_category(data.data(), reinterpret_cast<const uint8_t*>(codes.data()),
+                                  data.size(), CATEGORY_COUNT, options).to_array(fields.data());
+                computed = true;
+            } catch (const std::exception&) {
+                computed = false;
+            }
+        }
+    }
+    
+    if (!computed) {
+        return 0;
+    }
+    
+    env->SetDoubleArrayRegion(out, 0, required, fields.data());
+    return static_cast<jint>(CATEGORY_COUNT);
+}
+
+/**
+ * Statistics for every segment [offsets[s], offsets[s + 1]) of amounts
+ * (e.g. one segment per user), computed in parallel in one call. out is
+ * field-major: field f of segment s is out[f * segments + s].
+ * 
+ * Amounts are copied rather than pinned: the batch can run for seconds
+ * and a critical section would hold off the GC that long.
+ * 
+ * @return segments written, the negated required length if out is too
+ *         small, or 0 on invalid input
+ */
+JNIEXPORT jint JNICALL Java_com_tracker_jni_StatsBridge_calculateStatsBatchInto(
+    JNIEnv *env, jobject obj, jdoubleArray amounts, jintArray offsets, jdoubleArray out) {
+    
+    if (amounts == nullptr || offsets == nullptr) {
+        return 0;
+    }
+    jsize offset_count = env->GetArrayLength(offsets);
+    if (offset_count < 2) {
+        return 0;
+    }
+    
+    size_t segments = static_cast<size_t>(offset_count) - 1;
+    jsize required = static_cast<jsize>(StatisticsResult::FIELD_COUNT * segments);
+    if (out == nullptr || env->GetArrayLength(out) < required) {
+        return -required;
+    }
+    
+    std::vector<jint> raw_offsets(static_cast<size_t>(offset_count));
+    env->GetIntArrayRegion(offsets, 0, offset_count, raw_offsets.data());
+    std::vector<size_t> bounds(raw_offsets.size());
+    for (size_t i = 0; i < raw_offsets.size(); ++i) {
+        if (raw_offsets[i] < 0) return 0;
+        bounds[i] = static_cast<size_t>(raw_offsets[i]);
+    }
+    
+    std::vector<double> data(static_cast<size_t>(env->GetArrayLength(amounts)));
+    env->GetDoubleArrayRegion(amounts, 0, static_cast<jsize>(data.size()), data.data());
+    
+    std::vector<double> fields(static_cast<size_t>(required));
+    try {
+        calculate_segmented_into(data.data(), data.size(), bounds.data(), bounds.size(),
+                                 fields.data());
+    } catch (const std::exception&) {
+        return 0;
+    }
+    
+    env->SetDoubleArrayRegion(out, 0, required, fields.data());
+    return static_cast<jint>(segments);
+}
+
 } // extern "C"
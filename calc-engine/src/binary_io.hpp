@@ -0,0 +1,112 @@
+/**
+ * Binary I/O Helpers (internal)
+ *
+ * Little-endian fixed-width integers, LEB128 varints and a bounds-checked
+ * read cursor shared by the snapshot and cube file formats. Multi-byte
+ * integers are assembled byte by byte, so files are the same on any host;
+ * compilers turn the loops into single loads and stores on little-endian
+ * targets.
+ *
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#ifndef EXPENSE_BINARY_IO_HPP
+#define EXPENSE_BINARY_IO_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace expense {
+namespace detail {
+
+/**
+ * Throw std::runtime_error("Corrupt <format>: <what>").
+ */
+[[noreturn]] inline void corrupt(const char* format, const std::string& what) {
+    throw std::runtime_error(std::string("Corrupt ") + format + ": " + what);
+}
+
+inline uint64_t zigzag(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+inline int64_t unzigzag(uint64_t value) {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+// ==================== Writing ====================
+
+template <typename T>
+void put(std::string& out, T value) {
+    using U = std::make_unsigned_t<T>;
+    U bits = static_cast<U>(value);
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        out.push_back(static_cast<char>((bits >> (8 * i)) & 0xFF));
+    }
+}
+
+inline void put_varint(std::string& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+// ==================== Reading ====================
+
+template <typename T>
+T load(const char* p) {
+    using U = std::make_unsigned_t<T>;
+    U bits = 0;
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        bits = static_cast<U>(bits | static_cast<U>(static_cast<U>(static_cast<unsigned char>(p[i])) << (8 * i)));
+    }
+    return static_cast<T>(bits);
+}
+
+/**
+ * Reader over [first, last); overruns and overlong varints are reported
+ * as corruption of `format`.
+ */
+class Cursor {
+public:
+    Cursor(const char* first, const char* last, const char* format)
+        : p_(first), last_(last), format_(format) {}
+
+    const char* take(size_t n) {
+        if (n > remaining()) corrupt(format_, "column or section overruns its bounds");
+        const char* start = p_;
+        p_ += n;
+        return start;
+    }
+
+    template <typename T>
+    T fixed() { return load<T>(take(sizeof(T))); }
+
+    uint64_t varint() {
+        uint64_t value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            uint8_t byte = static_cast<uint8_t>(*take(1));
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) return value;
+        }
+        corrupt(format_, "varint longer than 10 bytes");
+    }
+
+    size_t remaining() const { return static_cast<size_t>(last_ - p_); }
+
+private:
+    const char* p_;
+    const char* last_;
+    const char* format_;
+};
+
+} // namespace detail
+} // namespace expense
+
+#endif // EXPENSE_BINARY_IO_HPP
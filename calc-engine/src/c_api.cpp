@@ -0,0 +1,132 @@
+/**
+ * C API Implementation
+ * 
+ * Exceptions never cross the C boundary: each entry point catches and
+ * converts them to an error code plus a thread-local message.
+ * 
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#include "expense_c_api.h"
+#include "group_by.hpp"
+#include "resample.hpp"
+#include "segmented_stats.hpp"
+#include "statistics.hpp"
+#include <algorithm>
+#include <exception>
+#include <string>
+#include <vector>
+
+using namespace expense;
+
+namespace {
+
+thread_local std::string last_error;
+
+int fail(int code, const char* message) {
+    last_error = message;
+    return code;
+}
+
+} // namespace
+
+extern "C" {
+
+int expense_calculate_stats(const double* amounts, size_t n, double* out, size_t out_len) {
+    if (amounts == nullptr || out == nullptr) {
+        return fail(EXPENSE_ERR_INVALID, "Null pointer argument");
+    }
+    if (out_len < StatisticsResult::FIELD_COUNT) {
+        return fail(EXPENSE_ERR_BUFFER, "Output buffer too small");
+    }
+    try {
+        StatisticsCalculator::calculate_all(amounts, n).to_array(out);
+    } catch (const std::exception& e) {
+        return fail(EXPENSE_ERR_INVALID, e.what());
+    }
+    last_error.clear();
+    return EXPENSE_OK;
+}
+
+int expense_calculate_segmented(const double* amounts, size_t n,
+                                const size_t* offsets, size_t offset_count,
+                                double* out, size_t out_len) {
+    if ((n > 0 && amounts == nullptr) || (offset_count > 0 && offsets == nullptr) ||
+        out == nullptr) {
+        return fail(EXPENSE_ERR_INVALID, "Null pointer argument");
+    }
+    size_t segments = offset_count > 0 ? offset_count - 1 : 0;
+    if (out_len < StatisticsResult::FIELD_COUNT * segments) {
+        return fail(EXPENSE_ERR_BUFFER, "Output buffer too small");
+    }
+    try {
+        calculate_segmented_into(amounts, n, offsets, offset_count, out);
+    } catch (const std::exception& e) {
+        return fail(EXPENSE_ERR_INVALID, e.what());
+    }
+    last_error.clear();
+    return EXPENSE_OK;
+}
+
+int expense_group_by_category(const double* amounts, const uint8_t* codes, size_t n,
+                              uint32_t group_count,
+                              const double* percentiles, size_t percentile_count,
+                              unsigned flags, double* out, size_t out_len) {
+    if ((n > 0 && (amounts == nullptr || codes == nullptr)) || out == nullptr ||
+        (percentile_count > 0 && percentiles == nullptr)) {
+        return fail(EXPENSE_ERR_INVALID, "Null pointer argument");
+    }
+    if (out_len < group_count * (GroupStats::FIELD_COUNT + percentile_count)) {
+        return fail(EXPENSE_ERR_BUFFER, "Output buffer too small");
+    }
+    try {
+        GroupByOptions options;
+        options.variance = (flags & EXPENSE_GROUP_VARIANCE) != 0;
+        options.percentiles.assign(percentiles, percentiles + percentile_count);
+        group_by_category(amounts, codes, n, group_count, options).to_array(out);
+    } catch (const std::exception& e) {
+        return fail(EXPENSE_ERR_INVALID, e.what());
+    }
+    last_error.clear();
+    return EXPENSE_OK;
+}
+
+int expense_resample(const int32_t* dates, const double* amounts, size_t n,
+                     int period, int zero_fill,
+                     int32_t* out_starts, double* out_totals, uint32_t* out_counts,
+                     size_t capacity, size_t* produced) {
+    if ((n > 0 && (dates == nullptr || amounts == nullptr)) || produced == nullptr ||
+        (capacity > 0 && (out_starts == nullptr || out_totals == nullptr || out_counts == nullptr))) {
+        return fail(EXPENSE_ERR_INVALID, "Null pointer argument");
+    }
+    if (period < EXPENSE_PERIOD_DAY || period > EXPENSE_PERIOD_YEAR) {
+        return fail(EXPENSE_ERR_INVALID, "Unknown period");
+    }
+    
+    ResampleOptions options;
+    options.period = static_cast<Period>(period);
+    options.zero_fill = zero_fill != 0;
+    ResampleResult result;
+    try {
+        result = resample(dates, amounts, n, options);
+    } catch (const std::exception& e) {
+        return fail(EXPENSE_ERR_INVALID, e.what());
+    }
+    
+    *produced = result.size();
+    if (result.size() > capacity) {
+        return fail(EXPENSE_ERR_BUFFER, "Output buffer too small");
+    }
+    std::copy(result.starts.begin(), result.starts.end(), out_starts);
+    std::copy(result.totals.begin(), result.totals.end(), out_totals);
+    std::copy(result.counts.begin(), result.counts.end(), out_counts);
+    last_error.clear();
+    return EXPENSE_OK;
+}
+
+const char* expense_last_error(void) {
+    return last_error.c_str();
+}
+
+} // extern "C"
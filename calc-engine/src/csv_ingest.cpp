@@ -0,0 +1,552 @@
+/**
+ * CSV Ingestion Implementation
+ *
+ * Structural bitmasks per 64-byte block, quote-parity chunking and a
+ * per-chunk field decoder that appends straight into ExpenseTable
+ * columns.
+ *
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#include "csv_ingest.hpp"
+#include "ingest.hpp"
+#include <algorithm>
+#include <bitset>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define EXPENSE_CSV_SSE2 1
+#include <emmintrin.h>
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace expense {
+
+namespace {
+
+constexpr size_t BLOCK = 64;
+
+// ==================== Structural Masks ====================
+
+/**
+ * Bit i set where byte i of a 64-byte block is a quote / comma / newline.
+ */
+struct BlockMasks {
+    uint64_t quotes;
+    uint64_t commas;
+    uint64_t newlines;
+};
+
+#if defined(EXPENSE_CSV_SSE2)
+
+inline uint64_t match16(__m128i bytes, __m128i target, int shift) {
+    uint32_t bits = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, target)));
+    return static_cast<uint64_t>(bits) << shift;
+}
+
+BlockMasks classify(const char* p) {
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i comma = _mm_set1_epi8(',');
+    const __m128i newline = _mm_set1_epi8('\n');
+
+    BlockMasks m{0, 0, 0};
+    for (int k = 0; k < 4; ++k) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16 * k));
+        m.quotes |= match16(bytes, quote, 16 * k);
+        m.commas |= match16(bytes, comma, 16 * k);
+        m.newlines |= match16(bytes, newline, 16 * k);
+    }
+    return m;
+}
+
+#else
+
+BlockMasks classify(const char* p) {
+    BlockMasks m{0, 0, 0};
+    for (size_t i = 0; i < BLOCK; ++i) {
+        uint64_t bit = uint64_t(1) << i;
+        if (p[i] == '"') m.quotes |= bit;
+        else if (p[i] == ',') m.commas |= bit;
+        else if (p[i] == '\n') m.newlines |= bit;
+    }
+    return m;
+}
+
+#endif
+
+/**
+ * Bit i = parity of set bits 0..i: 1 from an opening quote up to (not
+ * including) its closing quote.
+ */
+inline uint64_t prefix_xor(uint64_t x) {
+    x ^= x << 1;
+    x ^= x << 2;
+    x ^= x << 4;
+    x ^= x << 8;
+    x ^= x << 16;
+    x ^= x << 32;
+    return x;
+}
+
+inline unsigned lowest_bit(uint64_t x) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctzll(x));
+#endif
+}
+
+inline size_t popcount(uint64_t x) {
+#if defined(_MSC_VER)
+    return std::bitset<64>(x).count();
+#else
+    return static_cast<size_t>(__builtin_popcountll(x));
+#endif
+}
+
+/**
+ * Masks for the block at p, zero-padding a short final block.
+ */
+BlockMasks classify(const char* p, size_t available) {
+    if (available >= BLOCK) return classify(p);
+    char padded[BLOCK] = {};
+    std::memcpy(padded, p, available);
+    return classify(padded);
+}
+
+size_t count_quotes(const char* p, size_t n) {
+    size_t total = 0;
+    for (size_t i = 0; i < n; i += BLOCK) {
+        total += popcount(classify(p + i, n - i).quotes);
+    }
+    return total;
+}
+
+/**
+ * First byte after a newline outside quotes at or after p, given whether
+ * p is inside a quoted field.
+ */
+const char* next_row_start(const char* p, const char* last, bool in_quotes) {
+    for (; p < last; ++p) {
+        if (*p == '"') {
+            in_quotes = !in_quotes;
+        } else if (*p == '\n' && !in_quotes) {
+            return p + 1;
+        }
+    }
+    return last;
+}
+
+// ==================== Layout ====================
+
+enum class Column : uint8_t {
+    Skip, Amount, Category, Date, Merchant, PaymentMethod, Recurring
+};
+
+struct Layout {
+    std::vector<Column> columns;
+    size_t required = 0;            // fields a row needs (through the last required column)
+    bool merchant = false;
+    bool payment_method = false;
+};
+
+/**
+ * ID, Amount, Category, Description, Date, Merchant, Payment Method, Recurring
+ */
+Layout export_layout() {
+    Layout layout;
+    layout.columns = {Column::Skip, Column::Amount, Column::Category, Column::Skip,
+                      Column::Date, Column::Merchant, Column::PaymentMethod, Column::Recurring};
+    layout.required = 5;
+    layout.merchant = true;
+    layout.payment_method = true;
+    return layout;
+}
+
+/**
+ * Drop the enclosing quotes of a field, if any.
+ * @return true if the field was quoted
+ */
+inline bool unquote(const char*& s, const char*& e) {
+    if (e - s >= 2 && *s == '"' && e[-1] == '"') {
+        ++s;
+        --e;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Split the line [first, last) into fields (header only; scalar).
+ */
+std::vector<std::string> split_header(const char* first, const char* last) {
+    std::vector<std::string> fields;
+    std::string current;
+    bool in_quotes = false;
+    for (const char* p = first; p < last; ++p) {
+        if (*p == '"') {
+            if (in_quotes && p + 1 < last && p[1] == '"') {
+                current += '"';
+                ++p;
+            } else {
+                in_quotes = !in_quotes;
+            }
+        } else if (*p == ',' && !in_quotes) {
+            fields.push_back(current);
+            current.clear();
+        } else if (*p != '\r') {
+            current += *p;
+        }
+    }
+    fields.push_back(current);
+    return fields;
+}
+
+/**
+ * Build the layout from a header row, or return false if the first line
+ * is not a header (no "Amount" column).
+ */
+bool layout_from_header(const std::vector<std::string>& names, Layout& layout) {
+    if (std::find(names.begin(), names.end(), "Amount") == names.end()) return false;
+
+    layout = Layout();
+    bool has_category = false;
+    bool has_date = false;
+    for (size_t i = 0; i < names.size(); ++i) {
+        const std::string& name = names[i];
+        Column column = Column::Skip;
+        if (name == "Amount") column = Column::Amount;
+        else if (name == "Category") column = Column::Category, has_category = true;
+        else if (name == "Date") column = Column::Date, has_date = true;
+        else if (name == "Merchant") column = Column::Merchant, layout.merchant = true;
+        else if (name == "Payment Method") column = Column::PaymentMethod, layout.payment_method = true;
+        else if (name == "Recurring") column = Column::Recurring;
+        layout.columns.push_back(column);
+        if (column == Column::Amount || column == Column::Category || column == Column::Date) {
+            layout.required = i + 1;
+        }
+    }
+    if (!has_category || !has_date) {
+        throw ParseError(std::string("CSV header has no ") + (has_category ? "Date" : "Category") +
+                         " column", 1, 1);
+    }
+    return true;
+}
+
+// ==================== Field Decoding ====================
+
+bool parse_amount(const char* s, const char* e, double& out) {
+    if (s < e && *s == '+') ++s;
+    auto res = std::from_chars(s, e, out);
+    return res.ec == std::errc() && res.ptr == e && std::isfinite(out);
+}
+
+inline bool two_digits(const char* p, unsigned& out) {
+    unsigned hi = static_cast<unsigned>(p[0] - '0');
+    unsigned lo = static_cast<unsigned>(p[1] - '0');
+    out = hi * 10 + lo;
+    return hi < 10 && lo < 10;
+}
+
+/**
+ * "YYYY-MM-DD" into epoch days without allocating (cf. parse_iso_date).
+ */
+bool parse_date(const char* s, const char* e, int32_t& out) {
+    unsigned century, year_lo, month, day;
+    if (e - s != 10 || s[4] != '-' || s[7] != '-' ||
+        !two_digits(s, century) || !two_digits(s + 2, year_lo) ||
+        !two_digits(s + 5, month) || !two_digits(s + 8, day)) {
+        return false;
+    }
+    static const unsigned DAYS_IN_MONTH[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    int year = static_cast<int>(century * 100 + year_lo);
+    if (month < 1 || month > 12 || day < 1) return false;
+    bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    if (day > DAYS_IN_MONTH[month - 1] + (month == 2 && leap ? 1u : 0u)) return false;
+    out = days_from_civil(year, month, day);
+    return true;
+}
+
+bool parse_category_code(const char* s, const char* e, uint8_t& out) {
+    size_t length = static_cast<size_t>(e - s);
+    for (size_t i = 0; i < CATEGORY_COUNT; ++i) {
+        const char* name = category_name(static_cast<Category>(i));
+        if (std::strlen(name) == length && std::memcmp(name, s, length) == 0) {
+            out = static_cast<uint8_t>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Decodes the rows of one chunk into a table of its own.
+ */
+class ChunkParser {
+public:
+    /**
+     * @param exact If set, also receives each row's amount via Money::parse
+     */
+    ChunkParser(const char* file_begin, const Layout& layout, ExpenseTable& out,
+                std::vector<Money>* exact = nullptr)
+        : file_begin_(file_begin), layout_(layout), out_(out), exact_(exact) {
+        if (!layout.merchant) default_merchant_ = out.merchants().intern("");
+        if (!layout.payment_method) default_payment_ = out.payment_methods().intern("");
+        start_row();
+    }
+
+    void parse(const char* begin, const char* end) {
+        const char* field_start = begin;
+        uint64_t carry = 0;             // all ones while inside quotes across blocks
+
+        for (const char* block = begin; block < end; block += BLOCK) {
+            BlockMasks m = classify(block, static_cast<size_t>(end - block));
+
+            uint64_t in_quotes = prefix_xor(m.quotes) ^ carry;
+            carry = static_cast<uint64_t>(static_cast<int64_t>(in_quotes) >> 63);
+
+            uint64_t separators = (m.commas | m.newlines) & ~in_quotes;
+            while (separators != 0) {
+                unsigned bit = lowest_bit(separators);
+                const char* at = block + bit;
+                end_field(field_start, at);
+                if ((m.newlines >> bit) & 1) end_row(at);
+                field_start = at + 1;
+                separators &= separators - 1;
+            }
+        }
+
+        if (carry != 0) {
+            throw error("Unterminated quoted field", field_start, std::min(end, field_start + 20));
+        }
+        if (field_start < end || field_index_ > 0) {
+            end_field(field_start, end);
+            end_row(end);
+        }
+    }
+
+private:
+    void start_row() {
+        record_ = ExpenseRecord();
+        record_.merchant = default_merchant_;
+        record_.payment_method = default_payment_;
+        field_index_ = 0;
+        row_start_ = nullptr;
+        row_empty_ = true;
+    }
+
+    void end_field(const char* s, const char* e) {
+        if (field_index_ == 0) row_start_ = s;
+        if (e > s && e[-1] == '\r') --e;
+        if (e > s) row_empty_ = false;
+
+        Column column = field_index_ < layout_.columns.size()
+            ? layout_.columns[field_index_] : Column::Skip;
+        ++field_index_;
+        if (column == Column::Skip) return;
+
+        const char* raw_s = s;
+        const char* raw_e = e;
+        bool quoted = unquote(s, e);
+        switch (column) {
+            case Column::Amount:
+                if (!parse_amount(s, e, record_.amount)) throw error("Invalid amount", raw_s, raw_e);
+                if (exact_ != nullptr) exact_amount_ = parse_exact(s, e, raw_s, raw_e);
+                break;
+            case Column::Category: {
+                uint8_t code;
+                if (!parse_category_code(s, e, code)) throw error("Unknown category", raw_s, raw_e);
+                record_.category = static_cast<Category>(code);
+                break;
+            }
+            case Column::Date:
+                if (!parse_date(s, e, record_.date)) {
+                    throw error("Invalid date (expected YYYY-MM-DD)", raw_s, raw_e);
+                }
+                break;
+            case Column::Merchant:
+                record_.merchant = out_.merchants().intern(text(s, e, quoted));
+                break;
+            case Column::PaymentMethod:
+                record_.payment_method = out_.payment_methods().intern(text(s, e, quoted));
+                break;
+            case Column::Recurring:
+                if (e - s == 4 && std::memcmp(s, "true", 4) == 0) {
+                    record_.recurring = true;
+                } else if (e == s || (e - s == 5 && std::memcmp(s, "false", 5) == 0)) {
+                    record_.recurring = false;
+                } else {
+                    throw error("Invalid recurring flag", raw_s, raw_e);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    void end_row(const char* at) {
+        // Blank line (possibly just "\r")
+        if (field_index_ == 1 && row_empty_) {
+            start_row();
+            return;
+        }
+        if (field_index_ < layout_.required) {
+            throw error("Expected " + std::to_string(layout_.required) + " fields, found " +
+                        std::to_string(field_index_) + " in row", row_start_,
+                        std::min(at, row_start_ + 40));
+        }
+        out_.append(record_);
+        if (exact_ != nullptr) exact_->push_back(exact_amount_);
+        start_row();
+    }
+
+    Money parse_exact(const char* s, const char* e, const char* raw_s, const char* raw_e) const {
+        try {
+            return Money::parse(s, e);
+        } catch (const std::invalid_argument& ex) {
+            // Keep Money's reason ("... more than 2 decimal places"), add the position
+            std::string reason = ex.what();
+            throw error(reason.substr(0, reason.find(':')), raw_s, raw_e);
+        }
+    }
+
+    /**
+     * Field text with doubled quotes collapsed, in a reused buffer.
+     */
+    const std::string& text(const char* s, const char* e, bool quoted) {
+        scratch_.assign(s, e);
+        if (quoted && std::memchr(s, '"', static_cast<size_t>(e - s)) != nullptr) {
+            size_t w = 0;
+            for (size_t r = 0; r < scratch_.size(); ++r, ++w) {
+                scratch_[w] = scratch_[r];
+                if (scratch_[r] == '"' && r + 1 < scratch_.size() && scratch_[r + 1] == '"') ++r;
+            }
+            scratch_.resize(w);
+        }
+        return scratch_;
+    }
+
+    ParseError error(const std::string& what, const char* s, const char* e) const {
+        size_t line = 1 + static_cast<size_t>(std::count(file_begin_, s, '\n'));
+        const char* line_start = s;
+        while (line_start > file_begin_ && line_start[-1] != '\n') --line_start;
+        size_t column = static_cast<size_t>(s - line_start) + 1;
+        return ParseError(what + " '" + std::string(s, e) + "' at line " + std::to_string(line) +
+                          ", column " + std::to_string(column), line, column);
+    }
+
+    const char* file_begin_;
+    const Layout& layout_;
+    ExpenseTable& out_;
+    std::vector<Money>* exact_;
+
+    ExpenseRecord record_;
+    Money exact_amount_;
+    size_t field_index_ = 0;
+    const char* row_start_ = nullptr;
+    bool row_empty_ = true;
+    uint32_t default_merchant_ = 0;
+    uint32_t default_payment_ = 0;
+    std::string scratch_;
+};
+
+} // namespace
+
+// ==================== Parsing ====================
+
+namespace {
+
+ExpenseTable parse_csv(const char* first, const char* last, const ExecutionPolicy& policy,
+                       std::vector<Money>* exact) {
+    const char* body = first;
+    if (last - body >= 3 && std::memcmp(body, "\xEF\xBB\xBF", 3) == 0) body += 3;
+
+    // Header row, if the first line names an Amount column
+    Layout layout = export_layout();
+    const char* header_end = next_row_start(body, last, false);
+    const char* header_line_end = header_end > body && header_end[-1] == '\n' ? header_end - 1 : header_end;
+    if (layout_from_header(split_header(body, header_line_end), layout)) {
+        body = header_end;
+    }
+
+    // Chunk starts: quote parity up to each raw cut tells whether the cut
+    // is inside a quoted field; the chunk then starts at the next row.
+    const size_t size = static_cast<size_t>(last - body);
+    const size_t chunk_bytes = policy.chunk_size ? policy.chunk_size : CSV_CHUNK_BYTES;
+    const size_t chunks = std::max<size_t>(1, (size + chunk_bytes - 1) / chunk_bytes);
+    ThreadPool& pool = policy.executor();
+
+    std::vector<size_t> quotes(chunks, 0);
+    pool.parallel_for(chunks, [&](size_t c) {
+        size_t offset = c * chunk_bytes;
+        quotes[c] = count_quotes(body + offset, std::min(chunk_bytes, size - std::min(size, offset)));
+    });
+
+    std::vector<const char*> starts(chunks + 1, last);
+    starts[0] = body;
+    std::vector<uint8_t> cut_in_quotes(chunks, 0);
+    size_t parity = 0;
+    for (size_t c = 1; c < chunks; ++c) {
+        parity += quotes[c - 1];
+        cut_in_quotes[c] = parity & 1;
+    }
+    pool.parallel_for(chunks - 1, [&](size_t k) {
+        size_t c = k + 1;
+        starts[c] = next_row_start(body + c * chunk_bytes, last, cut_in_quotes[c] != 0);
+    });
+    for (size_t c = 1; c <= chunks; ++c) {
+        starts[c] = std::max(starts[c], starts[c - 1]);
+    }
+
+    std::vector<ExpenseTable> parts(chunks);
+    std::vector<std::vector<Money>> exact_parts(exact != nullptr ? chunks : 0);
+    pool.parallel_for(chunks, [&](size_t c) {
+        parts[c].reserve(static_cast<size_t>(starts[c + 1] - starts[c]) / 48);
+        ChunkParser parser(first, layout, parts[c], exact != nullptr ? &exact_parts[c] : nullptr);
+        parser.parse(starts[c], starts[c + 1]);
+    });
+
+    size_t rows = 0;
+    for (const ExpenseTable& part : parts) rows += part.size();
+    if (exact != nullptr) {
+        exact->clear();
+        exact->reserve(rows);
+        for (const std::vector<Money>& part : exact_parts) exact->insert(exact->end(), part.begin(), part.end());
+    }
+
+    if (chunks == 1) return std::move(parts[0]);
+
+    ExpenseTable table;
+    table.reserve(rows);
+    for (const ExpenseTable& part : parts) table.append(part);
+    return table;
+}
+
+} // namespace
+
+ExpenseTable parse_expense_csv(const char* first, const char* last, const ExecutionPolicy& policy) {
+    return parse_csv(first, last, policy, nullptr);
+}
+
+ExpenseTable parse_expense_csv(const char* first, const char* last,
+                               std::vector<Money>& exact_amounts, const ExecutionPolicy& policy) {
+    return parse_csv(first, last, policy, &exact_amounts);
+}
+
+ExpenseTable load_expense_csv(const std::string& path, const ExecutionPolicy& policy) {
+    MappedFile file(path);
+    return parse_expense_csv(file.data(), file.data() + file.size(), policy);
+}
+
+} // namespace expense
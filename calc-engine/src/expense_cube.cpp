@@ -0,0 +1,448 @@
+/**
+ * Expense Cube Implementation
+ *
+ * Cube file layout (little-endian, see binary_io.hpp):
+ *
+ *   header   "EXPCUBE\0", uint32 version, uint32 users,
+ *            int32 first_month, uint32 months
+ *   users    per user: zigzag varint id, varint non-empty cells, then per
+ *            cell: varint index gap, varint count, zigzag varint sum,
+ *            varint sum_sq_lo, varint sum_sq_hi
+ *
+ * A cell index is month offset * CATEGORY_COUNT + category; gaps are from
+ * the previous index + 1, so consecutive cells cost a zero byte.
+ *
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#include "expense_cube.hpp"
+#include "binary_io.hpp"
+#include "ingest.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+namespace expense {
+
+namespace {
+
+using detail::Cursor;
+using detail::put;
+using detail::put_varint;
+
+const char MAGIC[8] = {'E', 'X', 'P', 'C', 'U', 'B', 'E', '\0'};
+constexpr size_t HEADER_BYTES = 24;
+
+[[noreturn]] void corrupt(const std::string& what) {
+    detail::corrupt("cube", what);
+}
+
+// ==================== 128-bit Arithmetic ====================
+
+/**
+ * value^2 as (hi, lo), from 32-bit halves so no compiler extension is
+ * needed.
+ */
+void square(int64_t value, uint64_t* lo, uint64_t* hi) {
+    const uint64_t a = value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+    const uint64_t a0 = a & 0xFFFFFFFFu;
+    const uint64_t a1 = a >> 32;
+    const uint64_t cross = a0 * a1;
+    *lo = a0 * a0;
+    *hi = a1 * a1;
+    for (int twice = 0; twice < 2; ++twice) {
+        const uint64_t add = cross << 32;
+        *lo += add;
+        *hi += (cross >> 32) + (*lo < add ? 1 : 0);
+    }
+}
+
+CubeCell expense_cell(Money amount) {
+    CubeCell cell;
+    cell.count = 1;
+    cell.sum = amount.paise();
+    square(cell.sum, &cell.sum_sq_lo, &cell.sum_sq_hi);
+    return cell;
+}
+
+void subtract(CubeCell& cell, const CubeCell& delta) {
+    cell.count -= delta.count;
+    cell.sum -= delta.sum;
+    const uint64_t borrow = cell.sum_sq_lo < delta.sum_sq_lo ? 1 : 0;
+    cell.sum_sq_lo -= delta.sum_sq_lo;
+    cell.sum_sq_hi -= delta.sum_sq_hi + borrow;
+}
+
+size_t category_slot(Category category) {
+    const size_t c = static_cast<size_t>(category);
+    if (c >= CATEGORY_COUNT) {
+        throw std::invalid_argument("Invalid category code " + std::to_string(c));
+    }
+    return c;
+}
+
+void check_query(const CubeQuery& query) {
+    if (query.category != ALL_CATEGORIES &&
+        (query.category < 0 || static_cast<size_t>(query.category) >= CATEGORY_COUNT)) {
+        throw std::invalid_argument("Invalid category code " + std::to_string(query.category));
+    }
+}
+
+} // namespace
+
+int32_t month_index(int32_t epoch_day) {
+    int year;
+    unsigned month, day;
+    civil_from_days(epoch_day, &year, &month, &day);
+    return month_index(year, month);
+}
+
+// ==================== CubeCell ====================
+
+double CubeCell::mean() const {
+    return count > 0 ? static_cast<double>(sum) / static_cast<double>(count) / 100.0 : 0.0;
+}
+
+double CubeCell::variance() const {
+    if (count <= 0) return 0.0;
+    const double n = static_cast<double>(count);
+    const double squares = static_cast<double>(sum_sq_hi) * 18446744073709551616.0 +
+                           static_cast<double>(sum_sq_lo);
+    const double mean_paise = static_cast<double>(sum) / n;
+    return std::max(0.0, squares / n - mean_paise * mean_paise) / 10000.0;
+}
+
+double CubeCell::stddev() const {
+    return std::sqrt(variance());
+}
+
+CubeCell& CubeCell::operator+=(const CubeCell& other) {
+    count += other.count;
+    sum += other.sum;
+    sum_sq_lo += other.sum_sq_lo;
+    sum_sq_hi += other.sum_sq_hi + (sum_sq_lo < other.sum_sq_lo ? 1 : 0);
+    return *this;
+}
+
+bool CubeCell::operator==(const CubeCell& other) const {
+    return count == other.count && sum == other.sum &&
+           sum_sq_lo == other.sum_sq_lo && sum_sq_hi == other.sum_sq_hi;
+}
+
+// ==================== Maintenance ====================
+
+size_t ExpenseCube::find_slot(int64_t user) const {
+    if (user == ALL_USERS) return 0;
+    auto it = slots_.find(user);
+    return it == slots_.end() ? NO_SLOT : it->second;
+}
+
+size_t ExpenseCube::slot(int64_t user) {
+    if (user == ALL_USERS) {
+        throw std::invalid_argument("ALL_USERS is not a user id");
+    }
+    auto it = slots_.find(user);
+    if (it != slots_.end()) return it->second;
+
+    const size_t index = user_ids_.size();
+    slots_.emplace(user, index);
+    user_ids_.push_back(user);
+    cells_.resize(cells_.size() + months_ * CATEGORY_COUNT);
+    return index;
+}
+
+void ExpenseCube::cover(int32_t month) {
+    if (months_ == 0) {
+        first_month_ = month;
+        months_ = 1;
+        cells_.assign(user_ids_.size() * CATEGORY_COUNT, CubeCell());
+        return;
+    }
+
+    const int64_t first = first_month_;
+    const int64_t last = first + static_cast<int64_t>(months_) - 1;
+    if (month >= first && month <= last) return;
+
+    // Grow by at least the current span so repeated growth is amortised,
+    // but never past MAX_CUBE_MONTHS
+    const int64_t span = static_cast<int64_t>(months_);
+    int64_t new_first = std::min<int64_t>(first, month);
+    int64_t new_last = std::max<int64_t>(last, month);
+    if (new_last - new_first + 1 > static_cast<int64_t>(MAX_CUBE_MONTHS)) {
+        throw std::invalid_argument("Cube would span more than " +
+                                    std::to_string(MAX_CUBE_MONTHS) + " months");
+    }
+    const int64_t doubled_first = month < first ? std::min<int64_t>(month, first - span) : first;
+    const int64_t doubled_last = month > last ? std::max<int64_t>(month, last + span) : last;
+    if (doubled_last - doubled_first + 1 <= static_cast<int64_t>(MAX_CUBE_MONTHS) &&
+        doubled_first >= std::numeric_limits<int32_t>::min() &&
+        doubled_last <= std::numeric_limits<int32_t>::max()) {
+        new_first = doubled_first;
+        new_last = doubled_last;
+    }
+
+    const size_t months = static_cast<size_t>(new_last - new_first + 1);
+    const size_t shift = static_cast<size_t>(first - new_first) * CATEGORY_COUNT;
+    const size_t old_plane = months_ * CATEGORY_COUNT;
+    const size_t new_plane = months * CATEGORY_COUNT;
+    std::vector<CubeCell> cells(user_ids_.size() * new_plane, CubeCell());
+    for (size_t s = 0; s < user_ids_.size(); ++s) {
+        std::copy(cells_.begin() + static_cast<std::ptrdiff_t>(s * old_plane),
+                  cells_.begin() + static_cast<std::ptrdiff_t>((s + 1) * old_plane),
+                  cells.begin() + static_cast<std::ptrdiff_t>(s * new_plane + shift));
+    }
+    cells_.swap(cells);
+    first_month_ = static_cast<int32_t>(new_first);
+    months_ = months;
+}
+
+void ExpenseCube::apply(size_t slot, size_t month, size_t category, const CubeCell& delta, bool subtract_delta) {
+    CubeCell& cell = cells_[cell_index(slot, month, category)];
+    CubeCell& all = cells_[cell_index(0, month, category)];
+    if (subtract_delta) {
+        subtract(cell, delta);
+        subtract(all, delta);
+    } else {
+        cell += delta;
+        all += delta;
+    }
+}
+
+void ExpenseCube::add(int64_t user, int32_t date, Category category, Money amount) {
+    if (user == ALL_USERS) {
+        throw std::invalid_argument("ALL_USERS is not a user id");
+    }
+    const size_t c = category_slot(category);
+    const int32_t month = month_index(date);
+    cover(month);
+    const size_t s = slot(user);
+    apply(s, static_cast<size_t>(static_cast<int64_t>(month) - first_month_), c, expense_cell(amount), false);
+}
+
+void ExpenseCube::remove(int64_t user, int32_t date, Category category, Money amount) {
+    const size_t c = category_slot(category);
+    const int64_t offset = static_cast<int64_t>(month_index(date)) - first_month_;
+    const size_t s = user == ALL_USERS ? NO_SLOT : find_slot(user);
+    if (s == NO_SLOT || offset < 0 || offset >= static_cast<int64_t>(months_) ||
+        cells_[cell_index(s, static_cast<size_t>(offset), c)].count == 0) {
+        throw std::invalid_argument("Cube has no expense to remove for that user, month and category");
+    }
+    apply(s, static_cast<size_t>(offset), c, expense_cell(amount), true);
+}
+
+void ExpenseCube::update(int64_t user, int32_t old_date, Category old_category, Money old_amount,
+                         int32_t new_date, Category new_category, Money new_amount) {
+    remove(user, old_date, old_category, old_amount);
+    add(user, new_date, new_category, new_amount);
+}
+
+void ExpenseCube::add(int64_t user, const ExpenseTable& table) {
+    if (table.empty()) return;
+    if (user == ALL_USERS) {
+        throw std::invalid_argument("ALL_USERS is not a user id");
+    }
+    ColumnView<int32_t> dates = table.dates();
+    ColumnView<double> amounts = table.amounts();
+    ColumnView<uint8_t> categories = table.categories();
+    const auto range = std::minmax_element(dates.begin(), dates.end());
+    cover(month_index(*range.first));
+    cover(month_index(*range.second));
+    const size_t s = slot(user);
+
+    // Exports are mostly date-ordered, so the month lookup rarely repeats
+    int32_t cached_date = dates[0];
+    size_t month = static_cast<size_t>(static_cast<int64_t>(month_index(cached_date)) - first_month_);
+    for (size_t i = 0; i < table.size(); ++i) {
+        if (dates[i] != cached_date) {
+            cached_date = dates[i];
+            month = static_cast<size_t>(static_cast<int64_t>(month_index(cached_date)) - first_month_);
+        }
+        const size_t c = category_slot(static_cast<Category>(categories[i]));
+        apply(s, month, c, expense_cell(Money::from_double(amounts[i])), false);
+    }
+}
+
+// ==================== Roll-ups ====================
+
+bool ExpenseCube::month_range(const CubeQuery& query, size_t* first, size_t* last) const {
+    const int64_t span_first = first_month_;
+    const int64_t span_end = span_first + static_cast<int64_t>(months_);
+    const int64_t lo = std::max<int64_t>(query.month_from, span_first);
+    const int64_t hi = std::min<int64_t>(static_cast<int64_t>(query.month_to) + 1, span_end);
+    if (lo >= hi) {
+        *first = *last = 0;
+        return false;
+    }
+    *first = static_cast<size_t>(lo - span_first);
+    *last = static_cast<size_t>(hi - span_first);
+    return true;
+}
+
+void ExpenseCube::fold(size_t slot, const CubeQuery& query, size_t first, size_t last, CubeCell& out) const {
+    if (query.category == ALL_CATEGORIES) {
+        const CubeCell* cell = &cells_[cell_index(slot, first, 0)];
+        const CubeCell* end = cell + (last - first) * CATEGORY_COUNT;
+        for (; cell != end; ++cell) out += *cell;
+        return;
+    }
+    const size_t c = static_cast<size_t>(query.category);
+    for (size_t m = first; m < last; ++m) out += cells_[cell_index(slot, m, c)];
+}
+
+CubeCell ExpenseCube::total(const CubeQuery& query) const {
+    check_query(query);
+    CubeCell result;
+    const size_t s = find_slot(query.user);
+    size_t first, last;
+    if (s == NO_SLOT || !month_range(query, &first, &last)) return result;
+    fold(s, query, first, last, result);
+    return result;
+}
+
+std::array<CubeCell, CATEGORY_COUNT> ExpenseCube::by_category(const CubeQuery& query) const {
+    std::array<CubeCell, CATEGORY_COUNT> result{};
+    const size_t s = find_slot(query.user);
+    size_t first, last;
+    if (s == NO_SLOT || !month_range(query, &first, &last)) return result;
+    for (size_t m = first; m < last; ++m) {
+        const CubeCell* month = &cells_[cell_index(s, m, 0)];
+        for (size_t c = 0; c < CATEGORY_COUNT; ++c) result[c] += month[c];
+    }
+    return result;
+}
+
+MonthlyCells ExpenseCube::by_month(const CubeQuery& query) const {
+    check_query(query);
+    MonthlyCells result;
+    const size_t s = find_slot(query.user);
+    size_t first, last;
+    if (s == NO_SLOT || !month_range(query, &first, &last)) return result;
+    result.first_month = first_month_ + static_cast<int32_t>(first);
+    result.cells.resize(last - first);
+    for (size_t m = first; m < last; ++m) fold(s, query, m, m + 1, result.cells[m - first]);
+    return result;
+}
+
+std::vector<std::pair<int64_t, CubeCell>> ExpenseCube::by_user(const CubeQuery& query) const {
+    check_query(query);
+    std::vector<std::pair<int64_t, CubeCell>> result;
+    size_t first, last;
+    if (!month_range(query, &first, &last)) return result;
+    for (size_t s = 1; s < user_ids_.size(); ++s) {
+        CubeCell cell;
+        fold(s, query, first, last, cell);
+        if (cell.count > 0) result.emplace_back(user_ids_[s], cell);
+    }
+    std::sort(result.begin(), result.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+    return result;
+}
+
+// ==================== Persistence ====================
+
+std::string ExpenseCube::serialize() const {
+    std::string out(MAGIC, sizeof(MAGIC));
+    put<uint32_t>(out, CUBE_VERSION);
+    put<uint32_t>(out, static_cast<uint32_t>(user_count()));
+    put<int32_t>(out, first_month_);
+    put<uint32_t>(out, static_cast<uint32_t>(months_));
+
+    const size_t plane = months_ * CATEGORY_COUNT;
+    for (size_t s = 1; s < user_ids_.size(); ++s) {
+        const CubeCell* cells = &cells_[s * plane];
+        size_t filled = 0;
+        for (size_t i = 0; i < plane; ++i) filled += cells[i].count != 0;
+        put_varint(out, detail::zigzag(user_ids_[s]));
+        put_varint(out, filled);
+
+        size_t next = 0;
+        for (size_t i = 0; i < plane; ++i) {
+            if (cells[i].count == 0) continue;
+            put_varint(out, i - next);
+            put_varint(out, static_cast<uint64_t>(cells[i].count));
+            put_varint(out, detail::zigzag(cells[i].sum));
+            put_varint(out, cells[i].sum_sq_lo);
+            put_varint(out, cells[i].sum_sq_hi);
+            next = i + 1;
+        }
+    }
+    return out;
+}
+
+ExpenseCube ExpenseCube::deserialize(const char* data, size_t size) {
+    if (size < HEADER_BYTES || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("Not an expense cube (bad magic)");
+    }
+    const uint32_t version = detail::load<uint32_t>(data + 8);
+    if (version != CUBE_VERSION) {
+        throw std::runtime_error("Unsupported cube version " + std::to_string(version));
+    }
+    const uint32_t users = detail::load<uint32_t>(data + 12);
+    const int32_t first_month = detail::load<int32_t>(data + 16);
+    const uint32_t months = detail::load<uint32_t>(data + 20);
+    Cursor in(data + HEADER_BYTES, data + size, "cube");
+    if (months > MAX_CUBE_MONTHS ||
+        static_cast<int64_t>(first_month) + months - 1 > std::numeric_limits<int32_t>::max()) {
+        corrupt("month span");
+    }
+    if (users > in.remaining() / 2 || (users > 0 && months == 0)) corrupt("user count");
+
+    ExpenseCube cube;
+    cube.first_month_ = first_month;
+    cube.months_ = months;
+    cube.user_ids_.reserve(users + 1);
+    cube.cells_.assign(static_cast<size_t>(months) * CATEGORY_COUNT, CubeCell());
+
+    const size_t plane = static_cast<size_t>(months) * CATEGORY_COUNT;
+    for (uint32_t u = 0; u < users; ++u) {
+        const int64_t id = detail::unzigzag(in.varint());
+        if (id == ALL_USERS || cube.slots_.count(id) != 0) corrupt("duplicate or reserved user id");
+        const size_t s = cube.slot(id);
+        const uint64_t filled = in.varint();
+        if (filled > plane) corrupt("cell count");
+
+        uint64_t next = 0;
+        for (uint64_t k = 0; k < filled; ++k) {
+            const uint64_t gap = in.varint();
+            if (gap >= plane - next) corrupt("cell index out of range");
+            const size_t index = static_cast<size_t>(next + gap);
+            CubeCell cell;
+            const uint64_t count = in.varint();
+            if (count == 0 || count > static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+                corrupt("cell expense count");
+            }
+            cell.count = static_cast<int64_t>(count);
+            cell.sum = detail::unzigzag(in.varint());
+            cell.sum_sq_lo = in.varint();
+            cell.sum_sq_hi = in.varint();
+            cube.cells_[s * plane + index] = cell;
+            cube.cells_[index] += cell;
+            next = index + 1;
+        }
+    }
+    if (in.remaining() != 0) corrupt("trailing bytes after the last user");
+    return cube;
+}
+
+void ExpenseCube::save(const std::string& path) const {
+    const std::string bytes = serialize();
+    std::FILE* stream = std::fopen(path.c_str(), "wb");
+    if (stream == nullptr) {
+        throw std::runtime_error("Cannot write cube file: " + path);
+    }
+    bool ok = std::fwrite(bytes.data(), 1, bytes.size(), stream) == bytes.size();
+    ok = std::fclose(stream) == 0 && ok;
+    if (!ok) {
+        throw std::runtime_error("Cannot write cube file: " + path);
+    }
+}
+
+ExpenseCube ExpenseCube::load(const std::string& path) {
+    MappedFile file(path);
+    return deserialize(file.data(), file.size());
+}
+
+} // namespace expense
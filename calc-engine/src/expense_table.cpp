@@ -0,0 +1,219 @@
+/**
+ * Expense Table Implementation
+ * 
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#include "expense_table.hpp"
+#include <algorithm>
+#include <charconv>
+#include <numeric>
+#include <stdexcept>
+
+namespace expense {
+
+namespace {
+
+const char* const CATEGORY_NAMES[CATEGORY_COUNT] = {
+    "FOOD", "TRANSPORT", "UTILITIES", "ENTERTAINMENT", "SHOPPING", "HEALTHCARE",
+    "EDUCATION", "TRAVEL", "GROCERIES", "SUBSCRIPTIONS", "RENT", "INSURANCE",
+    "SAVINGS", "OTHER"
+};
+
+/**
+ * Apply a row permutation to one column.
+ */
+template <typename T>
+void gather(std::vector<T>& column, const std::vector<size_t>& order) {
+    std::vector<T> reordered;
+    reordered.reserve(column.size());
+    for (size_t i : order) reordered.push_back(column[i]);
+    column.swap(reordered);
+}
+
+} // namespace
+
+// ==================== Categories ====================
+
+const char* category_name(Category category) {
+    size_t index = static_cast<size_t>(category);
+    return index < CATEGORY_COUNT ? CATEGORY_NAMES[index] : "OTHER";
+}
+
+Category parse_category(const std::string& name) {
+    for (size_t i = 0; i < CATEGORY_COUNT; ++i) {
+        if (name == CATEGORY_NAMES[i]) return static_cast<Category>(i);
+    }
+    throw std::invalid_argument("Unknown category: " + name);
+}
+
+// ==================== Dates ====================
+
+/*
+ * Howard Hinnant's days_from_civil / civil_from_days: exact for the whole
+ * proleptic Gregorian calendar using 400-year eras starting in March.
+ */
+int32_t days_from_civil(int year, unsigned month, unsigned day) {
+    year -= month <= 2;
+    const int era = (year >= 0 ? year : year - 399) / 400;
+    const unsigned yoe = static_cast<unsigned>(year - era * 400);
+    const unsigned doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return static_cast<int32_t>(era * 146097 + static_cast<int>(doe) - 719468);
+}
+
+void civil_from_days(int32_t days, int* year, unsigned* month, unsigned* day) {
+    const int z = days + 719468;
+    const int era = (z >= 0 ? z : z - 146096) / 146097;
+    const unsigned doe = static_cast<unsigned>(z - era * 146097);
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const unsigned mp = (5 * doy + 2) / 153;
+    const unsigned m = mp < 10 ? mp + 3 : mp - 9;
+    *year = static_cast<int>(yoe) + era * 400 + (m <= 2);
+    *month = m;
+    *day = doy - (153 * mp + 2) / 5 + 1;
+}
+
+int32_t parse_iso_date(const std::string& text) {
+    int year = 0;
+    unsigned month = 0, day = 0;
+    const char* p = text.data();
+    const char* end = p + text.size();
+    
+    bool ok = text.size() == 10 && text[4] == '-' && text[7] == '-';
+    ok = ok && std::from_chars(p, p + 4, year).ptr == p + 4;
+    ok = ok && std::from_chars(p + 5, p + 7, month).ptr == p + 7;
+    ok = ok && std::from_chars(p + 8, end, day).ptr == end;
+    ok = ok && month >= 1 && month <= 12 && day >= 1 && day <= 31;
+    if (ok) {
+        // Reject day overflow (e.g. 2023-02-30) by round-tripping
+        int y;
+        unsigned m, d;
+        civil_from_days(days_from_civil(year, month, day), &y, &m, &d);
+        ok = y == year && m == month && d == day;
+    }
+    if (!ok) {
+        throw std::invalid_argument("Invalid date (expected YYYY-MM-DD): " + text);
+    }
+    return days_from_civil(year, month, day);
+}
+
+// ==================== Dictionary ====================
+
+uint32_t StringDictionary::intern(const std::string& value) {
+    auto it = ids_.find(value);
+    if (it != ids_.end()) return it->second;
+    
+    uint32_t id = static_cast<uint32_t>(names_.size());
+    names_.push_back(value);
+    ids_.emplace(value, id);
+    return id;
+}
+
+// ==================== Table ====================
+
+void ExpenseTable::reserve(size_t rows) {
+    amounts_.reserve(rows);
+    dates_.reserve(rows);
+    categories_.reserve(rows);
+    merchant_ids_.reserve(rows);
+    payment_method_ids_.reserve(rows);
+    recurring_.reserve(rows);
+}
+
+void ExpenseTable::clear() {
+    amounts_.clear();
+    dates_.clear();
+    categories_.clear();
+    merchant_ids_.clear();
+    payment_method_ids_.clear();
+    recurring_.clear();
+    merchants_ = StringDictionary();
+    payment_methods_ = StringDictionary();
+    sorted_by_date_ = true;
+}
+
+void ExpenseTable::append(const ExpenseRecord& record) {
+    if (!dates_.empty() && record.date < dates_.back()) {
+        sorted_by_date_ = false;
+    }
+    amounts_.push_back(record.amount);
+    dates_.push_back(record.date);
+    categories_.push_back(static_cast<uint8_t>(record.category));
+    merchant_ids_.push_back(record.merchant);
+    payment_method_ids_.push_back(record.payment_method);
+    recurring_.push_back(record.recurring ? 1 : 0);
+}
+
+void ExpenseTable::append(double amount, int32_t date, Category category,
+                          const std::string& merchant, const std::string& payment_method,
+                          bool recurring) {
+    ExpenseRecord record;
+    record.amount = amount;
+    record.date = date;
+    record.category = category;
+    record.merchant = merchants_.intern(merchant);
+    record.payment_method = payment_methods_.intern(payment_method);
+    record.recurring = recurring;
+    append(record);
+}
+
+void ExpenseTable::append(const ExpenseTable& other) {
+    if (other.empty()) return;
+    
+    std::vector<uint32_t> merchant_ids(other.merchants_.size());
+    for (uint32_t id = 0; id < merchant_ids.size(); ++id) {
+        merchant_ids[id] = merchants_.intern(other.merchants_.name(id));
+    }
+    std::vector<uint32_t> payment_ids(other.payment_methods_.size());
+    for (uint32_t id = 0; id < payment_ids.size(); ++id) {
+        payment_ids[id] = payment_methods_.intern(other.payment_methods_.name(id));
+    }
+    
+    if (!other.sorted_by_date_ || (!dates_.empty() && other.dates_.front() < dates_.back())) {
+        sorted_by_date_ = false;
+    }
+    amounts_.insert(amounts_.end(), other.amounts_.begin(), other.amounts_.end());
+    dates_.insert(dates_.end(), other.dates_.begin(), other.dates_.end());
+    categories_.insert(categories_.end(), other.categories_.begin(), other.categories_.end());
+    recurring_.insert(recurring_.end(), other.recurring_.begin(), other.recurring_.end());
+    for (uint32_t id : other.merchant_ids_) {
+        merchant_ids_.push_back(id < merchant_ids.size() ? merchant_ids[id] : id);
+    }
+    for (uint32_t id : other.payment_method_ids_) {
+        payment_method_ids_.push_back(id < payment_ids.size() ? payment_ids[id] : id);
+    }
+}
+
+void ExpenseTable::sort_by_date() {
+    if (sorted_by_date_) return;
+    
+    std::vector<size_t> order(size());
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        return dates_[a] < dates_[b];
+    });
+    
+    gather(amounts_, order);
+    gather(dates_, order);
+    gather(categories_, order);
+    gather(merchant_ids_, order);
+    gather(payment_method_ids_, order);
+    gather(recurring_, order);
+    sorted_by_date_ = true;
+}
+
+ExpenseRecord ExpenseTable::row(size_t i) const {
+    ExpenseRecord record;
+    record.amount = amounts_.at(i);
+    record.date = dates_[i];
+    record.category = static_cast<Category>(categories_[i]);
+    record.merchant = merchant_ids_[i];
+    record.payment_method = payment_method_ids_[i];
+    record.recurring = recurring_[i] != 0;
+    return record;
+}
+
+} // namespace expense
@@ -0,0 +1,195 @@
+/**
+ * Group-By Implementation
+ *
+ * Pass 1 accumulates count/sum/min/max into an array indexed by code.
+ * When variance or quantiles are requested, pass 2 scatters the amounts
+ * into contiguous per-group runs (counting sort on the code, offsets from
+ * the pass-1 counts) so each group can use the SIMD deviation kernel and
+ * the multi-rank selection in StatisticsCalculator::quantiles.
+ *
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#include "group_by.hpp"
+#include "json_writer.hpp"
+#include "simd_kernels.hpp"
+#include "statistics.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <stdexcept>
+
+namespace expense {
+
+namespace {
+
+constexpr size_t MAX_GROUPS = 256;
+
+struct Accumulator {
+    size_t count = 0;
+    double sum = 0.0;
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+};
+
+} // namespace
+
+// ==================== Aggregation ====================
+
+GroupByResult group_by_category(const double* amounts, const uint8_t* codes, size_t n,
+                                size_t group_count, const GroupByOptions& options) {
+    if (group_count == 0 || group_count > MAX_GROUPS) {
+        throw std::invalid_argument("Group count must be between 1 and 256");
+    }
+    for (double p : options.percentiles) {
+        if (p < 0 || p > 100) {
+            throw std::invalid_argument("Percentile must be between 0 and 100");
+        }
+    }
+
+    // Pass 1: direct-indexed accumulators, no hashing
+    std::array<Accumulator, MAX_GROUPS> acc;
+    for (size_t i = 0; i < n; ++i) {
+        uint8_t code = codes[i];
+        if (code >= group_count) {
+            throw std::invalid_argument("Category code " + std::to_string(code) +
+                                        " out of range at index " + std::to_string(i));
+        }
+        Accumulator& a = acc[code];
+        double v = amounts[i];
+        ++a.count;
+        a.sum += v;
+        if (v < a.min) a.min = v;
+        if (v > a.max) a.max = v;
+    }
+
+    GroupByResult result;
+    result.groups.resize(group_count);
+    result.percentiles = options.percentiles;
+    result.has_variance = options.variance;
+    for (size_t g = 0; g < group_count; ++g) {
+        result.total += acc[g].sum;
+    }
+
+    for (size_t g = 0; g < group_count; ++g) {
+        const Accumulator& a = acc[g];
+        GroupStats& s = result.groups[g];
+        s.quantiles.assign(options.percentiles.size(), 0.0);
+        if (a.count == 0) continue;
+
+        s.count = a.count;
+        s.sum = a.sum;
+        s.mean = a.sum / static_cast<double>(a.count);
+        s.min = a.min;
+        s.max = a.max;
+        s.percentage = result.total > 0 ? (a.sum / result.total) * 100.0 : 0.0;
+    }
+
+    if (!options.variance && options.percentiles.empty()) {
+        return result;
+    }
+
+    // Pass 2: scatter into per-group runs
+    std::array<size_t, MAX_GROUPS + 1> offset{};
+    for (size_t g = 0; g < group_count; ++g) {
+        offset[g + 1] = offset[g] + acc[g].count;
+    }
+    std::vector<double> grouped(n);
+    std::array<size_t, MAX_GROUPS> cursor;
+    std::copy(offset.begin(), offset.begin() + group_count, cursor.begin());
+    for (size_t i = 0; i < n; ++i) {
+        grouped[cursor[codes[i]]++] = amounts[i];
+    }
+
+    for (size_t g = 0; g < group_count; ++g) {
+        GroupStats& s = result.groups[g];
+        if (s.count == 0) continue;
+        const double* run = grouped.data() + offset[g];
+
+        if (options.variance && s.count > 1) {
+            s.variance = kernels::sum_sq_dev(run, s.count, s.mean) / static_cast<double>(s.count);
+        }
+        if (!options.percentiles.empty()) {
+            s.quantiles = StatisticsCalculator::quantiles(run, s.count, options.percentiles);
+        }
+    }
+
+    return result;
+}
+
+GroupByResult group_by_category(const ExpenseTable& table, const GroupByOptions& options) {
+    ColumnView<double> amounts = table.amounts();
+    ColumnView<uint8_t> codes = table.categories();
+    return group_by_category(amounts.data, codes.data, amounts.size, CATEGORY_COUNT, options);
+}
+
+// ==================== Result Output ====================
+
+std::string GroupByResult::to_json() const {
+    JsonWriter out(256 + groups.size() * (160 + percentiles.size() * 16));
+    write_json(out);
+    return out.str();
+}
+
+void GroupByResult::write_json(JsonWriter& out) const {
+    out.raw("{\"total\":").number(total, 2);
+    out.raw(",\"categories\":{");
+    bool first = true;
+    for (size_t g = 0; g < groups.size(); ++g) {
+        const GroupStats& s = groups[g];
+        if (s.count == 0) continue;
+        if (!first) out.raw(',');
+        first = false;
+
+        if (g < CATEGORY_COUNT) {
+            out.string(category_name(static_cast<Category>(g)));
+        } else {
+            out.raw('"').integer(static_cast<unsigned long long>(g)).raw('"');
+        }
+        out.raw(":{\"total\":").number(s.sum, 2);
+        out.raw(",\"count\":").integer(static_cast<unsigned long long>(s.count));
+        out.raw(",\"average\":").number(s.mean, 2);
+        out.raw(",\"percentage\":").number(s.percentage, 2);
+        out.raw(",\"min\":").number(s.min, 2);
+        out.raw(",\"max\":").number(s.max, 2);
+        if (has_variance) {
+            out.raw(",\"variance\":").number(s.variance, 2);
+            out.raw(",\"stddev\":").number(std::sqrt(s.variance), 2);
+        }
+        if (!percentiles.empty()) {
+            out.raw(",\"percentiles\":{");
+            for (size_t i = 0; i < percentiles.size(); ++i) {
+                if (i > 0) out.raw(',');
+                // Full value, so p99 and p99.9 stay distinct keys
+                char key[32];
+                std::snprintf(key, sizeof(key), "\"p%.10g\":", percentiles[i]);
+                out.raw(key);
+                out.number(s.quantiles[i], 2);
+            }
+            out.raw('}');
+        }
+        out.raw('}');
+    }
+    out.raw("}}");
+}
+
+void GroupByResult::to_array(double* out) const {
+    for (const GroupStats& s : groups) {
+        out[0] = static_cast<double>(s.count);
+        out[1] = s.sum;
+        out[2] = s.mean;
+        out[3] = s.min;
+        out[4] = s.max;
+        out[5] = s.percentage;
+        out[6] = s.variance;
+        for (size_t i = 0; i < percentiles.size(); ++i) {
+            out[GroupStats::FIELD_COUNT + i] = s.quantiles[i];
+        }
+        out += stride();
+    }
+}
+
+} // namespace expense
@@ -0,0 +1,324 @@
+/**
+ * Amount Ingestion Implementation
+ * 
+ * Single pass over the buffer: skip whitespace, delimit a token, parse it
+ * with std::from_chars while tracking line/column for diagnostics.
+ * 
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#include "ingest.hpp"
+#include "expense_table.hpp"
+#include <charconv>
+#include <cmath>
+#include <system_error>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace expense {
+
+namespace {
+
+inline bool is_space(char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\f' || c == '\v';
+}
+
+/**
+ * Whitespace tokenizer that tracks the 1-based position of each token.
+ */
+class TokenCursor {
+public:
+    TokenCursor(const char* first, const char* last)
+        : p_(first), last_(last), line_start_(first) {}
+    
+    /**
+     * Advance to the next token; false at end of input.
+     */
+    bool next(const char*& tok_first, const char*& tok_last) {
+        while (p_ < last_ && is_space(*p_)) {
+            if (*p_ == '\n') {
+                ++line_;
+                line_start_ = p_ + 1;
+            }
+            ++p_;
+        }
+        if (p_ == last_) return false;
+        
+        tok_first = p_;
+        tok_line_ = line_;
+        tok_column_ = static_cast<size_t>(p_ - line_start_) + 1;
+        
+        while (p_ < last_ && !is_space(*p_)) ++p_;
+        tok_last = p_;
+        return true;
+    }
+    
+    size_t line() const { return tok_line_; }
+    size_t column() const { return tok_column_; }
+
+private:
+    const char* p_;
+    const char* last_;
+    const char* line_start_;
+    size_t line_ = 1;
+    size_t tok_line_ = 1;
+    size_t tok_column_ = 1;
+};
+
+bool parse_double(const char* first, const char* last, double& out) {
+    // from_chars rejects a leading '+', which iostreams accepted.
+    if (first < last && *first == '+') ++first;
+    auto res = std::from_chars(first, last, out);
+    return res.ec == std::errc() && res.ptr == last && std::isfinite(out);
+}
+
+/**
+ * Plain unsigned integer token (count header candidate).
+ */
+bool parse_count(const char* first, const char* last, size_t& out) {
+    unsigned long long value;
+    auto res = std::from_chars(first, last, value);
+    if (res.ec != std::errc() || res.ptr != last) return false;
+    out = static_cast<size_t>(value);
+    return true;
+}
+
+ParseError token_error(const std::string& what, const char* first, const char* last,
+                       const TokenCursor& cursor) {
+    return ParseError(what + " '" + std::string(first, last) + "' at line " +
+                      std::to_string(cursor.line()) + ", column " +
+                      std::to_string(cursor.column()),
+                      cursor.line(), cursor.column());
+}
+
+} // namespace
+
+ParseError::ParseError(const std::string& message, size_t line, size_t column)
+    : std::runtime_error(message), line_(line), column_(column) {}
+
+AmountBatch parse_amounts(const char* first, const char* last,
+                          bool exact, CountHeader header) {
+    AmountBatch batch;
+    TokenCursor cursor(first, last);
+    
+    const char* tok_first;
+    const char* tok_last;
+    
+    // Capacity guess: amounts are rarely shorter than 3 chars + newline.
+    batch.amounts.reserve(static_cast<size_t>(last - first) / 4 + 1);
+    
+    size_t declared = 0;
+    bool maybe_count = false;
+    
+    while (cursor.next(tok_first, tok_last)) {
+        double value;
+        if (!parse_double(tok_first, tok_last, value)) {
+            throw token_error("Invalid number", tok_first, tok_last, cursor);
+        }
+        
+        if (exact) {
+            try {
+                batch.exact.push_back(Money::parse(tok_first, tok_last));
+            } catch (const std::invalid_argument&) {
+                throw token_error("Invalid exact amount", tok_first, tok_last, cursor);
+            }
+        }
+        
+        if (batch.amounts.empty() && header == CountHeader::Auto) {
+            maybe_count = parse_count(tok_first, tok_last, declared);
+        }
+        batch.amounts.push_back(value);
+    }
+    
+    // Only an exact match is a count; "1500 200 300" is three amounts
+    if (maybe_count && declared == batch.amounts.size() - 1) {
+        batch.had_count = true;
+        batch.amounts.erase(batch.amounts.begin());
+        if (exact) batch.exact.erase(batch.exact.begin());
+    }
+    
+    return batch;
+}
+
+CategorizedBatch parse_categorized(const char* first, const char* last, CountHeader header) {
+    CategorizedBatch batch;
+    TokenCursor cursor(first, last);
+    
+    const char* tok_first;
+    const char* tok_last;
+    
+    // Capacity guess: "1.00 FOOD\n" is 10 chars.
+    size_t guess = static_cast<size_t>(last - first) / 10 + 1;
+    batch.amounts.reserve(guess);
+    batch.codes.reserve(guess);
+    
+    size_t declared = 0;
+    bool maybe_count = false;
+    size_t count_line = 0;
+    size_t count_column = 0;
+    bool expect_amount = true;
+    
+    while (cursor.next(tok_first, tok_last)) {
+        if (expect_amount) {
+            double value;
+            if (!parse_double(tok_first, tok_last, value)) {
+                throw token_error("Invalid number", tok_first, tok_last, cursor);
+            }
+            if (batch.amounts.empty() && header == CountHeader::Auto &&
+                parse_count(tok_first, tok_last, declared)) {
+                maybe_count = true;
+                count_line = cursor.line();
+                count_column = cursor.column();
+            }
+            batch.amounts.push_back(value);
+            expect_amount = false;
+            continue;
+        }
+        
+        Category category;
+        try {
+            category = parse_category(std::string(tok_first, tok_last));
+        } catch (const std::invalid_argument&) {
+            // "N <amount> <CATEGORY> ...": the first token was the count
+            double value;
+            if (maybe_count && batch.amounts.size() == 1 &&
+                parse_double(tok_first, tok_last, value)) {
+                batch.amounts[0] = value;
+                batch.had_count = true;
+                maybe_count = false;
+                continue;
+            }
+            throw token_error("Unknown category", tok_first, tok_last, cursor);
+        }
+        batch.codes.push_back(static_cast<uint8_t>(category));
+        maybe_count = false;
+        expect_amount = true;
+    }
+    
+    if (!expect_amount) {
+        throw ParseError("Missing category after the last amount",
+                         cursor.line(), cursor.column());
+    }
+    if (batch.had_count && declared != batch.amounts.size()) {
+        throw ParseError("Expected " + std::to_string(declared) + " pairs, found " +
+                         std::to_string(batch.amounts.size()) + " (count at line " +
+                         std::to_string(count_line) + ", column " +
+                         std::to_string(count_column) + ")",
+                         count_line, count_column);
+    }
+    
+    return batch;
+}
+
+SegmentedBatch parse_segmented(const char* first, const char* last) {
+    SegmentedBatch batch;
+    TokenCursor cursor(first, last);
+    
+    const char* tok_first;
+    const char* tok_last;
+    
+    batch.amounts.reserve(static_cast<size_t>(last - first) / 4 + 1);
+    batch.offsets.push_back(0);
+    
+    // Segment k is line k; close one segment per line boundary crossed
+    size_t line = 1;
+    while (cursor.next(tok_first, tok_last)) {
+        for (; line < cursor.line(); ++line) {
+            batch.offsets.push_back(batch.amounts.size());
+        }
+        double value;
+        if (!parse_double(tok_first, tok_last, value)) {
+            throw token_error("Invalid number", tok_first, tok_last, cursor);
+        }
+        batch.amounts.push_back(value);
+    }
+    if (!batch.amounts.empty()) {
+        batch.offsets.push_back(batch.amounts.size());
+    }
+    
+    return batch;
+}
+
+std::string read_stream(std::FILE* stream) {
+    std::string out;
+    const size_t block = 1 << 20;
+    size_t used = 0;
+    
+    for (;;) {
+        out.resize(used + block);
+        size_t got = std::fread(&out[used], 1, block, stream);
+        used += got;
+        if (got < block) break;
+    }
+    out.resize(used);
+    return out;
+}
+
+// ==================== Mapped File ====================
+
+#if !defined(_WIN32)
+
+MappedFile::MappedFile(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open input file: " + path);
+    }
+    
+    struct stat st;
+    if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+        void* addr = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr != MAP_FAILED) {
+            ::madvise(addr, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+            data_ = static_cast<const char*>(addr);
+            size_ = static_cast<size_t>(st.st_size);
+            mapped_ = true;
+        }
+    }
+    
+    if (!mapped_) {
+        // Empty files and non-mappable inputs (pipes, /dev/stdin)
+        std::FILE* stream = ::fdopen(fd, "rb");
+        if (stream == nullptr) {
+            ::close(fd);
+            throw std::runtime_error("Cannot read input file: " + path);
+        }
+        fallback_ = read_stream(stream);
+        std::fclose(stream);
+        data_ = fallback_.data();
+        size_ = fallback_.size();
+        return;
+    }
+    
+    ::close(fd);
+}
+
+MappedFile::~MappedFile() {
+    if (mapped_) {
+        ::munmap(const_cast<char*>(data_), size_);
+    }
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& path) {
+    std::FILE* stream = std::fopen(path.c_str(), "rb");
+    if (stream == nullptr) {
+        throw std::runtime_error("Cannot open input file: " + path);
+    }
+    fallback_ = read_stream(stream);
+    std::fclose(stream);
+    data_ = fallback_.data();
+    size_ = fallback_.size();
+}
+
+MappedFile::~MappedFile() = default;
+
+#endif
+
+} // namespace expense
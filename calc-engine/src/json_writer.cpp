@@ -0,0 +1,155 @@
+/**
+ * JSON Writer Implementation
+ *
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#include "json_writer.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <system_error>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace expense {
+
+namespace {
+
+// Longest fixed-notation double: 309 integer digits, sign, point, decimals
+constexpr size_t MAX_FIXED_CHARS = 330;
+
+bool write_all(int fd, const char* data, size_t length) {
+    while (length > 0) {
+#if defined(_WIN32)
+        int written = ::_write(fd, data, static_cast<unsigned>(std::min<size_t>(length, 1u << 30)));
+#else
+        ssize_t written = ::write(fd, data, length);
+#endif
+        if (written < 0 && errno == EINTR) continue;
+        if (written <= 0) return false;
+        data += written;
+        length -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+} // namespace
+
+// ==================== Construction ====================
+
+JsonWriter::JsonWriter(size_t capacity) : buffer_(std::max<size_t>(capacity, 64)) {}
+
+JsonWriter::JsonWriter(int fd, size_t capacity)
+    : buffer_(std::max<size_t>(capacity, MAX_FIXED_CHARS)), fd_(fd) {}
+
+JsonWriter JsonWriter::stream(int fd, size_t capacity) {
+    return JsonWriter(fd, capacity);
+}
+
+JsonWriter::JsonWriter(JsonWriter&& other) noexcept
+    : buffer_(std::move(other.buffer_)), size_(other.size_), fd_(other.fd_), ok_(other.ok_) {
+    other.size_ = 0;
+    other.fd_ = -1;
+}
+
+JsonWriter::~JsonWriter() {
+    flush();
+}
+
+// ==================== Buffer Control ====================
+
+void JsonWriter::reserve(size_t bytes) {
+    if (!streaming() && buffer_.size() - size_ < bytes) {
+        buffer_.resize(size_ + bytes);
+    }
+}
+
+bool JsonWriter::flush() {
+    if (streaming() && size_ > 0) {
+        if (ok_) ok_ = write_all(fd_, buffer_.data(), size_);
+        size_ = 0;
+    }
+    return ok_;
+}
+
+char* JsonWriter::ensure(size_t bytes) {
+    if (buffer_.size() - size_ < bytes) {
+        if (streaming()) flush();
+        if (buffer_.size() - size_ < bytes) {
+            buffer_.resize(std::max(buffer_.size() * 2, size_ + bytes));
+        }
+    }
+    return buffer_.data() + size_;
+}
+
+// ==================== Emitters ====================
+
+JsonWriter& JsonWriter::raw(const char* text, size_t length) {
+    if (streaming() && length > buffer_.size()) {
+        // Larger than the staging buffer: bypass it
+        flush();
+        if (ok_) ok_ = write_all(fd_, text, length);
+        return *this;
+    }
+    std::memcpy(ensure(length), text, length);
+    size_ += length;
+    return *this;
+}
+
+JsonWriter& JsonWriter::raw(char c) {
+    *ensure(1) = c;
+    ++size_;
+    return *this;
+}
+
+JsonWriter& JsonWriter::number(double value, int precision) {
+    char* first = ensure(MAX_FIXED_CHARS + static_cast<size_t>(std::max(precision, 0)));
+    char* last = buffer_.data() + buffer_.size();
+    auto result = std::to_chars(first, last, value, std::chars_format::fixed, precision);
+    size_ += static_cast<size_t>(result.ptr - first);
+    return *this;
+}
+
+JsonWriter& JsonWriter::integer(long long value) {
+    char* first = ensure(24);
+    auto result = std::to_chars(first, first + 24, value);
+    size_ += static_cast<size_t>(result.ptr - first);
+    return *this;
+}
+
+JsonWriter& JsonWriter::integer(unsigned long long value) {
+    char* first = ensure(24);
+    auto result = std::to_chars(first, first + 24, value);
+    size_ += static_cast<size_t>(result.ptr - first);
+    return *this;
+}
+
+JsonWriter& JsonWriter::string(const char* text, size_t length) {
+    static const char HEX[] = "0123456789abcdef";
+    raw('"');
+    const char* run = text;
+    const char* end = text + length;
+    for (const char* p = text; p < end; ++p) {
+        unsigned char c = static_cast<unsigned char>(*p);
+        if (c != '"' && c != '\\' && c >= 0x20) continue;
+        raw(run, static_cast<size_t>(p - run));
+        run = p + 1;
+        if (c == '"' || c == '\\') {
+            char escaped[2] = {'\\', static_cast<char>(c)};
+            raw(escaped, 2);
+        } else {
+            char escaped[6] = {'\\', 'u', '0', '0', HEX[c >> 4], HEX[c & 0xF]};
+            raw(escaped, 6);
+        }
+    }
+    raw(run, static_cast<size_t>(end - run));
+    return raw('"');
+}
+
+} // namespace expense
@@ -0,0 +1,36 @@
+/**
+ * AVX2 Reduction Kernels
+ * 
+ * 4 doubles per register, 4 registers per 16-lane block.
+ * Compiled with -mavx2; only reached after CPUID confirms support.
+ */
+
+#include "lane_kernels.hpp"
+#include <immintrin.h>
+
+namespace expense {
+namespace kernels {
+
+namespace {
+
+struct Avx2Vec {
+    using type = __m256d;
+    static constexpr size_t WIDTH = 4;
+    
+    static type zero() { return _mm256_setzero_pd(); }
+    static type set1(double v) { return _mm256_set1_pd(v); }
+    static type load(const double* p) { return _mm256_loadu_pd(p); }
+    static void store(double* p, type v) { _mm256_storeu_pd(p, v); }
+    static type add(type a, type b) { return _mm256_add_pd(a, b); }
+    static type sub(type a, type b) { return _mm256_sub_pd(a, b); }
+    static type mul(type a, type b) { return _mm256_mul_pd(a, b); }
+    static type min(type a, type b) { return _mm256_min_pd(a, b); }
+    static type max(type a, type b) { return _mm256_max_pd(a, b); }
+};
+
+} // namespace
+
+const KernelTable AVX2_KERNELS = LaneKernels<Avx2Vec>::make_table();
+
+} // namespace kernels
+} // namespace expense
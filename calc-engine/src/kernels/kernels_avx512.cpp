@@ -0,0 +1,41 @@
+/**
+ * AVX-512 Reduction Kernels
+ * 
+ * 8 doubles per register, 2 registers per 16-lane block.
+ * Compiled with -mavx512f; only reached after CPUID confirms support.
+ */
+
+#include "lane_kernels.hpp"
+#include <immintrin.h>
+
+namespace expense {
+namespace kernels {
+
+namespace {
+
+struct Avx512Vec {
+    using type = __m512d;
+    static constexpr size_t WIDTH = 8;
+    static constexpr __mmask8 ALL_LANES = 0xFF;
+    
+    static type zero() { return _mm512_setzero_pd(); }
+    static type set1(double v) { return _mm512_set1_pd(v); }
+    static type load(const double* p) { return _mm512_loadu_pd(p); }
+    static void store(double* p, type v) { _mm512_storeu_pd(p, v); }
+    static type add(type a, type b) { return _mm512_add_pd(a, b); }
+    static type sub(type a, type b) { return _mm512_sub_pd(a, b); }
+    static type mul(type a, type b) { return _mm512_mul_pd(a, b); }
+    // Full-mask forms: same instruction, but GCC's unmasked _mm512_min_pd /
+    // _mm512_max_pd pass an _mm512_undefined_pd() source that trips
+    // -Wmaybe-uninitialized
+    static type min(type a, type b) { return _mm512_mask_min_pd(a, ALL_LANES, a, b); }
+    static type max(type a, type b) { return _mm512_mask_max_pd(a, ALL_LANES, a, b); }
+
+};
+
+} // namespace
+
+const KernelTable AVX512_KERNELS = LaneKernels<Avx512Vec>::make_table();
+
+} // namespace kernels
+} // namespace expense
@@ -0,0 +1,34 @@
+/**
+ * Scalar Reduction Kernels
+ * 
+ * Portable reference variant; always available.
+ */
+
+#include "lane_kernels.hpp"
+
+namespace expense {
+namespace kernels {
+
+namespace {
+
+struct ScalarVec {
+    using type = double;
+    static constexpr size_t WIDTH = 1;
+    
+    static type zero() { return 0.0; }
+    static type set1(double v) { return v; }
+    static type load(const double* p) { return *p; }
+    static void store(double* p, type v) { *p = v; }
+    static type add(type a, type b) { return a + b; }
+    static type sub(type a, type b) { return a - b; }
+    static type mul(type a, type b) { return a * b; }
+    static type min(type a, type b) { return b < a ? b : a; }
+    static type max(type a, type b) { return b > a ? b : a; }
+};
+
+} // namespace
+
+const KernelTable SCALAR_KERNELS = LaneKernels<ScalarVec>::make_table();
+
+} // namespace kernels
+} // namespace expense
@@ -0,0 +1,35 @@
+/**
+ * SSE2 Reduction Kernels
+ * 
+ * 2 doubles per register, 8 registers per 16-lane block.
+ */
+
+#include "lane_kernels.hpp"
+#include <emmintrin.h>
+
+namespace expense {
+namespace kernels {
+
+namespace {
+
+struct Sse2Vec {
+    using type = __m128d;
+    static constexpr size_t WIDTH = 2;
+    
+    static type zero() { return _mm_setzero_pd(); }
+    static type set1(double v) { return _mm_set1_pd(v); }
+    static type load(const double* p) { return _mm_loadu_pd(p); }
+    static void store(double* p, type v) { _mm_storeu_pd(p, v); }
+    static type add(type a, type b) { return _mm_add_pd(a, b); }
+    static type sub(type a, type b) { return _mm_sub_pd(a, b); }
+    static type mul(type a, type b) { return _mm_mul_pd(a, b); }
+    static type min(type a, type b) { return _mm_min_pd(a, b); }
+    static type max(type a, type b) { return _mm_max_pd(a, b); }
+};
+
+} // namespace
+
+const KernelTable SSE2_KERNELS = LaneKernels<Sse2Vec>::make_table();
+
+} // namespace kernels
+} // namespace expense
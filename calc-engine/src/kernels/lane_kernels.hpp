@@ -0,0 +1,333 @@
+/**
+ * Lane Kernels (private)
+ * 
+ * ISA-independent reduction loops, instantiated once per instruction set
+ * with a vector policy V providing:
+ *   type, WIDTH, zero(), set1(), load(), store(), add(), sub(), mul(),
+ *   min(), max()
+ * 
+ * Every instantiation accumulates into LANES logical lanes and combines
+ * them with the same pairwise tree, so results do not depend on WIDTH.
+ * The compensated and binned kernels pad the last partial block with
+ * zero terms instead of running a scalar tail.
+ * 
+ * Each per-ISA translation unit defines its policy in an unnamed
+ * namespace, which gives every instantiation internal linkage. That keeps
+ * the linker from merging an AVX-512 copy into a scalar caller. For the
+ * same reason nothing here calls into the standard library.
+ */
+
+#ifndef EXPENSE_LANE_KERNELS_HPP
+#define EXPENSE_LANE_KERNELS_HPP
+
+#include "simd_kernels.hpp"
+
+namespace expense {
+namespace kernels {
+
+template <typename V>
+struct LaneKernels {
+    static constexpr size_t LANES = 16;
+    static constexpr size_t REGS = LANES / V::WIDTH;
+    
+    using Vec = typename V::type;
+    
+    static void spill(const Vec* acc, double* lanes) {
+        for (size_t r = 0; r < REGS; ++r) {
+            V::store(lanes + r * V::WIDTH, acc[r]);
+        }
+    }
+    
+    /**
+     * Fixed pairwise combine: 16 -> 8 -> 4 -> 2 -> 1.
+     */
+    static double reduce(double* lanes) {
+        for (size_t width = LANES / 2; width > 0; width /= 2) {
+            for (size_t k = 0; k < width; ++k) {
+                lanes[k] += lanes[k + width];
+            }
+        }
+        return lanes[0];
+    }
+    
+    static double sum(const double* data, size_t n) {
+        Vec acc[REGS];
+        for (size_t r = 0; r < REGS; ++r) acc[r] = V::zero();
+        
+        size_t i = 0;
+        for (; i + LANES <= n; i += LANES) {
+            for (size_t r = 0; r < REGS; ++r) {
+                acc[r] = V::add(acc[r], V::load(data + i + r * V::WIDTH));
+            }
+        }
+        
+        double lanes[LANES];
+        spill(acc, lanes);
+        for (size_t k = 0; i < n; ++i, ++k) {
+            lanes[k] += data[i];
+        }
+        return reduce(lanes);
+    }
+    
+    static double sum_sq_dev(const double* data, size_t n, double center) {
+        Vec acc[REGS];
+        for (size_t r = 0; r < REGS; ++r) acc[r] = V::zero();
+        const Vec c = V::set1(center);
+        
+        size_t i = 0;
+        for (; i + LANES <= n; i += LANES) {
+            for (size_t r = 0; r < REGS; ++r) {
+                Vec d = V::sub(V::load(data + i + r * V::WIDTH), c);
+                acc[r] = V::add(acc[r], V::mul(d, d));
+            }
+        }
+        
+        double lanes[LANES];
+        spill(acc, lanes);
+        for (size_t k = 0; i < n; ++i, ++k) {
+            double d = data[i] - center;
+            lanes[k] += d * d;
+        }
+        return reduce(lanes);
+    }
+    
+    static void min_max(const double* data, size_t n, double* out_min, double* out_max) {
+        Vec lo[REGS];
+        Vec hi[REGS];
+        for (size_t r = 0; r < REGS; ++r) {
+            lo[r] = hi[r] = V::set1(data[0]);
+        }
+        
+        size_t i = 0;
+        for (; i + LANES <= n; i += LANES) {
+            for (size_t r = 0; r < REGS; ++r) {
+                Vec v = V::load(data + i + r * V::WIDTH);
+                lo[r] = V::min(lo[r], v);
+                hi[r] = V::max(hi[r], v);
+            }
+        }
+        
+        double lo_lanes[LANES];
+        double hi_lanes[LANES];
+        spill(lo, lo_lanes);
+        spill(hi, hi_lanes);
+        
+        double mn = lo_lanes[0];
+        double mx = hi_lanes[0];
+        for (size_t k = 1; k < LANES; ++k) {
+            if (lo_lanes[k] < mn) mn = lo_lanes[k];
+            if (hi_lanes[k] > mx) mx = hi_lanes[k];
+        }
+        for (; i < n; ++i) {
+            if (data[i] < mn) mn = data[i];
+            if (data[i] > mx) mx = data[i];
+        }
+        *out_min = mn;
+        *out_max = mx;
+    }
+    
+    static double dot(const double* x, const double* y, size_t n) {
+        Vec acc[REGS];
+        for (size_t r = 0; r < REGS; ++r) acc[r] = V::zero();
+        
+        size_t i = 0;
+        for (; i + LANES <= n; i += LANES) {
+            for (size_t r = 0; r < REGS; ++r) {
+                size_t off = i + r * V::WIDTH;
+                acc[r] = V::add(acc[r], V::mul(V::load(x + off), V::load(y + off)));
+            }
+        }
+        
+        double lanes[LANES];
+        spill(acc, lanes);
+        for (size_t k = 0; i < n; ++i, ++k) {
+            lanes[k] += x[i] * y[i];
+        }
+        return reduce(lanes);
+    }
+    
+    static void co_moments(const double* x, const double* y, size_t n,
+                           double mean_x, double mean_y,
+                           double* out_sxx, double* out_syy, double* out_sxy) {
+        Vec sxx[REGS];
+        Vec syy[REGS];
+        Vec sxy[REGS];
+        for (size_t r = 0; r < REGS; ++r) {
+            sxx[r] = syy[r] = sxy[r] = V::zero();
+        }
+        const Vec mx = V::set1(mean_x);
+        const Vec my = V::set1(mean_y);
+        
+        size_t i = 0;
+        for (; i + LANES <= n; i += LANES) {
+            for (size_t r = 0; r < REGS; ++r) {
+                size_t off = i + r * V::WIDTH;
+                Vec dx = V::sub(V::load(x + off), mx);
+                Vec dy = V::sub(V::load(y + off), my);
+                sxx[r] = V::add(sxx[r], V::mul(dx, dx));
+                syy[r] = V::add(syy[r], V::mul(dy, dy));
+                sxy[r] = V::add(sxy[r], V::mul(dx, dy));
+            }
+        }
+        
+        double lxx[LANES];
+        double lyy[LANES];
+        double lxy[LANES];
+        spill(sxx, lxx);
+        spill(syy, lyy);
+        spill(sxy, lxy);
+        for (size_t k = 0; i < n; ++i, ++k) {
+            double dx = x[i] - mean_x;
+            double dy = y[i] - mean_y;
+            lxx[k] += dx * dx;
+            lyy[k] += dy * dy;
+            lxy[k] += dx * dy;
+        }
+        *out_sxx = reduce(lxx);
+        *out_syy = reduce(lyy);
+        *out_sxy = reduce(lxy);
+    }
+    
+    // ==================== Compensated and Binned Sums ====================
+    
+    /**
+     * One register of terms: the values themselves, or their squared
+     * deviations from center when SQ_DEV.
+     */
+    template <bool SQ_DEV>
+    static Vec term(const double* p, Vec center) {
+        Vec v = V::load(p);
+        if (!SQ_DEV) return v;
+        Vec d = V::sub(v, center);
+        return V::mul(d, d);
+    }
+    
+    /**
+     * Call step(r, terms) for register r of every 16-lane block. The last
+     * partial block is padded with elements whose term is exactly zero,
+     * so element i always lands in lane i % 16.
+     */
+    template <bool SQ_DEV, typename Step>
+    static void for_each_block(const double* data, size_t n, double center, Step step) {
+        const Vec c = V::set1(center);
+        
+        size_t i = 0;
+        for (; i + LANES <= n; i += LANES) {
+            for (size_t r = 0; r < REGS; ++r) {
+                step(r, term<SQ_DEV>(data + i + r * V::WIDTH, c));
+            }
+        }
+        if (i == n) return;
+        
+        double tail[LANES];
+        for (size_t k = 0; k < LANES; ++k) {
+            tail[k] = i + k < n ? data[i + k] : (SQ_DEV ? center : 0.0);
+        }
+        for (size_t r = 0; r < REGS; ++r) {
+            step(r, term<SQ_DEV>(tail + r * V::WIDTH, c));
+        }
+    }
+    
+    /**
+     * Neumaier-style compensated sum. Each lane keeps a running sum and
+     * the exact rounding error of every addition (branch-free TwoSum, so
+     * it vectorizes); the lane tree carries its own errors the same way.
+     */
+    template <bool SQ_DEV>
+    static double compensated(const double* data, size_t n, double center) {
+        Vec acc[REGS];
+        Vec comp[REGS];
+        for (size_t r = 0; r < REGS; ++r) acc[r] = comp[r] = V::zero();
+        
+        for_each_block<SQ_DEV>(data, n, center, [&](size_t r, Vec x) {
+            Vec t = V::add(acc[r], x);
+            Vec bp = V::sub(t, acc[r]);
+            Vec err = V::add(V::sub(acc[r], V::sub(t, bp)), V::sub(x, bp));
+            acc[r] = t;
+            comp[r] = V::add(comp[r], err);
+        });
+        
+        double lanes[LANES];
+        double errs[LANES];
+        spill(acc, lanes);
+        spill(comp, errs);
+        for (size_t width = LANES / 2; width > 0; width /= 2) {
+            for (size_t k = 0; k < width; ++k) {
+                double a = lanes[k];
+                double b = lanes[k + width];
+                double t = a + b;
+                double bp = t - a;
+                lanes[k] = t;
+                errs[k] += errs[k + width] + ((a - (t - bp)) + (b - bp));
+            }
+        }
+        return lanes[0] + errs[0];
+    }
+    
+    static double compensated_sum(const double* data, size_t n) {
+        return compensated<false>(data, n, 0.0);
+    }
+    
+    static double compensated_sum_sq_dev(const double* data, size_t n, double center) {
+        return compensated<true>(data, n, center);
+    }
+    
+    /**
+     * Binned sum: fold f rounds each term to a multiple of ulp(sigma[f])
+     * via (sigma + x) - sigma, adds that part to bin f and passes the
+     * exact remainder on to fold f + 1. With sigma chosen by the caller
+     * every bin addition is exact, so bins do not depend on order.
+     */
+    template <bool SQ_DEV>
+    static void binned(const double* data, size_t n, double center,
+                       const double* sigma, double* out_bins) {
+        Vec acc[BINNED_FOLDS][REGS];
+        Vec sig[BINNED_FOLDS];
+        for (size_t f = 0; f < BINNED_FOLDS; ++f) {
+            sig[f] = V::set1(sigma[f]);
+            for (size_t r = 0; r < REGS; ++r) acc[f][r] = V::zero();
+        }
+        
+        for_each_block<SQ_DEV>(data, n, center, [&](size_t r, Vec x) {
+            for (size_t f = 0; f < BINNED_FOLDS; ++f) {
+                Vec q = V::sub(V::add(sig[f], x), sig[f]);
+                acc[f][r] = V::add(acc[f][r], q);
+                x = V::sub(x, q);
+            }
+        });
+        
+        double lanes[LANES];
+        for (size_t f = 0; f < BINNED_FOLDS; ++f) {
+            spill(acc[f], lanes);
+            out_bins[f] = reduce(lanes);
+        }
+    }
+    
+    static void binned_sum(const double* data, size_t n, const double* sigma, double* out_bins) {
+        binned<false>(data, n, 0.0, sigma, out_bins);
+    }
+    
+    static void binned_sum_sq_dev(const double* data, size_t n, double center,
+                                  const double* sigma, double* out_bins) {
+        binned<true>(data, n, center, sigma, out_bins);
+    }
+    
+    static constexpr KernelTable make_table() {
+        return KernelTable{&sum, &sum_sq_dev, &min_max, &dot, &co_moments,
+                           &compensated_sum, &compensated_sum_sq_dev,
+                           &binned_sum, &binned_sum_sq_dev};
+    }
+};
+
+// Per-ISA tables, defined in kernels_<isa>.cpp
+extern const KernelTable SCALAR_KERNELS;
+#if defined(EXPENSE_X86_KERNELS)
+extern const KernelTable SSE2_KERNELS;
+extern const KernelTable AVX2_KERNELS;
+extern const KernelTable AVX512_KERNELS;
+#endif
+
+} // namespace kernels
+} // namespace expense
+
+#endif // EXPENSE_LANE_KERNELS_HPP
@@ -6,10 +6,20 @@
  * 
  * Usage:
  *   calc_engine < input.txt
+ *   calc_engine --input amounts.txt
  *   echo "5\n10.5\n20.0\n15.0\n30.0\n25.0" | calc_engine
+ *   calc_engine --serve /tmp/calc_engine.sock --workers 8
+ *   printf "250 FOOD\n1200 RENT\n" | calc_engine --group-by
+ *   calc_engine --rolling 7,30,90 < input.txt
+ *   calc_engine --batch --input users.txt    (one user's amounts per line)
+ *   calc_engine --batch --threads 8 --pin-threads --input users.txt
+ *   calc_engine --csv --group-by --input expenses.csv
+ *   calc_engine --convert expenses.snap --input expenses.csv
+ *   calc_engine --snapshot --group-by --input expenses.snap
+ *   calc_engine --snapshot --date-range 2024-01-01,2024-03-31 --input expenses.snap
  * 
  * Input Format:
- *   First line: number of values
+ *   Optional first line: number of values
  *   Following lines: one value per line
  * 
  * Output Format:
@@ -19,66 +29,117 @@
  * @version 1.0.0
  */
 
-#include "statistics.hpp"
+#include "csv_ingest.hpp"
+#include "ingest.hpp"
+#include "request_handler.hpp"
+#include "server.hpp"
+#include "snapshot.hpp"
+#include "thread_pool.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
 #include <iostream>
-#include <vector>
+#include <memory>
 #include <string>
-#include <sstream>
+#include <vector>
 
 using namespace expense;
 
+namespace {
+constexpr int STDOUT_FD = 1;
+
+/**
+ * Parse a comma-separated list of positive window sizes ("7,30,90").
+ */
+bool parse_windows(const std::string& text, std::vector<int>& windows) {
+    size_t pos = 0;
+    while (pos <= text.size()) {
+        size_t comma = text.find(',', pos);
+        if (comma == std::string::npos) comma = text.size();
+        std::string item = text.substr(pos, comma - pos);
+        char* end = nullptr;
+        long w = std::strtol(item.c_str(), &end, 10);
+        if (item.empty() || *end != '\0' || w <= 0 || w > 1000000) return false;
+        windows.push_back(static_cast<int>(w));
+        pos = comma + 1;
+    }
+    return !windows.empty();
+}
+
+/**
+ * Parse "FROM,TO" ISO dates into epoch days.
+ */
+bool parse_date_range(const std::string& text, int32_t* from, int32_t* to) {
+    size_t comma = text.find(',');
+    if (comma == std::string::npos) return false;
+    try {
+        *from = parse_iso_date(text.substr(0, comma));
+        *to = parse_iso_date(text.substr(comma + 1));
+    } catch (const std::invalid_argument&) {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Parse a CSV export, write it as a snapshot and report the file's
+ * footer totals (read back from the written file).
+ */
+void convert_to_snapshot(const char* first, const char* last, const std::string& path,
+                         JsonWriter& out) {
+    write_snapshot(parse_expense_csv(first, last), path);
+    SnapshotReader snapshot(path);
+    SnapshotChunk total = snapshot.summary();
+    out.raw("{\"success\":true,\"snapshot\":").string(path);
+    out.raw(",\"rows\":").integer(static_cast<unsigned long long>(total.rows));
+    out.raw(",\"chunks\":").integer(static_cast<unsigned long long>(snapshot.chunk_count()));
+    out.raw(",\"total\":").number(static_cast<double>(total.amount_sum) / 100.0, 2);
+    out.raw("}\n");
+}
+} // namespace
+
 void print_usage() {
     std::cerr << "Expense Calculator v1.0.0\n";
     std::cerr << "Usage: calc_engine [options]\n";
     std::cerr << "\nOptions:\n";
     std::cerr << "  --help        Show this help message\n";
     std::cerr << "  --version     Show version information\n";
+    std::cerr << "  --exact       Parse amounts as exact 2-decimal values (paise)\n";
+    std::cerr << "  --input FILE  Read amounts from FILE (memory-mapped) instead of stdin\n";
+    std::cerr << "  --no-count    Input has no count line; every token is an amount\n";
+    std::cerr << "  --group-by    Input is \"amount CATEGORY\" pairs; output per-category breakdown\n";
+    std::cerr << "  --batch       One segment (e.g. user) of amounts per line; stats per segment\n";
+    std::cerr << "  --csv         Input is an expense CSV export (Amount/Category/Date columns)\n";
+    std::cerr << "  --snapshot    Input is a binary snapshot written by --convert\n";
+    std::cerr << "  --convert OUT Write the CSV export input to OUT as a binary snapshot\n";
+    std::cerr << "  --date-range FROM,TO  With --csv/--snapshot: total of expenses dated FROM..TO\n";
+    std::cerr << "  --rolling LIST  Add rolling mean/stddev/min/max per comma-separated window\n";
+    std::cerr << "  --threads N   Threads for parallel batch work (default: CPU count)\n";
+    std::cerr << "  --pin-threads Pin parallel worker threads to CPUs (Linux)\n";
+    std::cerr << "  --serve PATH  Run as a daemon on a Unix domain socket\n";
+    std::cerr << "  --workers N   Worker threads for --serve (default: CPU count)\n";
     std::cerr << "\nInput Format:\n";
-    std::cerr << "  First line: number of values (N)\n";
-    std::cerr << "  Next N lines: expense amounts (one per line)\n";
+    std::cerr << "  Optional first line: number of values (N)\n";
+    std::cerr << "  Then: expense amounts (one per line)\n";
     std::cerr << "\nOutput: JSON object with statistics\n";
+    std::cerr << "\nServer frames: 4-byte big-endian length + payload, both directions\n";
 }
 
 void print_version() {
     std::cout << "{\"name\":\"ExpenseCalculator\",\"version\":\"1.0.0\"}\n";
 }
 
-std::string create_json_output(
-    const StatisticsResult& stats,
-    const MovingAverageResult& sma,
-    const MovingAverageResult& ema,
-    const std::vector<size_t>& outliers) {
-    
-    std::ostringstream oss;
-    oss << std::fixed << std::setprecision(2);
-    
-    oss << "{\n";
-    oss << "  \"success\": true,\n";
-    oss << "  \"statistics\": " << stats.to_json() << ",\n";
-    oss << "  \"simple_moving_average\": " << sma.to_json() << ",\n";
-    oss << "  \"exponential_moving_average\": " << ema.to_json() << ",\n";
-    oss << "  \"outliers\": [";
-    for (size_t i = 0; i < outliers.size(); ++i) {
-        if (i > 0) oss << ",";
-        oss << outliers[i];
-    }
-    oss << "],\n";
-    oss << "  \"outlier_count\": " << outliers.size() << "\n";
-    oss << "}\n";
-    
-    return oss.str();
-}
-
-std::string create_error_json(const std::string& message) {
-    std::ostringstream oss;
-    oss << "{\"success\":false,\"error\":\"" << message << "\"}\n";
-    return oss.str();
-}
-
 int main(int argc, char* argv[]) {
+    RequestOptions request;
+    ServerOptions server;
+    bool serve = false;
+    std::string input_path;
+    std::string convert_path;
+    ThreadPoolOptions pool;
+    
     // Check for command line arguments
-    if (argc > 1) {
-        std::string arg = argv[1];
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
         if (arg == "--help" || arg == "-h") {
             print_usage();
             return 0;
@@ -87,52 +148,81 @@ int main(int argc, char* argv[]) {
             print_version();
             return 0;
         }
+        if (arg == "--exact") {
+            request.exact = true;
+        } else if (arg == "--group-by") {
+            request.group_by = true;
+        } else if (arg == "--batch") {
+            request.batch = true;
+        } else if (arg == "--csv") {
+            request.csv = true;
+        } else if (arg == "--snapshot") {
+            request.snapshot = true;
+        } else if (arg == "--date-range" && i + 1 < argc) {
+            request.date_range = true;
+            if (!parse_date_range(argv[++i], &request.date_from, &request.date_to)) {
+                std::cerr << "Invalid date range: " << argv[i] << "\n";
+                return 1;
+            }
+        } else if (arg == "--convert" && i + 1 < argc) {
+            convert_path = argv[++i];
+        } else if (arg == "--rolling" && i + 1 < argc) {
+            if (!parse_windows(argv[++i], request.rolling_windows)) {
+                std::cerr << "Invalid window list: " << argv[i] << "\n";
+                return 1;
+            }
+        } else if (arg == "--threads" && i + 1 < argc) {
+            pool.threads = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--pin-threads") {
+            pool.pin_threads = true;
+        } else if (arg == "--no-count") {
+            request.count_header = CountHeader::None;
+        } else if (arg == "--input" && i + 1 < argc) {
+            input_path = argv[++i];
+        } else if (arg == "--serve" && i + 1 < argc) {
+            serve = true;
+            server.socket_path = argv[++i];
+        } else if (arg == "--workers" && i + 1 < argc) {
+            server.workers = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        } else {
+            std::cerr << "Unknown option: " << arg << "\n";
+            print_usage();
+            return 1;
+        }
     }
     
+    // Before anything touches ThreadPool::shared()
+    ThreadPool::configure_shared(pool);
+    
+    if (serve) {
+        server.request = request;
+        return run_server(server);
+    }
+    
+    // Stream the response straight to stdout; long SMA/EMA arrays are
+    // flushed in fixed-size chunks rather than built as one string
+    JsonWriter out = JsonWriter::stream(STDOUT_FD);
+    bool success = false;
     try {
-        // Read number of values
-        int n;
-        if (!(std::cin >> n)) {
-            std::cout << create_error_json("Failed to read number of values");
-            return 1;
+        std::unique_ptr<MappedFile> file;
+        std::string input;
+        if (!input_path.empty()) {
+            file.reset(new MappedFile(input_path));
+        } else {
+            input = read_stream(stdin);
         }
-        
-        if (n <= 0) {
-            std::cout << create_error_json("Number of values must be positive");
-            return 1;
+        const char* first = file ? file->data() : input.data();
+        const char* last = first + (file ? file->size() : input.size());
+        if (!convert_path.empty()) {
+            convert_to_snapshot(first, last, convert_path, out);
+            success = true;
+        } else {
+            success = handle_request(first, last, request, out);
         }
-        
-        // Read values
-        std::vector<double> amounts;
-        amounts.reserve(n);
-        
-        for (int i = 0; i < n; ++i) {
-            double value;
-            if (!(std::cin >> value)) {
-                std::cout << create_error_json("Failed to read value at index " + std::to_string(i));
-                return 1;
-            }
-            amounts.push_back(value);
-        }
-        
-        // Calculate statistics
-        StatisticsResult stats = StatisticsCalculator::calculate_all(amounts);
-        
-        // Calculate moving averages (window size = min(7, n))
-        int window = std::min(7, n);
-        MovingAverageResult sma = StatisticsCalculator::moving_average(amounts, window);
-        MovingAverageResult ema = StatisticsCalculator::exponential_moving_average(amounts, 0.3);
-        
-        // Detect outliers
-        std::vector<size_t> outliers = StatisticsCalculator::detect_outliers(amounts);
-        
-        // Output JSON result
-        std::cout << create_json_output(stats, sma, ema, outliers);
-        
-        return 0;
-        
     } catch (const std::exception& e) {
-        std::cout << create_error_json(e.what());
-        return 1;
+        write_error_json(out, e.what());
     }
+    
+    if (!out.flush()) return 1;
+    return success ? 0 : 1;
 }
@@ -0,0 +1,85 @@
+/**
+ * Money Type Implementation
+ * 
+ * Exact decimal parsing and formatting for paise amounts.
+ * 
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#include "money.hpp"
+#include <limits>
+#include <stdexcept>
+
+namespace expense {
+
+Money Money::parse(const std::string& text) {
+    return parse(text.data(), text.data() + text.size());
+}
+
+Money Money::parse(const char* first, const char* last) {
+    const char* p = first;
+    bool negative = false;
+    
+    if (p < last && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        ++p;
+    }
+    
+    const int64_t limit = std::numeric_limits<int64_t>::max() / 100;
+    int64_t whole = 0;
+    size_t whole_digits = 0;
+    
+    while (p < last && *p >= '0' && *p <= '9') {
+        if (whole > (limit - (*p - '0')) / 10) {
+            throw std::invalid_argument("Amount out of range: " + std::string(first, last));
+        }
+        whole = whole * 10 + (*p - '0');
+        ++whole_digits;
+        ++p;
+    }
+    
+    int64_t fraction = 0;
+    size_t fraction_digits = 0;
+    
+    if (p < last && *p == '.') {
+        ++p;
+        while (p < last && *p >= '0' && *p <= '9') {
+            if (++fraction_digits > 2) {
+                throw std::invalid_argument("Amount has more than 2 decimal places: " +
+                                            std::string(first, last));
+            }
+            fraction = fraction * 10 + (*p - '0');
+            ++p;
+        }
+    }
+    
+    if (p != last || whole_digits + fraction_digits == 0) {
+        throw std::invalid_argument("Invalid amount: " + std::string(first, last));
+    }
+    
+    if (fraction_digits == 1) fraction *= 10;
+    
+    if (whole * 100 > std::numeric_limits<int64_t>::max() - fraction) {
+        throw std::invalid_argument("Amount out of range: " + std::string(first, last));
+    }
+    int64_t paise = whole * 100 + fraction;
+    return Money(negative ? -paise : paise);
+}
+
+std::string Money::to_string() const {
+    // Work in unsigned space so INT64_MIN formats correctly.
+    bool negative = paise_ < 0;
+    uint64_t magnitude = negative ? 0 - static_cast<uint64_t>(paise_)
+                                  : static_cast<uint64_t>(paise_);
+    
+    std::string out = std::to_string(magnitude / 100);
+    uint64_t cents = magnitude % 100;
+    out += '.';
+    out += static_cast<char>('0' + cents / 10);
+    out += static_cast<char>('0' + cents % 10);
+    
+    return negative ? "-" + out : out;
+}
+
+} // namespace expense
@@ -0,0 +1,153 @@
+/**
+ * Parallel Scan Implementation
+ *
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#include "parallel_scan.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace expense {
+
+namespace {
+
+// SMA chunks span at least this many windows, so recomputing each
+// chunk's first window sum adds at most 1/4 to the work.
+constexpr size_t WINDOWS_PER_CHUNK = 4;
+
+// EMA fix-up stops once b^k falls below this: the carry's share is then
+// under eps^2 of it, far below the rounding of any realistic value, and
+// the powers never reach the (very slow) subnormal range.
+constexpr double NEGLIGIBLE_DECAY =
+    std::numeric_limits<double>::epsilon() * std::numeric_limits<double>::epsilon();
+
+size_t chunk_count(size_t n, size_t chunk) {
+    return (n + chunk - 1) / chunk;
+}
+
+/**
+ * out[k] += b^(k+1) * carry for k in [0, len), four power chains at once,
+ * until the powers become negligible.
+ */
+void add_decayed_carry(double* out, size_t len, double b, double carry) {
+    if (carry == 0.0) return;
+    double p[4] = {b, b * b, b * b * b, b * b * b * b};
+    const double step = p[3];
+    size_t k = 0;
+    for (; k + 4 <= len; k += 4) {
+        for (int l = 0; l < 4; ++l) {
+            out[k + l] += p[l] * carry;
+            p[l] *= step;
+        }
+        // p[0] is the largest power left
+        if (p[0] < NEGLIGIBLE_DECAY) return;
+    }
+    for (int l = 0; k < len; ++k, ++l) {
+        out[k] += p[l] * carry;
+    }
+}
+
+} // namespace
+
+// ==================== Simple Moving Average ====================
+
+MovingAverageResult parallel_moving_average(const std::vector<double>& data, int window,
+                                            const ExecutionPolicy& policy) {
+    return parallel_moving_average(data.data(), data.size(), window, policy);
+}
+
+MovingAverageResult parallel_moving_average(const double* data, size_t n, int window,
+                                            const ExecutionPolicy& policy) {
+    MovingAverageResult result;
+    result.window_size = window;
+
+    if (n == 0 || window <= 0) {
+        return result;
+    }
+
+    if (static_cast<size_t>(window) > n) {
+        window = static_cast<int>(n);
+        result.window_size = window;
+    }
+    const size_t w = static_cast<size_t>(window);
+    const size_t outputs = n - w + 1;
+    result.values.resize(outputs);
+    double* out = result.values.data();
+
+    size_t chunk = std::max(policy.chunk(), WINDOWS_PER_CHUNK * w);
+    policy.executor().parallel_for(chunk_count(outputs, chunk), [&](size_t c) {
+        size_t first = c * chunk;
+        size_t last = std::min(outputs, first + chunk);
+
+        // Same operation order as moving_average(), so chunk 0 matches it exactly
+        double window_sum = 0.0;
+        for (size_t i = first; i < first + w; ++i) {
+            window_sum += data[i];
+        }
+        out[first] = window_sum / window;
+        for (size_t j = first + 1; j < last; ++j) {
+            window_sum = window_sum - data[j - 1] + data[j + w - 1];
+            out[j] = window_sum / window;
+        }
+    });
+
+    result.current_average = result.values.back();
+
+    return result;
+}
+
+// ==================== Exponential Moving Average ====================
+
+MovingAverageResult parallel_exponential_moving_average(const std::vector<double>& data, double alpha,
+                                                        const ExecutionPolicy& policy) {
+    return parallel_exponential_moving_average(data.data(), data.size(), alpha, policy);
+}
+
+MovingAverageResult parallel_exponential_moving_average(const double* data, size_t n, double alpha,
+                                                        const ExecutionPolicy& policy) {
+    MovingAverageResult result;
+    result.window_size = -1; // Indicates EMA
+
+    if (n == 0 || alpha <= 0 || alpha > 1) {
+        return result;
+    }
+
+    result.values.resize(n);
+    double* out = result.values.data();
+    const double decay = 1 - alpha;
+    const size_t chunk = policy.chunk();
+    const size_t chunks = policy.chunks(n);
+
+    // Pass 1: local scans from a zero carry
+    policy.for_each_chunk(n, [&](size_t, size_t first, size_t last) {
+        double ema = 0.0;
+        for (size_t i = first; i < last; ++i) {
+            ema = alpha * data[i] + decay * ema;
+            out[i] = ema;
+        }
+    });
+
+    // Carries: the EMA just before each chunk. y[-1] = x[0] gives y[0] = x[0].
+    std::vector<double> carry(chunks);
+    double previous = data[0];
+    for (size_t c = 0; c < chunks; ++c) {
+        size_t len = std::min(n, (c + 1) * chunk) - c * chunk;
+        carry[c] = previous;
+        previous = out[c * chunk + len - 1] + std::pow(decay, static_cast<double>(len)) * previous;
+    }
+
+    // Pass 2: fold each carry into its chunk
+    policy.for_each_chunk(n, [&](size_t c, size_t first, size_t last) {
+        add_decayed_carry(out + first, last - first, decay, carry[c]);
+    });
+    out[0] = data[0];
+
+    result.current_average = result.values.back();
+
+    return result;
+}
+
+} // namespace expense
@@ -0,0 +1,148 @@
+/**
+ * Range Index Implementation
+ *
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#include "range_index.hpp"
+#include <limits>
+
+namespace expense {
+
+DailyTotals::DailyTotals(int32_t first_day, int32_t last_day) {
+    if (last_day < first_day) {
+        throw std::invalid_argument("Last day must not precede first day");
+    }
+    first_day_ = first_day;
+    const size_t days = static_cast<size_t>(static_cast<int64_t>(last_day) - first_day + 1);
+    totals_.assign(days, Money());
+    counts_.assign(days, 0);
+    rebuild();
+}
+
+DailyTotals::DailyTotals(const ExpenseTable& table) {
+    if (table.empty()) return;
+    ColumnView<int32_t> dates = table.dates();
+    ColumnView<double> amounts = table.amounts();
+    const auto range = std::minmax_element(dates.begin(), dates.end());
+    first_day_ = *range.first;
+    const size_t days = static_cast<size_t>(static_cast<int64_t>(*range.second) - first_day_ + 1);
+    totals_.assign(days, Money());
+    counts_.assign(days, 0);
+    for (size_t i = 0; i < table.size(); ++i) {
+        const size_t slot = static_cast<size_t>(static_cast<int64_t>(dates[i]) - first_day_);
+        totals_[slot] += Money::from_double(amounts[i]);
+        ++counts_[slot];
+    }
+    rebuild();
+}
+
+void DailyTotals::rebuild() {
+    total_tree_ = FenwickTree<Money>(totals_);
+    count_tree_ = FenwickTree<int64_t>(counts_);
+    extremes_ = MinMaxTree<Money>(totals_);
+}
+
+void DailyTotals::cover(int32_t date) {
+    if (totals_.empty()) {
+        first_day_ = date;
+        totals_.assign(1, Money());
+        counts_.assign(1, 0);
+        rebuild();
+        return;
+    }
+
+    const int64_t first = first_day_;
+    const int64_t last = first + static_cast<int64_t>(totals_.size()) - 1;
+    if (date >= first && date <= last) return;
+
+    // Grow by at least the current span so repeated growth is amortised
+    const int64_t span = static_cast<int64_t>(totals_.size());
+    const int64_t lowest = std::numeric_limits<int32_t>::min();
+    const int64_t highest = std::numeric_limits<int32_t>::max();
+    int64_t new_first = first;
+    int64_t new_last = last;
+    if (date < first) new_first = std::max(lowest, std::min<int64_t>(date, first - span));
+    if (date > last) new_last = std::min(highest, std::max<int64_t>(date, last + span));
+
+    const size_t days = static_cast<size_t>(new_last - new_first + 1);
+    const size_t shift = static_cast<size_t>(first - new_first);
+    std::vector<Money> totals(days, Money());
+    std::vector<int64_t> counts(days, 0);
+    std::copy(totals_.begin(), totals_.end(), totals.begin() + static_cast<std::ptrdiff_t>(shift));
+    std::copy(counts_.begin(), counts_.end(), counts.begin() + static_cast<std::ptrdiff_t>(shift));
+    totals_.swap(totals);
+    counts_.swap(counts);
+    first_day_ = static_cast<int32_t>(new_first);
+    rebuild();
+}
+
+void DailyTotals::apply(int32_t date, Money amount, int64_t count_delta) {
+    cover(date);
+    const size_t slot = static_cast<size_t>(static_cast<int64_t>(date) - first_day_);
+    totals_[slot] += amount;
+    counts_[slot] += count_delta;
+    total_tree_.add(slot, amount);
+    count_tree_.add(slot, count_delta);
+    extremes_.set(slot, totals_[slot]);
+}
+
+void DailyTotals::add(int32_t date, Money amount) {
+    apply(date, amount, 1);
+}
+
+void DailyTotals::remove(int32_t date, Money amount) {
+    apply(date, Money() - amount, -1);
+}
+
+void DailyTotals::update(int32_t old_date, Money old_amount, int32_t new_date, Money new_amount) {
+    remove(old_date, old_amount);
+    add(new_date, new_amount);
+}
+
+void DailyTotals::slots(int32_t from, int32_t to, size_t* first, size_t* last) const {
+    const int64_t span_first = first_day_;
+    const int64_t span_end = span_first + static_cast<int64_t>(totals_.size());
+    const int64_t lo = std::max<int64_t>(from, span_first);
+    const int64_t hi = std::min<int64_t>(static_cast<int64_t>(to) + 1, span_end);
+    if (lo >= hi) {
+        *first = *last = 0;
+        return;
+    }
+    *first = static_cast<size_t>(lo - span_first);
+    *last = static_cast<size_t>(hi - span_first);
+}
+
+Money DailyTotals::total(int32_t from, int32_t to) const {
+    size_t first, last;
+    slots(from, to, &first, &last);
+    return total_tree_.sum(first, last);
+}
+
+size_t DailyTotals::count(int32_t from, int32_t to) const {
+    size_t first, last;
+    slots(from, to, &first, &last);
+    return static_cast<size_t>(count_tree_.sum(first, last));
+}
+
+MinMax<Money> DailyTotals::day_extremes(int32_t from, int32_t to) const {
+    if (to < from) {
+        throw std::invalid_argument("Empty date range");
+    }
+    size_t first, last;
+    slots(from, to, &first, &last);
+    if (first == last) return MinMax<Money>();
+
+    MinMax<Money> result = extremes_.range(first, last);
+    // Days of [from, to] outside the span have a zero total
+    const bool uncovered = static_cast<int64_t>(from) < first_day_ + static_cast<int64_t>(first) ||
+                           static_cast<int64_t>(to) >= first_day_ + static_cast<int64_t>(last);
+    if (uncovered) {
+        result.min = std::min(result.min, Money());
+        result.max = std::max(result.max, Money());
+    }
+    return result;
+}
+
+} // namespace expense
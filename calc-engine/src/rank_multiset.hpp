@@ -0,0 +1,89 @@
+/**
+ * Rank Multiset (internal)
+ * 
+ * Order-statistic multiset over a fixed universe of values known up
+ * front: a Fenwick tree of occurrence counts indexed by each value's rank
+ * in the sorted, de-duplicated universe. Used by the rolling quantile
+ * kernels, where every value that will ever enter a window is the input
+ * itself.
+ * 
+ * Interview Talking Points:
+ * - Coordinate compression + Fenwick tree as an order-statistic tree
+ * - k-th smallest by binary lifting in O(log m), no rebalancing
+ * 
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#ifndef EXPENSE_RANK_MULTISET_HPP
+#define EXPENSE_RANK_MULTISET_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace expense {
+namespace detail {
+
+class RankMultiset {
+public:
+    /**
+     * @param data Every value that may be inserted (any order, duplicates ok)
+     */
+    RankMultiset(const double* data, size_t n) : universe_(data, data + n) {
+        std::sort(universe_.begin(), universe_.end());
+        universe_.erase(std::unique(universe_.begin(), universe_.end()), universe_.end());
+        tree_.assign(universe_.size() + 1, 0);
+        top_bit_ = 1;
+        while (top_bit_ * 2 <= universe_.size()) top_bit_ *= 2;
+    }
+    
+    /**
+     * Universe rank of a value (must be in the universe).
+     * Time Complexity: O(log m)
+     */
+    size_t rank_of(double value) const {
+        return static_cast<size_t>(
+            std::lower_bound(universe_.begin(), universe_.end(), value) - universe_.begin());
+    }
+    
+    void insert(size_t rank) { update(rank, 1); }
+    void erase(size_t rank) { update(rank, -1); }
+    size_t size() const { return size_; }
+    
+    /**
+     * k-th smallest element currently held (0-based, k < size()).
+     * Time Complexity: O(log m)
+     */
+    double kth(size_t k) const {
+        // Largest position whose prefix count is <= k, by binary lifting
+        size_t pos = 0;
+        long long remaining = static_cast<long long>(k);
+        for (size_t step = top_bit_; step > 0; step >>= 1) {
+            size_t next = pos + step;
+            if (next < tree_.size() && tree_[next] <= remaining) {
+                pos = next;
+                remaining -= tree_[next];
+            }
+        }
+        return universe_[pos];
+    }
+
+private:
+    void update(size_t rank, int delta) {
+        for (size_t i = rank + 1; i < tree_.size(); i += i & (~i + 1)) {
+            tree_[i] += delta;
+        }
+        size_ = static_cast<size_t>(static_cast<long long>(size_) + delta);
+    }
+    
+    std::vector<double> universe_;
+    std::vector<long long> tree_;
+    size_t top_bit_ = 1;
+    size_t size_ = 0;
+};
+
+} // namespace detail
+} // namespace expense
+
+#endif // EXPENSE_RANK_MULTISET_HPP
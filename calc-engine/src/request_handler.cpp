@@ -0,0 +1,285 @@
+/**
+ * Request Handler Implementation
+ * 
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#include "request_handler.hpp"
+#include "statistics.hpp"
+#include "csv_ingest.hpp"
+#include "snapshot.hpp"
+#include "zone_map.hpp"
+#include "ingest.hpp"
+#include "group_by.hpp"
+#include "rolling_engine.hpp"
+#include "segmented_stats.hpp"
+#include "json_writer.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+namespace expense {
+
+namespace {
+
+void write_json_output(
+    JsonWriter& out,
+    const StatisticsResult& stats,
+    const MovingAverageResult& sma,
+    const MovingAverageResult& ema,
+    const MovingAverageResult& rolling_median,
+    const RollingResult& rolling,
+    const std::vector<double>& percentile_levels,
+    const std::vector<double>& percentile_values,
+    const std::vector<size_t>& outliers) {
+    
+    // Roughly 10 bytes per moving-average value and outlier index
+    size_t values = sma.values.size() + ema.values.size() +
+                    rolling_median.values.size() + outliers.size();
+    for (const RollingSeries& s : rolling.series) values += s.values.size();
+    out.reserve(1024 + 64 * rolling.series.size() + 10 * values);
+    
+    out.raw("{\n");
+    out.raw("  \"success\": true,\n");
+    out.raw("  \"statistics\": ");
+    stats.write_json(out);
+    out.raw(",\n  \"simple_moving_average\": ");
+    sma.write_json(out);
+    out.raw(",\n  \"exponential_moving_average\": ");
+    ema.write_json(out);
+    out.raw(",\n  \"rolling_median\": ");
+    rolling_median.write_json(out);
+    if (!rolling.series.empty()) {
+        out.raw(",\n  \"rolling\": ");
+        rolling.write_json(out);
+    }
+    out.raw(",\n  \"percentiles\": {");
+    for (size_t i = 0; i < percentile_levels.size(); ++i) {
+        if (i > 0) out.raw(',');
+        out.raw("\"p").integer(static_cast<int>(percentile_levels[i])).raw("\":");
+        out.number(percentile_values[i], 2);
+    }
+    out.raw("},\n");
+    out.raw("  \"outliers\": [");
+    for (size_t i = 0; i < outliers.size(); ++i) {
+        if (i > 0) out.raw(',');
+        out.integer(static_cast<unsigned long long>(outliers[i]));
+    }
+    out.raw("],\n");
+    out.raw("  \"outlier_count\": ").integer(static_cast<unsigned long long>(outliers.size()));
+    out.raw("\n}\n");
+}
+
+/**
+ * Per-category breakdown with spread and tail quantiles.
+ */
+bool write_breakdown(const double* amounts, const uint8_t* codes, size_t n, JsonWriter& out) {
+    if (n == 0) {
+        write_error_json(out, "Number of values must be positive");
+        return false;
+    }
+    
+    GroupByOptions group_options;
+    group_options.variance = true;
+    group_options.percentiles = {50, 90};
+    GroupByResult breakdown = group_by_category(amounts, codes, n, CATEGORY_COUNT,
+                                                group_options);
+    
+    out.raw("{\n");
+    out.raw("  \"success\": true,\n");
+    out.raw("  \"category_breakdown\": ");
+    breakdown.write_json(out);
+    out.raw("\n}\n");
+    return true;
+}
+
+/**
+ * Expense rows of a CSV export or a binary snapshot.
+ */
+ExpenseTable load_table(const char* first, const char* last, const RequestOptions& options) {
+    if (options.snapshot) {
+        return SnapshotReader(first, static_cast<size_t>(last - first)).read();
+    }
+    return parse_expense_csv(first, last);
+}
+
+/**
+ * Group-by request: "amount CATEGORY" pairs, or a CSV export / snapshot.
+ */
+bool write_group_by(const char* first, const char* last,
+                    const RequestOptions& options, JsonWriter& out) {
+    if (options.csv || options.snapshot) {
+        ExpenseTable table = load_table(first, last, options);
+        return write_breakdown(table.amounts().data, table.categories().data, table.size(), out);
+    }
+    CategorizedBatch batch = parse_categorized(first, last, options.count_header);
+    return write_breakdown(batch.amounts.data(), batch.codes.data(), batch.amounts.size(), out);
+}
+
+/**
+ * Date-range request: total and count of the table rows dated within
+ * [date_from, date_to], answered through a zone map.
+ */
+bool write_date_range(const char* first, const char* last,
+                      const RequestOptions& options, JsonWriter& out) {
+    if (!options.csv && !options.snapshot) {
+        write_error_json(out, "Date ranges need CSV or snapshot input");
+        return false;
+    }
+    ExpenseTable table = load_table(first, last, options);
+    table.sort_by_date();
+    RangeTotal range = ZoneMap(table).total(options.date_from, options.date_to);
+    
+    auto iso = [](int32_t days, char* text, size_t size) {
+        int year;
+        unsigned month, day;
+        civil_from_days(days, &year, &month, &day);
+        std::snprintf(text, size, "%04d-%02u-%02u", year, month, day);
+        return text;
+    };
+    char from[16];
+    char to[16];
+    out.raw("{\n");
+    out.raw("  \"success\": true,\n");
+    out.raw("  \"date_range\": {\"from\":").string(iso(options.date_from, from, sizeof(from)));
+    out.raw(",\"to\":").string(iso(options.date_to, to, sizeof(to)));
+    out.raw(",\"total\":").number(range.total.to_double(), 2);
+    out.raw(",\"count\":").integer(static_cast<unsigned long long>(range.count));
+    out.raw("}\n}\n");
+    return true;
+}
+
+/**
+ * Amount column of a CSV export or snapshot, shaped like parse_amounts.
+ * Exact amounts come from the source text / paise column, never from the
+ * rounded doubles.
+ */
+AmountBatch table_amounts(const char* first, const char* last, const RequestOptions& options) {
+    AmountBatch batch;
+    if (options.snapshot) {
+        SnapshotReader reader(first, static_cast<size_t>(last - first));
+        ExpenseTable table = reader.read();
+        batch.amounts.assign(table.amounts().begin(), table.amounts().end());
+        if (options.exact) {
+            batch.exact.reserve(reader.rows());
+            std::vector<int64_t> scratch;
+            for (size_t c = 0; c < reader.chunk_count(); ++c) {
+                for (int64_t paise : reader.amount_paise(c, scratch)) {
+                    batch.exact.push_back(Money::from_paise(paise));
+                }
+            }
+        }
+        return batch;
+    }
+    
+    ExpenseTable table = options.exact ? parse_expense_csv(first, last, batch.exact)
+                                       : parse_expense_csv(first, last);
+    batch.amounts.assign(table.amounts().begin(), table.amounts().end());
+    return batch;
+}
+
+/**
+ * Batch request: full statistics for every line (segment) in one call.
+ */
+bool write_batch(const char* first, const char* last, JsonWriter& out) {
+    SegmentedBatch batch = parse_segmented(first, last);
+    if (batch.segments() == 0) {
+        write_error_json(out, "Number of segments must be positive");
+        return false;
+    }
+    
+    SegmentedStats stats = calculate_segmented(batch.amounts, batch.offsets);
+    
+    out.raw("{\n");
+    out.raw("  \"success\": true,\n");
+    out.raw("  \"segment_count\": ").integer(static_cast<unsigned long long>(stats.segments));
+    out.raw(",\n  \"segments\": ");
+    stats.write_json(out);
+    out.raw("\n}\n");
+    return true;
+}
+
+} // namespace
+
+void write_error_json(JsonWriter& out, const std::string& message) {
+    out.raw("{\"success\":false,\"error\":").string(message).raw("}\n");
+}
+
+std::string create_error_json(const std::string& message) {
+    JsonWriter out(64 + message.size());
+    write_error_json(out, message);
+    return out.str();
+}
+
+bool handle_request(const char* first, const char* last,
+                    const RequestOptions& options, JsonWriter& out) {
+    try {
+        // Each mode answers the whole request; never silently drop one
+        if (int(options.group_by) + int(options.batch) + int(options.date_range) > 1) {
+            write_error_json(out, "--group-by, --batch and --date-range cannot be combined");
+            return false;
+        }
+        if (options.group_by) {
+            return write_group_by(first, last, options, out);
+        }
+        if (options.batch) {
+            return write_batch(first, last, out);
+        }
+        if (options.date_range) {
+            return write_date_range(first, last, options, out);
+        }
+        
+        AmountBatch batch = options.csv || options.snapshot
+            ? table_amounts(first, last, options)
+            : parse_amounts(first, last, options.exact, options.count_header);
+        const std::vector<double>& amounts = batch.amounts;
+        
+        if (amounts.empty()) {
+            write_error_json(out, "Number of values must be positive");
+            return false;
+        }
+        
+        // Calculate statistics (exact integer aggregation when requested)
+        StatisticsResult stats = options.exact
+            ? StatisticsCalculator::calculate_all(batch.exact)
+            : StatisticsCalculator::calculate_all(amounts);
+        
+        // Calculate moving averages (window size = min(7, n))
+        int window = static_cast<int>(std::min<size_t>(7, amounts.size()));
+        MovingAverageResult sma = StatisticsCalculator::moving_average(amounts, window);
+        MovingAverageResult ema = StatisticsCalculator::exponential_moving_average(amounts, 0.3);
+        MovingAverageResult median = StatisticsCalculator::rolling_median(amounts, window);
+        
+        // Requested dashboard windows, all series in one sweep
+        RollingEngine engine;
+        for (int w : options.rolling_windows) {
+            engine.add(w, {RollingStat::Mean, RollingStat::Stddev, RollingStat::Min, RollingStat::Max});
+        }
+        RollingResult rolling = engine.run(amounts);
+        
+        // Tail percentiles in one selection pass
+        const std::vector<double> levels = {50, 90, 95, 99};
+        std::vector<double> tail = StatisticsCalculator::quantiles(amounts, levels);
+        
+        // Detect outliers
+        std::vector<size_t> outliers = StatisticsCalculator::detect_outliers(amounts);
+        
+        // Everything is computed before the first byte is written, so a
+        // streaming writer never emits a partial success response
+        write_json_output(out, stats, sma, ema, median, rolling, levels, tail, outliers);
+        return true;
+    } catch (const std::exception& e) {
+        write_error_json(out, e.what());
+        return false;
+    }
+}
+
+RequestOutcome handle_request(const char* first, const char* last,
+                              const RequestOptions& options) {
+    JsonWriter out;
+    bool success = handle_request(first, last, options, out);
+    return {success, out.str()};
+}
+
+} // namespace expense
@@ -0,0 +1,72 @@
+/**
+ * Request Handler Header
+ * 
+ * Shared request pipeline for the CLI (stdin) and server (socket frames):
+ * parse the text input, run the statistics, and render the JSON response.
+ * 
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#ifndef EXPENSE_REQUEST_HANDLER_HPP
+#define EXPENSE_REQUEST_HANDLER_HPP
+
+#include "ingest.hpp"
+#include "json_writer.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace expense {
+
+/**
+ * Rendered response for one request.
+ */
+struct RequestOutcome {
+    bool success = false;
+    std::string json;
+};
+
+/**
+ * Request parsing options.
+ */
+struct RequestOptions {
+    bool exact = false;                        // parse amounts as paise
+    CountHeader count_header = CountHeader::Auto;
+    bool group_by = false;                     // "amount CATEGORY" pairs -> breakdown
+    std::vector<int> rolling_windows;          // extra mean/stddev/min/max series
+    bool batch = false;                        // one segment per line -> stats per segment
+    bool csv = false;                          // input is an expense CSV export
+    bool snapshot = false;                     // input is a binary snapshot (snapshot.hpp)
+    bool date_range = false;                   // total of rows dated [date_from, date_to]
+    int32_t date_from = 0;                     // epoch days, inclusive
+    int32_t date_to = 0;
+};
+
+/**
+ * Process one request in the CLI input format (optional count, then
+ * values; amount/category pairs with group_by; one segment of amounts
+ * per line with batch; an expense CSV export with csv; snapshot
+ * bytes with snapshot) held in [first, last). group_by, batch and
+ * date_range select exclusive modes; setting more than one is an error.
+ * Never throws; failures are reported as error JSON.
+ */
+RequestOutcome handle_request(const char* first, const char* last,
+                              const RequestOptions& options);
+
+/**
+ * Same as above, rendering into `out` (which may stream to a descriptor).
+ * @return true on success; false after writing the error JSON
+ */
+bool handle_request(const char* first, const char* last,
+                    const RequestOptions& options, JsonWriter& out);
+
+/**
+ * Render the standard error response.
+ */
+std::string create_error_json(const std::string& message);
+void write_error_json(JsonWriter& out, const std::string& message);
+
+} // namespace expense
+
+#endif // EXPENSE_REQUEST_HANDLER_HPP
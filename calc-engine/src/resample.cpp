@@ -0,0 +1,277 @@
+/**
+ * Resampling Implementation
+ * 
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#include "resample.hpp"
+#include "json_writer.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+#include <stdexcept>
+
+namespace expense {
+
+namespace {
+
+// Counting path when the span is at most this many days per transaction
+// (plus a fixed allowance), keeping the day arrays O(n).
+constexpr int64_t COUNTING_DAYS_PER_ROW = 4;
+constexpr int64_t COUNTING_BASE_DAYS = 4096;
+
+/**
+ * Folds per-day subtotals, supplied in ascending day order, into buckets.
+ */
+class BucketBuilder {
+public:
+    BucketBuilder(ResampleResult& out, const ResampleOptions& options)
+        : out_(out), period_(options.period), zero_fill_(options.zero_fill) {}
+
+    void add_day(int32_t day, double sum, uint32_t count) {
+        int32_t start = period_start(day, period_);
+        if (!open_ || start != current_) {
+            if (open_) {
+                close();
+                if (zero_fill_) {
+                    for (int32_t s = next_period_start(current_, period_); s < start;
+                         s = next_period_start(s, period_)) {
+                        emit(s, 0.0, 0);
+                    }
+                }
+            }
+            current_ = start;
+            total_ = 0.0;
+            count_ = 0;
+            open_ = true;
+        }
+        total_ += sum;
+        count_ += count;
+    }
+
+    void finish() {
+        if (open_) close();
+        open_ = false;
+    }
+
+private:
+    void close() { emit(current_, total_, count_); }
+
+    void emit(int32_t start, double total, uint32_t count) {
+        out_.starts.push_back(start);
+        out_.totals.push_back(total);
+        out_.counts.push_back(count);
+    }
+
+    ResampleResult& out_;
+    Period period_;
+    bool zero_fill_;
+    bool open_ = false;
+    int32_t current_ = 0;
+    double total_ = 0.0;
+    uint32_t count_ = 0;
+};
+
+void resample_counting(const int32_t* dates, const double* amounts, size_t n,
+                       int32_t min_date, int32_t max_date, BucketBuilder& builder) {
+    size_t span = static_cast<size_t>(static_cast<int64_t>(max_date) - min_date + 1);
+    std::vector<double> day_sum(span, 0.0);
+    std::vector<uint32_t> day_count(span, 0);
+
+    for (size_t i = 0; i < n; ++i) {
+        size_t slot = static_cast<size_t>(dates[i] - min_date);
+        day_sum[slot] += amounts[i];
+        ++day_count[slot];
+    }
+
+    for (size_t d = 0; d < span; ++d) {
+        if (day_count[d] > 0) {
+            builder.add_day(min_date + static_cast<int32_t>(d), day_sum[d], day_count[d]);
+        }
+    }
+}
+
+void resample_sorted(const int32_t* dates, const double* amounts, size_t n,
+                     bool sorted, BucketBuilder& builder) {
+    std::vector<size_t> order;
+    if (!sorted) {
+        // Stable, so same-day amounts are summed in input order
+        order.resize(n);
+        std::iota(order.begin(), order.end(), size_t{0});
+        std::stable_sort(order.begin(), order.end(), [dates](size_t a, size_t b) {
+            return dates[a] < dates[b];
+        });
+    }
+
+    int32_t day = 0;
+    double day_sum = 0.0;
+    uint32_t day_count = 0;
+    for (size_t k = 0; k < n; ++k) {
+        size_t i = sorted ? k : order[k];
+        if (day_count > 0 && dates[i] != day) {
+            builder.add_day(day, day_sum, day_count);
+            day_sum = 0.0;
+            day_count = 0;
+        }
+        day = dates[i];
+        day_sum += amounts[i];
+        ++day_count;
+    }
+    if (day_count > 0) {
+        builder.add_day(day, day_sum, day_count);
+    }
+}
+
+} // namespace
+
+// ==================== Calendar Arithmetic ====================
+
+int32_t period_start(int32_t day, Period period) {
+    int year;
+    unsigned month, dom;
+    switch (period) {
+        case Period::Day:
+            return day;
+        case Period::IsoWeek: {
+            // 1970-01-01 was a Thursday; weekday 0 = Monday
+            int32_t weekday = ((day + 3) % 7 + 7) % 7;
+            return day - weekday;
+        }
+        case Period::Month:
+            civil_from_days(day, &year, &month, &dom);
+            return days_from_civil(year, month, 1);
+        case Period::Year:
+            civil_from_days(day, &year, &month, &dom);
+            return days_from_civil(year, 1, 1);
+    }
+    return day;
+}
+
+int32_t next_period_start(int32_t start, Period period) {
+    int year;
+    unsigned month, dom;
+    switch (period) {
+        case Period::Day:
+            return start + 1;
+        case Period::IsoWeek:
+            return start + 7;
+        case Period::Month:
+            civil_from_days(start, &year, &month, &dom);
+            return month == 12 ? days_from_civil(year + 1, 1, 1)
+                               : days_from_civil(year, month + 1, 1);
+        case Period::Year:
+            civil_from_days(start, &year, &month, &dom);
+            return days_from_civil(year + 1, 1, 1);
+    }
+    return start + 1;
+}
+
+const char* period_name(Period period) {
+    switch (period) {
+        case Period::Day: return "day";
+        case Period::IsoWeek: return "week";
+        case Period::Month: return "month";
+        case Period::Year: return "year";
+    }
+    return "month";
+}
+
+Period parse_period(const std::string& name) {
+    if (name == "day") return Period::Day;
+    if (name == "week") return Period::IsoWeek;
+    if (name == "month") return Period::Month;
+    if (name == "year") return Period::Year;
+    throw std::invalid_argument("Unknown period (expected day, week, month or year): " + name);
+}
+
+// ==================== Resampling ====================
+
+ResampleResult resample(const int32_t* dates, const double* amounts, size_t n,
+                        const ResampleOptions& options) {
+    ResampleResult result;
+    result.period = options.period;
+    if (n == 0) return result;
+
+    int32_t min_date = dates[0];
+    int32_t max_date = dates[0];
+    bool sorted = true;
+    for (size_t i = 1; i < n; ++i) {
+        if (dates[i] < dates[i - 1]) sorted = false;
+        min_date = std::min(min_date, dates[i]);
+        max_date = std::max(max_date, dates[i]);
+    }
+
+    int64_t span = static_cast<int64_t>(max_date) - min_date + 1;
+    bool counting = options.strategy == ResampleStrategy::Counting ||
+                    (options.strategy == ResampleStrategy::Auto && !sorted &&
+                     span <= COUNTING_DAYS_PER_ROW * static_cast<int64_t>(n) + COUNTING_BASE_DAYS);
+
+    BucketBuilder builder(result, options);
+    if (counting) {
+        resample_counting(dates, amounts, n, min_date, max_date, builder);
+    } else {
+        resample_sorted(dates, amounts, n, sorted, builder);
+    }
+    builder.finish();
+
+    return result;
+}
+
+ResampleResult resample(const ExpenseTable& table, const ResampleOptions& options) {
+    ColumnView<int32_t> dates = table.dates();
+    ColumnView<double> amounts = table.amounts();
+    return resample(dates.data, amounts.data, dates.size, options);
+}
+
+// ==================== Result Output ====================
+
+std::string ResampleResult::label(size_t i) const {
+    int year;
+    unsigned month, day;
+    char text[32];   // fits any int year and week
+
+    if (period == Period::IsoWeek) {
+        // The ISO year is the year of the week's Thursday
+        int32_t thursday = starts[i] + 3;
+        civil_from_days(thursday, &year, &month, &day);
+        int week = (thursday - days_from_civil(year, 1, 1)) / 7 + 1;
+        std::snprintf(text, sizeof(text), "%04d-W%02d", year, week);
+        return text;
+    }
+
+    civil_from_days(starts[i], &year, &month, &day);
+    switch (period) {
+        case Period::Day:
+            std::snprintf(text, sizeof(text), "%04d-%02u-%02u", year, month, day);
+            break;
+        case Period::Month:
+            std::snprintf(text, sizeof(text), "%04d-%02u", year, month);
+            break;
+        default:
+            std::snprintf(text, sizeof(text), "%04d", year);
+            break;
+    }
+    return text;
+}
+
+std::string ResampleResult::to_json() const {
+    JsonWriter out(64 + size() * 48);
+    write_json(out);
+    return out.str();
+}
+
+void ResampleResult::write_json(JsonWriter& out) const {
+    out.raw("{\"period\":").string(period_name(period));
+    out.raw(",\"buckets\":[");
+    for (size_t i = 0; i < size(); ++i) {
+        if (i > 0) out.raw(',');
+        out.raw("{\"period\":").string(label(i));
+        out.raw(",\"total\":").number(totals[i], 2);
+        out.raw(",\"count\":").integer(static_cast<unsigned long long>(counts[i]));
+        out.raw('}');
+    }
+    out.raw("]}");
+}
+
+} // namespace expense
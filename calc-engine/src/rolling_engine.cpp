@@ -0,0 +1,291 @@
+/**
+ * Rolling Engine Implementation
+ *
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#include "rolling_engine.hpp"
+#include "json_writer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace expense {
+
+namespace {
+
+const char* const STAT_NAMES[ROLLING_STAT_COUNT] = {
+    "sum", "mean", "variance", "stddev", "min", "max"
+};
+
+/**
+ * Neumaier-compensated sum; subtracting is adding the negation.
+ */
+class CompensatedSum {
+public:
+    void add(double x) {
+        double t = sum_ + x;
+        if (std::abs(sum_) >= std::abs(x)) {
+            compensation_ += (sum_ - t) + x;
+        } else {
+            compensation_ += (x - t) + sum_;
+        }
+        sum_ = t;
+    }
+
+    double value() const { return sum_ + compensation_; }
+
+private:
+    double sum_ = 0.0;
+    double compensation_ = 0.0;
+};
+
+/**
+ * Sliding-window extremum: indices whose values are monotonic from front
+ * to back. `Keep(a, b)` is true when an older value a must stay ahead of
+ * a newer value b. The ring is a power of two so wrapping is a mask.
+ */
+template <typename Keep>
+class MonotonicQueue {
+public:
+    explicit MonotonicQueue(size_t capacity) {
+        size_t size = 1;
+        while (size < capacity) size <<= 1;
+        ring_.resize(size);
+        mask_ = size - 1;
+    }
+
+    void push(const double* data, size_t index) {
+        while (tail_ != head_ && !Keep()(data[ring_[(tail_ - 1) & mask_]], data[index])) --tail_;
+        ring_[tail_ & mask_] = index;
+        ++tail_;
+    }
+
+    void expire(size_t first_valid) {
+        while (tail_ != head_ && ring_[head_ & mask_] < first_valid) ++head_;
+    }
+
+    size_t front() const { return ring_[head_ & mask_]; }
+
+private:
+    std::vector<size_t> ring_;
+    size_t mask_ = 0;
+    size_t head_ = 0;   // monotonically increasing; only the low bits index
+    size_t tail_ = 0;
+};
+
+struct KeepForMin {
+    bool operator()(double older, double newer) const { return older < newer; }
+};
+
+struct KeepForMax {
+    bool operator()(double older, double newer) const { return older > newer; }
+};
+
+/**
+ * Running state for one window size; fills every series over it.
+ */
+class WindowState {
+public:
+    WindowState(size_t window, double shift) : w_(window), shift_(shift), min_q_(window), max_q_(window) {}
+
+    void attach(RollingStat stat, std::vector<double>* out) {
+        outputs_.push_back({stat, out});
+        switch (stat) {
+            case RollingStat::Sum:
+            case RollingStat::Mean: need_sum_ = true; break;
+            case RollingStat::Variance:
+            case RollingStat::Stddev: need_moments_ = true; break;
+            case RollingStat::Min: need_min_ = true; break;
+            case RollingStat::Max: need_max_ = true; break;
+        }
+    }
+
+    void step(const double* data, size_t i) {
+        add(data, i, 1.0);
+        if (i >= w_) add(data, i - w_, -1.0);
+        if (need_min_) {
+            min_q_.expire(i + 1 >= w_ ? i + 1 - w_ : 0);
+            min_q_.push(data, i);
+        }
+        if (need_max_) {
+            max_q_.expire(i + 1 >= w_ ? i + 1 - w_ : 0);
+            max_q_.push(data, i);
+        }
+        if (i + 1 < w_) return;
+
+        size_t slot = i + 1 - w_;
+        double count = static_cast<double>(w_);
+        for (const Output& o : outputs_) {
+            double v = 0.0;
+            switch (o.stat) {
+                case RollingStat::Sum: v = sum_.value(); break;
+                case RollingStat::Mean: v = sum_.value() / count; break;
+                case RollingStat::Variance: v = variance(); break;
+                case RollingStat::Stddev: v = std::sqrt(variance()); break;
+                case RollingStat::Min: v = data[min_q_.front()]; break;
+                case RollingStat::Max: v = data[max_q_.front()]; break;
+            }
+            (*o.values)[slot] = v;
+        }
+    }
+
+private:
+    struct Output {
+        RollingStat stat;
+        std::vector<double>* values;
+    };
+
+    void add(const double* data, size_t i, double sign) {
+        if (need_sum_) sum_.add(sign * data[i]);
+        if (need_moments_) {
+            // Shifted by a representative value to avoid cancellation
+            double d = data[i] - shift_;
+            shifted_.add(sign * d);
+            shifted_sq_.add(sign * d * d);
+        }
+    }
+
+    double variance() const {
+        double count = static_cast<double>(w_);
+        double s1 = shifted_.value();
+        double v = (shifted_sq_.value() - s1 * s1 / count) / count;
+        return v > 0.0 ? v : 0.0;
+    }
+
+    size_t w_;
+    double shift_;
+    bool need_sum_ = false;
+    bool need_moments_ = false;
+    bool need_min_ = false;
+    bool need_max_ = false;
+    CompensatedSum sum_;
+    CompensatedSum shifted_;
+    CompensatedSum shifted_sq_;
+    MonotonicQueue<KeepForMin> min_q_;
+    MonotonicQueue<KeepForMax> max_q_;
+    std::vector<Output> outputs_;
+};
+
+} // namespace
+
+// ==================== Stat Names ====================
+
+const char* rolling_stat_name(RollingStat stat) {
+    size_t index = static_cast<size_t>(stat);
+    return index < ROLLING_STAT_COUNT ? STAT_NAMES[index] : "mean";
+}
+
+RollingStat parse_rolling_stat(const std::string& name) {
+    for (size_t i = 0; i < ROLLING_STAT_COUNT; ++i) {
+        if (name == STAT_NAMES[i]) return static_cast<RollingStat>(i);
+    }
+    throw std::invalid_argument("Unknown rolling statistic: " + name);
+}
+
+// ==================== Engine ====================
+
+RollingEngine::RollingEngine(std::vector<WindowSpec> specs) {
+    for (WindowSpec& spec : specs) {
+        add(spec.window, std::move(spec.stats));
+    }
+}
+
+RollingEngine& RollingEngine::add(int window, std::vector<RollingStat> stats) {
+    if (window <= 0) {
+        throw std::invalid_argument("Window size must be positive");
+    }
+    if (stats.empty()) {
+        throw std::invalid_argument("Window needs at least one statistic");
+    }
+    specs_.push_back({window, std::move(stats)});
+    return *this;
+}
+
+RollingResult RollingEngine::run(const double* data, size_t n) const {
+    RollingResult result;
+    size_t total = 0;
+    for (const WindowSpec& spec : specs_) total += spec.stats.size();
+    result.series.reserve(total);
+
+    if (n == 0) {
+        for (const WindowSpec& spec : specs_) {
+            for (RollingStat stat : spec.stats) {
+                result.series.push_back({spec.window, 0, stat, {}});
+            }
+        }
+        return result;
+    }
+
+    // Shift for the variance sums: any in-range value works, the first
+    // is as good as the mean and needs no extra pass.
+    const double shift = data[0];
+
+    std::vector<WindowState> states;
+    states.reserve(specs_.size());
+    for (const WindowSpec& spec : specs_) {
+        size_t w = std::min(static_cast<size_t>(spec.window), n);
+        states.emplace_back(w, shift);
+        for (RollingStat stat : spec.stats) {
+            RollingSeries series;
+            series.window = spec.window;
+            series.effective_window = static_cast<int>(w);
+            series.stat = stat;
+            series.values.resize(n - w + 1);
+            result.series.push_back(std::move(series));
+        }
+    }
+
+    // Series storage is final now; hand out pointers
+    size_t next = 0;
+    for (size_t s = 0; s < specs_.size(); ++s) {
+        for (size_t k = 0; k < specs_[s].stats.size(); ++k, ++next) {
+            states[s].attach(result.series[next].stat, &result.series[next].values);
+        }
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        for (WindowState& state : states) {
+            state.step(data, i);
+        }
+    }
+
+    return result;
+}
+
+// ==================== Result Output ====================
+
+const RollingSeries* RollingResult::find(int window, RollingStat stat) const {
+    for (const RollingSeries& s : series) {
+        if (s.window == window && s.stat == stat) return &s;
+    }
+    return nullptr;
+}
+
+std::string RollingResult::to_json() const {
+    size_t values = 0;
+    for (const RollingSeries& s : series) values += s.values.size();
+    JsonWriter out(64 + series.size() * 64 + values * 10);
+    write_json(out);
+    return out.str();
+}
+
+void RollingResult::write_json(JsonWriter& out) const {
+    out.raw('[');
+    for (size_t i = 0; i < series.size(); ++i) {
+        const RollingSeries& s = series[i];
+        if (i > 0) out.raw(',');
+        out.raw("{\"window_size\":").integer(s.effective_window);
+        out.raw(",\"stat\":").string(rolling_stat_name(s.stat));
+        out.raw(",\"values\":[");
+        for (size_t k = 0; k < s.values.size(); ++k) {
+            if (k > 0) out.raw(',');
+            out.number(s.values[k], 2);
+        }
+        out.raw("]}");
+    }
+    out.raw(']');
+}
+
+} // namespace expense
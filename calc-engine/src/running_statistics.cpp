@@ -0,0 +1,208 @@
+/**
+ * Running Statistics Implementation
+ * 
+ * Welford updates, reverse-Welford removal and Chan merging.
+ * 
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#include "running_statistics.hpp"
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace expense {
+
+namespace {
+
+constexpr uint8_t MAGIC_0 = 'R';
+constexpr uint8_t MAGIC_1 = 'S';
+constexpr uint8_t FORMAT_VERSION = 1;
+constexpr uint8_t FLAG_EXTREMA_EXACT = 0x01;
+
+void put_u64(std::vector<uint8_t>& out, uint64_t v) {
+    for (int i = 0; i < 8; ++i) {
+        out.push_back(static_cast<uint8_t>(v >> (8 * i)));
+    }
+}
+
+void put_f64(std::vector<uint8_t>& out, double v) {
+    uint64_t bits;
+    std::memcpy(&bits, &v, sizeof(bits));
+    put_u64(out, bits);
+}
+
+uint64_t get_u64(const uint8_t* p) {
+    uint64_t v = 0;
+    for (int i = 0; i < 8; ++i) {
+        v |= static_cast<uint64_t>(p[i]) << (8 * i);
+    }
+    return v;
+}
+
+double get_f64(const uint8_t* p) {
+    uint64_t bits = get_u64(p);
+    double v;
+    std::memcpy(&v, &bits, sizeof(v));
+    return v;
+}
+
+} // namespace
+
+// ==================== Updates ====================
+
+void RunningStatistics::push(double value) {
+    if (count_ == 0) {
+        min_ = max_ = value;
+        min_count_ = max_count_ = 1;
+    } else {
+        if (value < min_) {
+            min_ = value;
+            min_count_ = 1;
+        } else if (value == min_) {
+            ++min_count_;
+        }
+        if (value > max_) {
+            max_ = value;
+            max_count_ = 1;
+        } else if (value == max_) {
+            ++max_count_;
+        }
+    }
+    
+    ++count_;
+    sum_ += value;
+    double delta = value - mean_;
+    mean_ += delta / static_cast<double>(count_);
+    m2_ += delta * (value - mean_);
+}
+
+bool RunningStatistics::remove(double value) {
+    if (count_ == 0) return false;
+    
+    if (count_ == 1) {
+        clear();
+        return true;
+    }
+    
+    double n_after = static_cast<double>(count_ - 1);
+    double delta = value - mean_;
+    double mean_after = mean_ - delta / n_after;
+    m2_ -= delta * (value - mean_after);
+    if (m2_ < 0) m2_ = 0.0;
+    mean_ = mean_after;
+    sum_ -= value;
+    --count_;
+    
+    // Extrema stay exact while another occurrence remains.
+    // Once a count reaches zero the extreme is stale; keep it from wrapping.
+    if (value == min_ && min_count_ > 0 && --min_count_ == 0) extrema_exact_ = false;
+    if (value == max_ && max_count_ > 0 && --max_count_ == 0) extrema_exact_ = false;
+    
+    return true;
+}
+
+void RunningStatistics::merge(const RunningStatistics& other) {
+    if (other.count_ == 0) return;
+    if (count_ == 0) {
+        *this = other;
+        return;
+    }
+    
+    double na = static_cast<double>(count_);
+    double nb = static_cast<double>(other.count_);
+    double n = na + nb;
+    double delta = other.mean_ - mean_;
+    
+    mean_ += delta * nb / n;
+    m2_ += other.m2_ + delta * delta * na * nb / n;
+    sum_ += other.sum_;
+    count_ += other.count_;
+    
+    if (other.min_ < min_) {
+        min_ = other.min_;
+        min_count_ = other.min_count_;
+    } else if (other.min_ == min_) {
+        min_count_ += other.min_count_;
+    }
+    if (other.max_ > max_) {
+        max_ = other.max_;
+        max_count_ = other.max_count_;
+    } else if (other.max_ == max_) {
+        max_count_ += other.max_count_;
+    }
+    extrema_exact_ = extrema_exact_ && other.extrema_exact_;
+}
+
+void RunningStatistics::clear() {
+    *this = RunningStatistics();
+}
+
+// ==================== Derived Values ====================
+
+double RunningStatistics::variance() const {
+    if (count_ < 2) return 0.0;
+    return m2_ / static_cast<double>(count_);
+}
+
+double RunningStatistics::sample_variance() const {
+    if (count_ < 2) return 0.0;
+    return m2_ / static_cast<double>(count_ - 1);
+}
+
+double RunningStatistics::stddev() const {
+    return std::sqrt(variance());
+}
+
+double RunningStatistics::sample_stddev() const {
+    return std::sqrt(sample_variance());
+}
+
+// ==================== Serialization ====================
+
+std::vector<uint8_t> RunningStatistics::serialize() const {
+    std::vector<uint8_t> out;
+    out.reserve(SERIALIZED_SIZE);
+    
+    out.push_back(MAGIC_0);
+    out.push_back(MAGIC_1);
+    out.push_back(FORMAT_VERSION);
+    out.push_back(extrema_exact_ ? FLAG_EXTREMA_EXACT : 0);
+    
+    put_u64(out, count_);
+    put_u64(out, min_count_);
+    put_u64(out, max_count_);
+    put_f64(out, sum_);
+    put_f64(out, mean_);
+    put_f64(out, m2_);
+    put_f64(out, min_);
+    put_f64(out, max_);
+    
+    return out;
+}
+
+RunningStatistics RunningStatistics::deserialize(const std::vector<uint8_t>& blob) {
+    if (blob.size() != SERIALIZED_SIZE || blob[0] != MAGIC_0 || blob[1] != MAGIC_1) {
+        throw std::invalid_argument("Invalid running statistics blob");
+    }
+    if (blob[2] != FORMAT_VERSION) {
+        throw std::invalid_argument("Unsupported running statistics version");
+    }
+    
+    RunningStatistics rs;
+    const uint8_t* p = blob.data() + 4;
+    rs.extrema_exact_ = (blob[3] & FLAG_EXTREMA_EXACT) != 0;
+    rs.count_ = get_u64(p);      p += 8;
+    rs.min_count_ = get_u64(p);  p += 8;
+    rs.max_count_ = get_u64(p);  p += 8;
+    rs.sum_ = get_f64(p);        p += 8;
+    rs.mean_ = get_f64(p);       p += 8;
+    rs.m2_ = get_f64(p);         p += 8;
+    rs.min_ = get_f64(p);        p += 8;
+    rs.max_ = get_f64(p);
+    
+    return rs;
+}
+
+} // namespace expense
@@ -0,0 +1,106 @@
+/**
+ * Segmented Statistics Implementation
+ *
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#include "segmented_stats.hpp"
+#include "json_writer.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+
+namespace expense {
+
+// ==================== Batch Computation ====================
+
+void calculate_segmented_into(const double* amounts, size_t n,
+                              const size_t* offsets, size_t offset_count,
+                              double* out, ThreadPool* pool) {
+    if (offset_count < 2) return;
+
+    for (size_t s = 0; s + 1 < offset_count; ++s) {
+        if (offsets[s + 1] < offsets[s]) {
+            throw std::invalid_argument("Segment offsets must be non-decreasing (index " +
+                                        std::to_string(s + 1) + ")");
+        }
+    }
+    if (offsets[offset_count - 1] > n) {
+        throw std::invalid_argument("Segment offsets exceed the number of amounts");
+    }
+
+    const size_t segments = offset_count - 1;
+    const size_t base = offsets[0];
+
+    // One uninitialised scratch buffer; each task copies and sorts its own slice
+    std::unique_ptr<double[]> scratch(new double[offsets[segments] - base]);
+
+    if (!pool) pool = &ThreadPool::shared();
+    pool->parallel_for(segments, [&](size_t s) {
+        size_t len = offsets[s + 1] - offsets[s];
+        double* slice = scratch.get() + (offsets[s] - base);
+        std::copy(amounts + offsets[s], amounts + offsets[s + 1], slice);
+
+        double row[StatisticsResult::FIELD_COUNT];
+        StatisticsCalculator::calculate_all_in_place(slice, len).to_array(row);
+        for (size_t f = 0; f < StatisticsResult::FIELD_COUNT; ++f) {
+            out[f * segments + s] = row[f];
+        }
+    });
+}
+
+SegmentedStats calculate_segmented(const double* amounts, size_t n,
+                                   const size_t* offsets, size_t offset_count,
+                                   ThreadPool* pool) {
+    SegmentedStats result;
+    if (offset_count < 2) return result;
+    result.segments = offset_count - 1;
+    result.values.resize(StatisticsResult::FIELD_COUNT * result.segments);
+    calculate_segmented_into(amounts, n, offsets, offset_count, result.values.data(), pool);
+    return result;
+}
+
+SegmentedStats calculate_segmented(const std::vector<double>& amounts,
+                                   const std::vector<size_t>& offsets,
+                                   ThreadPool* pool) {
+    return calculate_segmented(amounts.data(), amounts.size(), offsets.data(), offsets.size(), pool);
+}
+
+// ==================== Result Output ====================
+
+StatisticsResult SegmentedStats::at(size_t s) const {
+    StatisticsResult r;
+    r.sum = field(0)[s];
+    r.mean = field(1)[s];
+    r.median = field(2)[s];
+    r.mode = field(3)[s];
+    r.variance = field(4)[s];
+    r.stddev = field(5)[s];
+    r.min = field(6)[s];
+    r.max = field(7)[s];
+    r.range = field(8)[s];
+    r.q1 = field(9)[s];
+    r.q3 = field(10)[s];
+    r.iqr = field(11)[s];
+    r.count = static_cast<size_t>(field(12)[s]);
+    return r;
+}
+
+std::string SegmentedStats::to_json() const {
+    JsonWriter out(16 + segments * 200);
+    write_json(out);
+    return out.str();
+}
+
+void SegmentedStats::write_json(JsonWriter& out) const {
+    out.raw('[');
+    for (size_t s = 0; s < segments; ++s) {
+        if (s > 0) out.raw(',');
+        at(s).write_json(out);
+    }
+    out.raw(']');
+}
+
+} // namespace expense
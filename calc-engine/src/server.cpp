@@ -0,0 +1,337 @@
+/**
+ * Calculation Server Implementation
+ * 
+ * The main thread polls the listening socket and every idle connection.
+ * When a connection becomes readable it is handed to a fixed pool of
+ * worker threads, which serve one length-prefixed frame and hand the
+ * connection back. Idle connections therefore never hold a worker, and
+ * any number of pooled client connections share the workers fairly.
+ * Reads and writes on a connection time out, so a client that stalls
+ * mid-frame costs a worker at most io_timeout_ms and cannot block shutdown.
+ * 
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#include "server.hpp"
+#include "request_handler.hpp"
+#include <iostream>
+
+#if defined(_WIN32)
+
+namespace expense {
+
+int run_server(const ServerOptions&) {
+    std::cerr << "--serve requires Unix domain sockets and is not supported on Windows\n";
+    return 1;
+}
+
+} // namespace expense
+
+#else
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <csignal>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace expense {
+
+namespace {
+
+std::atomic<bool> g_stop{false};
+
+void handle_signal(int) {
+    g_stop = true;
+}
+
+/**
+ * Bound blocking recv/send on a client socket; they then fail with
+ * EAGAIN, which read_exact / write_exact treat as a closed connection.
+ */
+void set_io_timeout(int fd, unsigned timeout_ms) {
+    timeval tv{};
+    tv.tv_sec = static_cast<time_t>(timeout_ms / 1000);
+    tv.tv_usec = static_cast<suseconds_t>((timeout_ms % 1000) * 1000);
+    ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    ::setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+}
+
+bool read_exact(int fd, char* buf, size_t len) {
+    while (len > 0) {
+        ssize_t got = ::recv(fd, buf, len, 0);
+        if (got < 0 && errno == EINTR) continue;
+        if (got <= 0) return false;
+        buf += got;
+        len -= static_cast<size_t>(got);
+    }
+    return true;
+}
+
+bool write_exact(int fd, const char* buf, size_t len) {
+    while (len > 0) {
+        ssize_t sent = ::send(fd, buf, len, MSG_NOSIGNAL);
+        if (sent < 0 && errno == EINTR) continue;
+        if (sent <= 0) return false;
+        buf += sent;
+        len -= static_cast<size_t>(sent);
+    }
+    return true;
+}
+
+bool write_frame(int fd, const char* payload, size_t size) {
+    uint32_t len = static_cast<uint32_t>(size);
+    char header[4] = {
+        static_cast<char>(len >> 24), static_cast<char>(len >> 16),
+        static_cast<char>(len >> 8), static_cast<char>(len)
+    };
+    return write_exact(fd, header, 4) && write_exact(fd, payload, size);
+}
+
+/**
+ * Serve one frame on a readable connection.
+ * @return false if the connection should be closed (EOF, error or an
+ *         oversized frame)
+ */
+bool serve_frame(int fd, const ServerOptions& options, std::string& payload, JsonWriter& response) {
+    unsigned char header[4];
+    if (!read_exact(fd, reinterpret_cast<char*>(header), 4)) return false;
+    
+    uint32_t len = (uint32_t(header[0]) << 24) | (uint32_t(header[1]) << 16) |
+                   (uint32_t(header[2]) << 8) | uint32_t(header[3]);
+    response.clear();
+    if (len > options.max_frame_bytes) {
+        write_error_json(response, "Request exceeds maximum frame size");
+        write_frame(fd, response.data(), response.size());
+        return false;
+    }
+    
+    payload.resize(len);
+    if (!read_exact(fd, &payload[0], len)) return false;
+    
+    handle_request(payload.data(), payload.data() + payload.size(), options.request, response);
+    return write_frame(fd, response.data(), response.size());
+}
+
+/**
+ * Blocking queue of readable client sockets.
+ */
+class ConnectionQueue {
+public:
+    void push(int fd) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            fds_.push_back(fd);
+        }
+        ready_.notify_one();
+    }
+    
+    /**
+     * @return -1 once closed and drained
+     */
+    int pop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ready_.wait(lock, [this] { return closed_ || !fds_.empty(); });
+        if (fds_.empty()) return -1;
+        int fd = fds_.front();
+        fds_.pop_front();
+        return fd;
+    }
+    
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+        }
+        ready_.notify_all();
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::deque<int> fds_;
+    bool closed_ = false;
+};
+
+/**
+ * Connections workers have finished a frame on, waiting to rejoin the
+ * poll set. A self-pipe wakes the poll loop when one is returned.
+ */
+class IdleReturns {
+public:
+    IdleReturns() {
+        if (::pipe(pipe_) != 0) {
+            pipe_[0] = pipe_[1] = -1;
+            return;
+        }
+        // Non-blocking: draining stops when empty, a full pipe is already a wake-up
+        ::fcntl(pipe_[0], F_SETFL, O_NONBLOCK);
+        ::fcntl(pipe_[1], F_SETFL, O_NONBLOCK);
+    }
+    
+    ~IdleReturns() {
+        for (int fd : fds_) ::close(fd);
+        if (pipe_[0] >= 0) ::close(pipe_[0]);
+        if (pipe_[1] >= 0) ::close(pipe_[1]);
+    }
+    
+    bool ok() const { return pipe_[0] >= 0; }
+    int wake_fd() const { return pipe_[0]; }
+    
+    void push(int fd) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            fds_.push_back(fd);
+        }
+        const char byte = 0;
+        while (::write(pipe_[1], &byte, 1) < 0 && errno == EINTR) {
+        }
+    }
+    
+    /**
+     * Drain the wake pipe and move returned connections into idle.
+     */
+    void take(std::vector<int>& idle) {
+        char drain[64];
+        while (::read(pipe_[0], drain, sizeof(drain)) > 0) {
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        idle.insert(idle.end(), fds_.begin(), fds_.end());
+        fds_.clear();
+    }
+
+private:
+    int pipe_[2];
+    std::mutex mutex_;
+    std::vector<int> fds_;
+};
+
+} // namespace
+
+int run_server(const ServerOptions& options) {
+    sockaddr_un addr{};
+    if (options.socket_path.empty() || options.socket_path.size() >= sizeof(addr.sun_path)) {
+        std::cerr << "Invalid socket path: " << options.socket_path << "\n";
+        return 1;
+    }
+    
+    int listen_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0) {
+        std::cerr << "socket: " << std::strerror(errno) << "\n";
+        return 1;
+    }
+    
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, options.socket_path.c_str(), sizeof(addr.sun_path) - 1);
+    
+    // Replace a stale socket from an earlier run, but never another kind of file
+    struct stat existing;
+    if (::lstat(options.socket_path.c_str(), &existing) == 0) {
+        if (!S_ISSOCK(existing.st_mode)) {
+            std::cerr << "Refusing to replace " << options.socket_path << ": not a socket\n";
+            ::close(listen_fd);
+            return 1;
+        }
+        ::unlink(options.socket_path.c_str());
+    }
+    
+    if (::bind(listen_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 ||
+        ::listen(listen_fd, SOMAXCONN) < 0) {
+        std::cerr << "bind/listen " << options.socket_path << ": " << std::strerror(errno) << "\n";
+        ::close(listen_fd);
+        return 1;
+    }
+    
+    std::signal(SIGPIPE, SIG_IGN);
+    std::signal(SIGINT, handle_signal);
+    std::signal(SIGTERM, handle_signal);
+    
+    unsigned workers = options.workers;
+    if (workers == 0) workers = std::max(1u, std::thread::hardware_concurrency());
+    
+    IdleReturns returns;
+    if (!returns.ok()) {
+        std::cerr << "pipe: " << std::strerror(errno) << "\n";
+        ::close(listen_fd);
+        return 1;
+    }
+    
+    ConnectionQueue queue;
+    std::vector<std::thread> pool;
+    pool.reserve(workers);
+    for (unsigned i = 0; i < workers; ++i) {
+        pool.emplace_back([&queue, &returns, &options] {
+            std::string payload;
+            JsonWriter response;     // reused across frames; keeps its capacity
+            for (int fd; (fd = queue.pop()) >= 0; ) {
+                if (serve_frame(fd, options, payload, response)) {
+                    returns.push(fd);
+                } else {
+                    ::close(fd);
+                }
+            }
+        });
+    }
+    
+    std::cerr << "calc_engine serving on " << options.socket_path
+              << " with " << workers << " workers\n";
+    
+    // One poll set: listener, wake pipe, then every idle connection.
+    // Poll with a timeout so shutdown signals are noticed promptly.
+    std::vector<int> idle;
+    std::vector<pollfd> fds;
+    while (!g_stop) {
+        fds.clear();
+        fds.push_back(pollfd{listen_fd, POLLIN, 0});
+        fds.push_back(pollfd{returns.wake_fd(), POLLIN, 0});
+        for (int fd : idle) fds.push_back(pollfd{fd, POLLIN, 0});
+        
+        int ready = ::poll(fds.data(), static_cast<nfds_t>(fds.size()), 250);
+        if (ready <= 0) continue;
+        
+        // Hand readable (or hung-up) connections to the workers
+        size_t kept = 0;
+        for (size_t i = 0; i < idle.size(); ++i) {
+            if (fds[i + 2].revents != 0) {
+                queue.push(idle[i]);
+            } else {
+                idle[kept++] = idle[i];
+            }
+        }
+        idle.resize(kept);
+        
+        if (fds[1].revents != 0) returns.take(idle);
+        if (fds[0].revents & POLLIN) {
+            int client = ::accept(listen_fd, nullptr, nullptr);
+            if (client >= 0) {
+                if (options.io_timeout_ms > 0) set_io_timeout(client, options.io_timeout_ms);
+                idle.push_back(client);
+            }
+        }
+    }
+    
+    queue.close();
+    for (auto& t : pool) t.join();
+    for (int fd : idle) ::close(fd);
+    ::close(listen_fd);
+    ::unlink(options.socket_path.c_str());
+    
+    return 0;
+}
+
+} // namespace expense
+
+#endif
@@ -0,0 +1,48 @@
+/**
+ * Calculation Server Header
+ * 
+ * Long-lived `calc_engine --serve` mode: a Unix domain socket daemon so
+ * the backend can reuse pooled connections instead of spawning a process
+ * per request.
+ * 
+ * Wire protocol (both directions):
+ *   4-byte big-endian payload length, then the payload.
+ * Request payload: the CLI input format (optional count, then values).
+ * Response payload: the same JSON the CLI prints.
+ * A connection may carry any number of request/response pairs.
+ * 
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#ifndef EXPENSE_SERVER_HPP
+#define EXPENSE_SERVER_HPP
+
+#include "request_handler.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace expense {
+
+/**
+ * Server configuration.
+ */
+struct ServerOptions {
+    std::string socket_path;
+    unsigned workers = 0;          // 0 = hardware concurrency
+    RequestOptions request;
+    uint32_t max_frame_bytes = 64u * 1024 * 1024;
+    unsigned io_timeout_ms = 5000; // a frame stalled this long closes its connection
+};
+
+/**
+ * Serve until SIGINT/SIGTERM.
+ * 
+ * @return Process exit code
+ */
+int run_server(const ServerOptions& options);
+
+} // namespace expense
+
+#endif // EXPENSE_SERVER_HPP
@@ -0,0 +1,127 @@
+/**
+ * SIMD Reduction Kernels - Runtime Dispatch
+ * 
+ * Detects the best supported instruction set with CPUID/XGETBV and
+ * resolves the matching kernel table once.
+ * 
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#include "simd_kernels.hpp"
+#include "kernels/lane_kernels.hpp"
+#include <stdexcept>
+
+#if defined(EXPENSE_X86_KERNELS)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace expense {
+namespace kernels {
+
+namespace {
+
+#if defined(EXPENSE_X86_KERNELS)
+
+void cpuid(unsigned leaf, unsigned subleaf, unsigned regs[4]) {
+#if defined(_MSC_VER)
+    int out[4];
+    __cpuidex(out, static_cast<int>(leaf), static_cast<int>(subleaf));
+    for (int i = 0; i < 4; ++i) regs[i] = static_cast<unsigned>(out[i]);
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+unsigned long long xgetbv0() {
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    unsigned lo, hi;
+    __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return (static_cast<unsigned long long>(hi) << 32) | lo;
+#endif
+}
+
+Isa probe_isa() {
+    unsigned regs[4];
+    cpuid(0, 0, regs);
+    unsigned max_leaf = regs[0];
+    
+    cpuid(1, 0, regs);
+    bool sse2 = (regs[3] >> 26) & 1;
+    bool osxsave = (regs[2] >> 27) & 1;
+    bool avx = (regs[2] >> 28) & 1;
+    
+    if (!sse2) return Isa::Scalar;
+    if (!osxsave || !avx || max_leaf < 7) return Isa::SSE2;
+    
+    // OS must save YMM (bits 1-2) and, for AVX-512, opmask/ZMM (bits 5-7).
+    unsigned long long xcr0 = xgetbv0();
+    bool ymm_state = (xcr0 & 0x6) == 0x6;
+    bool zmm_state = (xcr0 & 0xE6) == 0xE6;
+    
+    cpuid(7, 0, regs);
+    bool avx2 = (regs[1] >> 5) & 1;
+    bool avx512f = (regs[1] >> 16) & 1;
+    
+    if (avx512f && zmm_state) return Isa::AVX512;
+    if (avx2 && ymm_state) return Isa::AVX2;
+    return Isa::SSE2;
+}
+
+#else
+
+Isa probe_isa() {
+    return Isa::Scalar;
+}
+
+#endif
+
+} // namespace
+
+Isa detect_isa() {
+    static const Isa detected = probe_isa();
+    return detected;
+}
+
+bool isa_supported(Isa isa) {
+    return static_cast<int>(isa) <= static_cast<int>(detect_isa());
+}
+
+const KernelTable& table(Isa isa) {
+    if (!isa_supported(isa)) {
+        throw std::invalid_argument(std::string("Instruction set not supported: ") + isa_name(isa));
+    }
+    
+    switch (isa) {
+#if defined(EXPENSE_X86_KERNELS)
+        case Isa::SSE2:   return SSE2_KERNELS;
+        case Isa::AVX2:   return AVX2_KERNELS;
+        case Isa::AVX512: return AVX512_KERNELS;
+#endif
+        default:          return SCALAR_KERNELS;
+    }
+}
+
+const KernelTable& active() {
+    static const KernelTable& selected = table(detect_isa());
+    return selected;
+}
+
+const char* isa_name(Isa isa) {
+    switch (isa) {
+        case Isa::SSE2:   return "sse2";
+        case Isa::AVX2:   return "avx2";
+        case Isa::AVX512: return "avx512";
+        default:          return "scalar";
+    }
+}
+
+} // namespace kernels
+} // namespace expense
@@ -0,0 +1,436 @@
+/**
+ * Expense Snapshot Implementation
+ *
+ * Column encoders and validation for the snapshot layout documented in
+ * snapshot.hpp, on top of the byte helpers in binary_io.hpp.
+ *
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#include "snapshot.hpp"
+#include "binary_io.hpp"
+#include "money.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace expense {
+
+namespace {
+
+using detail::Cursor;
+using detail::load;
+using detail::put;
+using detail::put_varint;
+
+const char MAGIC[8] = {'E', 'X', 'P', 'S', 'N', 'A', 'P', '\0'};
+constexpr size_t HEADER_BYTES = 32;
+constexpr size_t DIRECTORY_ENTRY_BYTES = 56;
+constexpr size_t TRAILER_BYTES = 24;
+constexpr double MAX_AMOUNT = 1e13;             // rupees
+constexpr uint32_t UNSET = std::numeric_limits<uint32_t>::max();
+
+bool little_endian_host() {
+    const uint16_t probe = 1;
+    unsigned char first = 0;
+    std::memcpy(&first, &probe, 1);
+    return first == 1;
+}
+
+[[noreturn]] void corrupt(const std::string& what) {
+    detail::corrupt("snapshot", what);
+}
+
+/**
+ * a + b, or std::invalid_argument if it overflows int64.
+ */
+int64_t checked_add(int64_t a, int64_t b) {
+    if ((b > 0 && a > std::numeric_limits<int64_t>::max() - b) ||
+        (b < 0 && a < std::numeric_limits<int64_t>::min() - b)) {
+        throw std::invalid_argument("Snapshot amount sum overflows int64 paise");
+    }
+    return a + b;
+}
+
+// ==================== Encoding ====================
+
+/**
+ * Chunk dictionary (ascending ids, delta varints), bit width, then the
+ * LSB-first packed index of every row into that dictionary. `local` maps
+ * global id -> chunk index; it holds UNSET everywhere on entry and exit.
+ */
+template <typename T>
+void encode_ids(std::string& out, const T* ids, size_t n, std::vector<uint32_t>& local,
+                const char* column) {
+    std::vector<uint32_t> distinct;
+    for (size_t i = 0; i < n; ++i) {
+        uint32_t id = ids[i];
+        if (id >= local.size()) {
+            throw std::invalid_argument(std::string("Snapshot ") + column + " id out of range: " +
+                                        std::to_string(id));
+        }
+        if (local[id] == UNSET) {
+            local[id] = 0;
+            distinct.push_back(id);
+        }
+    }
+    std::sort(distinct.begin(), distinct.end());
+
+    put_varint(out, distinct.size());
+    uint32_t previous = 0;
+    for (size_t k = 0; k < distinct.size(); ++k) {
+        local[distinct[k]] = static_cast<uint32_t>(k);
+        put_varint(out, distinct[k] - previous);
+        previous = distinct[k];
+    }
+
+    unsigned bits = 0;
+    while ((size_t{1} << bits) < distinct.size()) ++bits;
+    out.push_back(static_cast<char>(bits));
+
+    // At most 7 pending bits + 32 new ones fit in the 64-bit buffer
+    uint64_t buffer = 0;
+    unsigned filled = 0;
+    for (size_t i = 0; i < n && bits > 0; ++i) {
+        buffer |= static_cast<uint64_t>(local[ids[i]]) << filled;
+        filled += bits;
+        while (filled >= 8) {
+            out.push_back(static_cast<char>(buffer & 0xFF));
+            buffer >>= 8;
+            filled -= 8;
+        }
+    }
+    if (filled > 0) out.push_back(static_cast<char>(buffer & 0xFF));
+
+    for (uint32_t id : distinct) local[id] = UNSET;
+}
+
+void encode_dictionary(std::string& out, const StringDictionary& dictionary) {
+    put_varint(out, dictionary.size());
+    for (uint32_t id = 0; id < dictionary.size(); ++id) {
+        const std::string& name = dictionary.name(id);
+        put_varint(out, name.size());
+        out.append(name);
+    }
+}
+
+// ==================== Decoding ====================
+
+/**
+ * Inverse of encode_ids: global id of each of n rows, each < id_limit.
+ */
+void decode_ids(Cursor& in, size_t n, size_t id_limit, std::vector<uint32_t>& out) {
+    uint64_t count = in.varint();
+    if (count > id_limit || (n > 0 && count == 0)) corrupt("chunk dictionary size");
+    std::vector<uint32_t> dictionary(static_cast<size_t>(count));
+    uint64_t id = 0;
+    for (size_t k = 0; k < dictionary.size(); ++k) {
+        uint64_t delta = in.varint();
+        if (k > 0 && delta == 0) corrupt("chunk dictionary not ascending");
+        id += delta;
+        if (id >= id_limit) corrupt("chunk dictionary id out of range");
+        dictionary[k] = static_cast<uint32_t>(id);
+    }
+
+    unsigned bits = static_cast<uint8_t>(*in.take(1));
+    if (bits > 32) corrupt("bit width above 32");
+    const size_t bytes = static_cast<size_t>((static_cast<uint64_t>(n) * bits + 7) / 8);
+    const char* packed = in.take(bytes);
+    const uint64_t mask = (uint64_t{1} << bits) - 1;
+
+    out.resize(n);
+    if (bits == 0) {
+        std::fill(out.begin(), out.end(), n > 0 ? dictionary[0] : 0);
+        return;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        const uint64_t bit = static_cast<uint64_t>(i) * bits;
+        const size_t byte = static_cast<size_t>(bit >> 3);
+        uint64_t window = 0;
+        if (byte + 8 <= bytes) {
+            window = load<uint64_t>(packed + byte);
+        } else {
+            for (size_t j = 0; byte + j < bytes; ++j) {
+                window |= static_cast<uint64_t>(static_cast<unsigned char>(packed[byte + j])) << (8 * j);
+            }
+        }
+        uint64_t index = (window >> (bit & 7)) & mask;
+        if (index >= dictionary.size()) corrupt("packed index out of range");
+        out[i] = dictionary[static_cast<size_t>(index)];
+    }
+}
+
+void decode_dictionary(Cursor& in, StringDictionary& dictionary) {
+    uint64_t count = in.varint();
+    if (count > in.remaining()) corrupt("dictionary size");
+    for (uint64_t id = 0; id < count; ++id) {
+        uint64_t length = in.varint();
+        if (length > in.remaining()) corrupt("dictionary name length");
+        const char* name = in.take(static_cast<size_t>(length));
+        if (dictionary.intern(std::string(name, static_cast<size_t>(length))) != id) {
+            corrupt("duplicate dictionary name");
+        }
+    }
+}
+
+} // namespace
+
+// ==================== Writing ====================
+
+std::string encode_snapshot(const ExpenseTable& table, size_t chunk_rows) {
+    if (chunk_rows == 0 || chunk_rows > std::numeric_limits<uint32_t>::max()) {
+        throw std::invalid_argument("Snapshot chunk rows must be in [1, 2^32 - 1]");
+    }
+
+    const size_t rows = table.size();
+    const size_t chunk_count = (rows + chunk_rows - 1) / chunk_rows;
+    ColumnView<double> amounts = table.amounts();
+    ColumnView<int32_t> dates = table.dates();
+
+    std::string out;
+    out.reserve(HEADER_BYTES + rows * 12 + chunk_count * DIRECTORY_ENTRY_BYTES + TRAILER_BYTES);
+    out.append(MAGIC, sizeof(MAGIC));
+    put<uint32_t>(out, SNAPSHOT_VERSION);
+    put<uint32_t>(out, static_cast<uint32_t>(chunk_rows));
+    put<uint64_t>(out, rows);
+    put<uint32_t>(out, static_cast<uint32_t>(chunk_count));
+    put<uint32_t>(out, 0);
+
+    std::vector<uint32_t> category_local(CATEGORY_COUNT, UNSET);
+    std::vector<uint32_t> merchant_local(table.merchants().size(), UNSET);
+    std::vector<uint32_t> payment_local(table.payment_methods().size(), UNSET);
+    std::vector<uint32_t> recurring_local(2, UNSET);
+
+    std::string directory;
+    directory.reserve(chunk_count * DIRECTORY_ENTRY_BYTES);
+    int64_t file_sum = 0;
+
+    for (size_t first = 0; first < rows; first += chunk_rows) {
+        const size_t n = std::min(chunk_rows, rows - first);
+        while (out.size() % 8 != 0) out.push_back('\0');
+        const size_t offset = out.size();
+
+        SnapshotChunk stats;
+        stats.rows = n;
+        stats.amount_min = std::numeric_limits<int64_t>::max();
+        stats.amount_max = std::numeric_limits<int64_t>::min();
+        for (size_t i = first; i < first + n; ++i) {
+            if (!(std::fabs(amounts[i]) <= MAX_AMOUNT)) {
+                throw std::invalid_argument("Amount out of snapshot range: " + std::to_string(amounts[i]));
+            }
+            int64_t paise = Money::from_double(amounts[i]).paise();
+            stats.amount_min = std::min(stats.amount_min, paise);
+            stats.amount_max = std::max(stats.amount_max, paise);
+            stats.amount_sum = checked_add(stats.amount_sum, paise);
+            put<int64_t>(out, paise);
+        }
+        file_sum = checked_add(file_sum, stats.amount_sum);
+
+        const size_t encoded_start = out.size();
+        stats.date_min = stats.date_max = dates[first];
+        put<int32_t>(out, dates[first]);
+        for (size_t i = first + 1; i < first + n; ++i) {
+            stats.date_min = std::min(stats.date_min, dates[i]);
+            stats.date_max = std::max(stats.date_max, dates[i]);
+            put_varint(out, detail::zigzag(static_cast<int64_t>(dates[i]) - dates[i - 1]));
+        }
+        encode_ids(out, table.categories().data + first, n, category_local, "category");
+        encode_ids(out, table.merchant_ids().data + first, n, merchant_local, "merchant");
+        encode_ids(out, table.payment_method_ids().data + first, n, payment_local, "payment method");
+        encode_ids(out, table.recurring().data + first, n, recurring_local, "recurring");
+
+        put<uint64_t>(directory, offset);
+        put<uint64_t>(directory, out.size() - encoded_start);
+        put<uint32_t>(directory, static_cast<uint32_t>(n));
+        put<int32_t>(directory, stats.date_min);
+        put<int32_t>(directory, stats.date_max);
+        put<uint32_t>(directory, 0);
+        put<int64_t>(directory, stats.amount_min);
+        put<int64_t>(directory, stats.amount_max);
+        put<int64_t>(directory, stats.amount_sum);
+    }
+
+    const size_t dictionary_offset = out.size();
+    encode_dictionary(out, table.merchants());
+    encode_dictionary(out, table.payment_methods());
+
+    const size_t directory_offset = out.size();
+    out.append(directory);
+    put<uint64_t>(out, dictionary_offset);
+    put<uint64_t>(out, directory_offset);
+    out.append(MAGIC, sizeof(MAGIC));
+    return out;
+}
+
+void write_snapshot(const ExpenseTable& table, const std::string& path, size_t chunk_rows) {
+    const std::string bytes = encode_snapshot(table, chunk_rows);
+    std::FILE* stream = std::fopen(path.c_str(), "wb");
+    if (stream == nullptr) {
+        throw std::runtime_error("Cannot write snapshot file: " + path);
+    }
+    bool ok = std::fwrite(bytes.data(), 1, bytes.size(), stream) == bytes.size();
+    ok = std::fclose(stream) == 0 && ok;
+    if (!ok) {
+        throw std::runtime_error("Cannot write snapshot file: " + path);
+    }
+}
+
+// ==================== Reading ====================
+
+SnapshotReader::SnapshotReader(const std::string& path)
+    : file_(new MappedFile(path)) {
+    open(file_->data(), file_->size());
+}
+
+SnapshotReader::SnapshotReader(const char* data, size_t size) {
+    open(data, size);
+}
+
+void SnapshotReader::open(const char* data, size_t size) {
+    if (size < HEADER_BYTES + TRAILER_BYTES || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("Not an expense snapshot");
+    }
+    const uint32_t version = load<uint32_t>(data + 8);
+    if (version != SNAPSHOT_VERSION) {
+        throw std::runtime_error("Unsupported snapshot version " + std::to_string(version));
+    }
+    const uint32_t chunk_rows = load<uint32_t>(data + 12);
+    const uint64_t rows = load<uint64_t>(data + 16);
+    const uint32_t chunk_count = load<uint32_t>(data + 24);
+
+    const char* trailer = data + size - TRAILER_BYTES;
+    if (std::memcmp(trailer + 16, MAGIC, sizeof(MAGIC)) != 0) corrupt("missing trailer (truncated file?)");
+    const uint64_t dictionary_offset = load<uint64_t>(trailer);
+    const uint64_t directory_offset = load<uint64_t>(trailer + 8);
+    const uint64_t directory_end = size - TRAILER_BYTES;
+    if (directory_offset > directory_end || dictionary_offset > directory_offset ||
+        dictionary_offset < HEADER_BYTES ||
+        directory_end - directory_offset != static_cast<uint64_t>(chunk_count) * DIRECTORY_ENTRY_BYTES) {
+        corrupt("section offsets");
+    }
+
+    Cursor dictionaries(data + dictionary_offset, data + directory_offset, "snapshot");
+    decode_dictionary(dictionaries, merchants_);
+    decode_dictionary(dictionaries, payment_methods_);
+    if (dictionaries.remaining() != 0) corrupt("trailing bytes after dictionaries");
+
+    Cursor directory(data + directory_offset, data + directory_end, "snapshot");
+    chunks_.reserve(chunk_count);
+    layouts_.reserve(chunk_count);
+    uint64_t total = 0;
+    for (uint32_t c = 0; c < chunk_count; ++c) {
+        ChunkLayout layout;
+        SnapshotChunk chunk;
+        const uint64_t offset = directory.fixed<uint64_t>();
+        const uint64_t encoded = directory.fixed<uint64_t>();
+        chunk.rows = directory.fixed<uint32_t>();
+        chunk.date_min = directory.fixed<int32_t>();
+        chunk.date_max = directory.fixed<int32_t>();
+        directory.fixed<uint32_t>();
+        chunk.amount_min = directory.fixed<int64_t>();
+        chunk.amount_max = directory.fixed<int64_t>();
+        chunk.amount_sum = directory.fixed<int64_t>();
+
+        if (chunk.rows == 0 || chunk.rows > chunk_rows || offset % 8 != 0 || offset < HEADER_BYTES ||
+            offset > dictionary_offset || chunk.rows * 8 > dictionary_offset - offset ||
+            encoded > dictionary_offset - offset - chunk.rows * 8) {
+            corrupt("chunk " + std::to_string(c) + " bounds");
+        }
+        layout.offset = static_cast<size_t>(offset);
+        layout.encoded_bytes = static_cast<size_t>(encoded);
+        total += chunk.rows;
+        chunks_.push_back(chunk);
+        layouts_.push_back(layout);
+    }
+    if (total != rows) corrupt("chunk rows do not add up to the header row count");
+
+    data_ = data;
+    rows_ = static_cast<size_t>(rows);
+}
+
+SnapshotChunk SnapshotReader::summary() const {
+    SnapshotChunk total;
+    for (const SnapshotChunk& chunk : chunks_) {
+        if (total.rows == 0) {
+            total = chunk;
+            continue;
+        }
+        total.rows += chunk.rows;
+        total.amount_min = std::min(total.amount_min, chunk.amount_min);
+        total.amount_max = std::max(total.amount_max, chunk.amount_max);
+        total.amount_sum += chunk.amount_sum;
+        total.date_min = std::min(total.date_min, chunk.date_min);
+        total.date_max = std::max(total.date_max, chunk.date_max);
+    }
+    return total;
+}
+
+ColumnView<int64_t> SnapshotReader::amount_paise(size_t i, std::vector<int64_t>& scratch) const {
+    const size_t n = chunks_.at(i).rows;
+    const char* p = data_ + layouts_[i].offset;
+    if (little_endian_host() && reinterpret_cast<uintptr_t>(p) % alignof(int64_t) == 0) {
+        return {reinterpret_cast<const int64_t*>(p), n};
+    }
+    scratch.resize(n);
+    for (size_t k = 0; k < n; ++k) scratch[k] = load<int64_t>(p + 8 * k);
+    return {scratch.data(), n};
+}
+
+ExpenseTable SnapshotReader::read(size_t first_chunk, size_t last_chunk) const {
+    if (first_chunk > last_chunk || last_chunk > chunks_.size()) {
+        throw std::out_of_range("Snapshot chunk range out of bounds");
+    }
+
+    ExpenseTable table;
+    for (uint32_t id = 0; id < merchants_.size(); ++id) table.merchants().intern(merchants_.name(id));
+    for (uint32_t id = 0; id < payment_methods_.size(); ++id) {
+        table.payment_methods().intern(payment_methods_.name(id));
+    }
+    size_t rows = 0;
+    for (size_t c = first_chunk; c < last_chunk; ++c) rows += chunks_[c].rows;
+    table.reserve(rows);
+
+    std::vector<int64_t> scratch;
+    std::vector<uint32_t> categories, merchants, payment_methods, recurring;
+    for (size_t c = first_chunk; c < last_chunk; ++c) {
+        const size_t n = chunks_[c].rows;
+        ColumnView<int64_t> paise = amount_paise(c, scratch);
+        const char* encoded = data_ + layouts_[c].offset + n * 8;
+        Cursor in(encoded, encoded + layouts_[c].encoded_bytes, "snapshot");
+
+        // Dates are decoded on the fly; the id columns follow them
+        std::vector<int32_t> dates(n);
+        int64_t date = in.fixed<int32_t>();
+        dates[0] = static_cast<int32_t>(date);
+        for (size_t i = 1; i < n; ++i) {
+            date += detail::unzigzag(in.varint());
+            if (date < std::numeric_limits<int32_t>::min() || date > std::numeric_limits<int32_t>::max()) {
+                corrupt("date out of range");
+            }
+            dates[i] = static_cast<int32_t>(date);
+        }
+        decode_ids(in, n, CATEGORY_COUNT, categories);
+        decode_ids(in, n, merchants_.size(), merchants);
+        decode_ids(in, n, payment_methods_.size(), payment_methods);
+        decode_ids(in, n, 2, recurring);
+        if (in.remaining() != 0) corrupt("trailing bytes in chunk " + std::to_string(c));
+
+        for (size_t i = 0; i < n; ++i) {
+            ExpenseRecord record;
+            record.amount = static_cast<double>(paise[i]) / 100.0;
+            record.date = dates[i];
+            record.category = static_cast<Category>(categories[i]);
+            record.merchant = merchants[i];
+            record.payment_method = payment_methods[i];
+            record.recurring = recurring[i] != 0;
+            table.append(record);
+        }
+    }
+    return table;
+}
+
+} // namespace expense
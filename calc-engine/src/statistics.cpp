@@ -9,67 +9,354 @@
  */
 
 #include "statistics.hpp"
-#include <sstream>
-#include <iomanip>
+#include "simd_kernels.hpp"
+#include "json_writer.hpp"
+#include "rank_multiset.hpp"
+#include "execution.hpp"
+#include <memory>
 #include <unordered_map>
 
 namespace expense {
 
+namespace {
+
+/**
+ * Per-element-type policy for the templated statistics kernels.
+ * 
+ * raw() yields the value accumulated by sums (double for double, exact
+ * int64 paise for Money); DIVISOR converts accumulated raw units back to
+ * currency units.
+ */
+template <typename T>
+struct AmountTraits;
+
+template <>
+struct AmountTraits<double> {
+    using Accumulator = double;
+    static constexpr double DIVISOR = 1.0;
+    static double raw(double v) { return v; }
+    static double value(double v) { return v; }
+};
+
+template <>
+struct AmountTraits<Money> {
+    using Accumulator = int64_t;
+    static constexpr double DIVISOR = 100.0;
+    static int64_t raw(Money m) { return m.paise(); }
+    static double value(Money m) { return m.to_double(); }
+};
+
+/**
+ * Order-statistic ranks needed to interpolate a percentile (0-100)
+ * over n values: the floor and ceil of the fractional index.
+ */
+void percentile_ranks(size_t n, double p, size_t& lower, size_t& upper) {
+    if (p == 0) { lower = upper = 0; return; }
+    if (p == 100) { lower = upper = n - 1; return; }
+    
+    double index = (p / 100.0) * (n - 1);
+    lower = static_cast<size_t>(std::floor(index));
+    upper = static_cast<size_t>(std::ceil(index));
+}
+
+/**
+ * Linear-interpolation percentile read from a buffer in which the ranks
+ * reported by percentile_ranks() are already in their sorted positions
+ * (either a fully sorted buffer or the output of select_ranks()).
+ */
+template <typename T>
+double read_percentile(const T* buf, size_t n, double p) {
+    using Traits = AmountTraits<T>;
+    size_t lower, upper;
+    percentile_ranks(n, p, lower, upper);
+    
+    if (lower == upper) return Traits::value(buf[lower]);
+    
+    double index = (p / 100.0) * (n - 1);
+    double weight = index - lower;
+    return Traits::value(buf[lower]) * (1 - weight) + Traits::value(buf[upper]) * weight;
+}
+
+template <typename T>
+double read_percentile(const std::vector<T>& buf, double p) {
+    return read_percentile(buf.data(), buf.size(), p);
+}
+
+/**
+ * Multi-rank introselect: places every rank in ranks[lo, hi) (sorted,
+ * unique) at its sorted position within [first, last).
+ * Expected O(n log k) for k ranks; each nth_element splits both the
+ * range and the remaining ranks.
+ */
+void select_ranks(std::vector<double>& buf, size_t first, size_t last,
+                  const std::vector<size_t>& ranks, size_t lo, size_t hi) {
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        size_t r = ranks[mid];
+        std::nth_element(buf.begin() + first, buf.begin() + r, buf.begin() + last);
+        select_ranks(buf, first, r, ranks, lo, mid);
+        first = r + 1;
+        lo = mid + 1;
+    }
+}
+
+/**
+ * Partially orders buf so every percentile in ps can be read with
+ * read_percentile(). Validates the percentile range.
+ */
+void select_percentiles(std::vector<double>& buf, const std::vector<double>& ps) {
+    std::vector<size_t> ranks;
+    ranks.reserve(ps.size() * 2);
+    for (double p : ps) {
+        if (p < 0 || p > 100) {
+            throw std::invalid_argument("Percentile must be between 0 and 100");
+        }
+        size_t lower, upper;
+        percentile_ranks(buf.size(), p, lower, upper);
+        ranks.push_back(lower);
+        ranks.push_back(upper);
+    }
+    std::sort(ranks.begin(), ranks.end());
+    ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+    select_ranks(buf, 0, buf.size(), ranks, 0, ranks.size());
+}
+
+/**
+ * Fused single-sort statistics shared by the double and Money overloads.
+ * Sorts `sorted` in place. For Money, sum and the shifted first moment
+ * are exact integers.
+ */
+template <typename T>
+StatisticsResult fused_statistics_in_place(T* sorted, size_t n) {
+    using Traits = AmountTraits<T>;
+    using Acc = typename Traits::Accumulator;
+    
+    StatisticsResult result;
+    
+    if (n == 0) {
+        return result;
+    }
+    
+    // Single sort; every order statistic is read from it.
+    std::sort(sorted, sorted + n);
+    
+    result.count = n;
+    result.min = Traits::value(sorted[0]);
+    result.max = Traits::value(sorted[n - 1]);
+    result.range = result.max - result.min;
+    
+    if (n % 2 == 0) {
+        result.median = (Traits::value(sorted[n/2 - 1]) + Traits::value(sorted[n/2])) / 2.0;
+    } else {
+        result.median = Traits::value(sorted[n/2]);
+    }
+    // Sorted buffer has every rank in place, so read directly.
+    result.q1 = read_percentile(sorted, n, 25);
+    result.q3 = read_percentile(sorted, n, 75);
+    result.iqr = result.q3 - result.q1;
+    
+    // Fused sweep: sum, variance and mode in one pass over the sorted buffer.
+    // Variance uses sums shifted by the median, which keeps the
+    // one-pass formula numerically stable for large-magnitude amounts.
+    const Acc shift = Traits::raw(sorted[n/2]);
+    Acc total = 0;
+    Acc shifted_sum = 0;
+    double shifted_sq = 0.0;
+    
+    T mode_val = sorted[0];
+    size_t mode_count = 0;
+    size_t run_start = 0;
+    
+    for (size_t i = 0; i < n; ++i) {
+        Acc val = Traits::raw(sorted[i]);
+        total += val;
+        Acc d = val - shift;
+        shifted_sum += d;
+        double dd = static_cast<double>(d);
+        shifted_sq += dd * dd;
+        
+        // Equal values are adjacent; close the run at each boundary.
+        // Ties resolve to the smallest value.
+        if (i + 1 == n || sorted[i + 1] != sorted[i]) {
+            size_t run = i + 1 - run_start;
+            if (run > mode_count) {
+                mode_count = run;
+                mode_val = sorted[i];
+            }
+            run_start = i + 1;
+        }
+    }
+    
+    result.sum = static_cast<double>(total) / Traits::DIVISOR;
+    result.mean = result.sum / static_cast<double>(n);
+    result.mode = Traits::value(mode_val);
+    
+    if (n >= 2) {
+        double dn = static_cast<double>(n);
+        double s1 = static_cast<double>(shifted_sum);
+        result.variance = (shifted_sq - s1 * s1 / dn) / dn;
+        if (result.variance < 0) result.variance = 0.0;
+        result.variance /= Traits::DIVISOR * Traits::DIVISOR;
+    }
+    result.stddev = std::sqrt(result.variance);
+    
+    return result;
+}
+
+/**
+ * Fused statistics over a working copy of data.
+ */
+template <typename T>
+StatisticsResult fused_statistics(const T* data, size_t count) {
+    std::vector<T> sorted(data, data + count);
+    return fused_statistics_in_place(sorted.data(), count);
+}
+
+/**
+ * Pearson coefficient and its classification from centred second
+ * moments (sum of squared x and y deviations, sum of cross products).
+ */
+CorrelationResult correlation_from_moments(double sum_sq_x, double sum_sq_y, double numerator) {
+    CorrelationResult result;
+    
+    double denominator = std::sqrt(sum_sq_x * sum_sq_y);
+    
+    if (denominator == 0) {
+        result.pearson_coefficient = 0;
+    } else {
+        result.pearson_coefficient = numerator / denominator;
+    }
+    
+    result.r_squared = result.pearson_coefficient * result.pearson_coefficient;
+    
+    // Classify correlation strength
+    double abs_r = std::abs(result.pearson_coefficient);
+    if (abs_r >= 0.8) {
+        result.strength = "very_strong";
+    } else if (abs_r >= 0.6) {
+        result.strength = "strong";
+    } else if (abs_r >= 0.4) {
+        result.strength = "moderate";
+    } else if (abs_r >= 0.2) {
+        result.strength = "weak";
+    } else {
+        result.strength = "very_weak";
+    }
+    
+    // Direction
+    if (result.pearson_coefficient > 0.1) {
+        result.direction = "positive";
+    } else if (result.pearson_coefficient < -0.1) {
+        result.direction = "negative";
+    } else {
+        result.direction = "none";
+    }
+    
+    return result;
+}
+
+} // namespace
+
 // ==================== Result to JSON ====================
 
 std::string StatisticsResult::to_json() const {
-    std::ostringstream oss;
-    oss << std::fixed << std::setprecision(2);
-    oss << "{";
-    oss << "\"sum\":" << sum << ",";
-    oss << "\"mean\":" << mean << ",";
-    oss << "\"median\":" << median << ",";
-    oss << "\"mode\":" << mode << ",";
-    oss << "\"variance\":" << variance << ",";
-    oss << "\"stddev\":" << stddev << ",";
-    oss << "\"min\":" << min << ",";
-    oss << "\"max\":" << max << ",";
-    oss << "\"range\":" << range << ",";
-    oss << "\"q1\":" << q1 << ",";
-    oss << "\"q3\":" << q3 << ",";
-    oss << "\"iqr\":" << iqr << ",";
-    oss << "\"count\":" << count;
-    oss << "}";
-    return oss.str();
+    JsonWriter out(512);
+    write_json(out);
+    return out.str();
+}
+
+void StatisticsResult::write_json(JsonWriter& out) const {
+    out.raw("{\"sum\":").number(sum, 2);
+    out.raw(",\"mean\":").number(mean, 2);
+    out.raw(",\"median\":").number(median, 2);
+    out.raw(",\"mode\":").number(mode, 2);
+    out.raw(",\"variance\":").number(variance, 2);
+    out.raw(",\"stddev\":").number(stddev, 2);
+    out.raw(",\"min\":").number(min, 2);
+    out.raw(",\"max\":").number(max, 2);
+    out.raw(",\"range\":").number(range, 2);
+    out.raw(",\"q1\":").number(q1, 2);
+    out.raw(",\"q3\":").number(q3, 2);
+    out.raw(",\"iqr\":").number(iqr, 2);
+    out.raw(",\"count\":").integer(static_cast<unsigned long long>(count));
+    out.raw('}');
 }
 
 std::string MovingAverageResult::to_json() const {
-    std::ostringstream oss;
-    oss << std::fixed << std::setprecision(2);
-    oss << "{";
-    oss << "\"window_size\":" << window_size << ",";
-    oss << "\"current_average\":" << current_average << ",";
-    oss << "\"values\":[";
+    JsonWriter out(128 + values.size() * 12);
+    write_json(out);
+    return out.str();
+}
+
+void MovingAverageResult::write_json(JsonWriter& out) const {
+    out.raw("{\"window_size\":").integer(window_size);
+    out.raw(",\"current_average\":").number(current_average, 2);
+    out.raw(",\"values\":[");
     for (size_t i = 0; i < values.size(); ++i) {
-        if (i > 0) oss << ",";
-        oss << values[i];
+        if (i > 0) out.raw(',');
+        out.number(values[i], 2);
     }
-    oss << "]}";
-    return oss.str();
+    out.raw("]}");
 }
 
 std::string CorrelationResult::to_json() const {
-    std::ostringstream oss;
-    oss << std::fixed << std::setprecision(4);
-    oss << "{";
-    oss << "\"pearson_coefficient\":" << pearson_coefficient << ",";
-    oss << "\"r_squared\":" << r_squared << ",";
-    oss << "\"strength\":\"" << strength << "\",";
-    oss << "\"direction\":\"" << direction << "\"";
-    oss << "}";
-    return oss.str();
+    JsonWriter out(256);
+    write_json(out);
+    return out.str();
+}
+
+void CorrelationResult::write_json(JsonWriter& out) const {
+    out.raw("{\"pearson_coefficient\":").number(pearson_coefficient, 4);
+    out.raw(",\"r_squared\":").number(r_squared, 4);
+    out.raw(",\"strength\":").string(strength);
+    out.raw(",\"direction\":").string(direction);
+    out.raw('}');
+}
+
+// ==================== Result to Binary Layout ====================
+
+void StatisticsResult::to_array(double* out) const {
+    out[0] = sum;
+    out[1] = mean;
+    out[2] = median;
+    out[3] = mode;
+    out[4] = variance;
+    out[5] = stddev;
+    out[6] = min;
+    out[7] = max;
+    out[8] = range;
+    out[9] = q1;
+    out[10] = q3;
+    out[11] = iqr;
+    out[12] = static_cast<double>(count);
+}
+
+const char* const CorrelationResult::STRENGTH_NAMES[6] = {
+    "very_weak", "weak", "moderate", "strong", "very_strong", "invalid"
+};
+
+const char* const CorrelationResult::DIRECTION_NAMES[3] = {
+    "none", "positive", "negative"
+};
+
+void CorrelationResult::to_array(double* out) const {
+    out[0] = pearson_coefficient;
+    out[1] = r_squared;
+    out[2] = 5;
+    for (int i = 0; i < 6; ++i) {
+        if (strength == STRENGTH_NAMES[i]) out[2] = i;
+    }
+    out[3] = 0;
+    for (int i = 0; i < 3; ++i) {
+        if (direction == DIRECTION_NAMES[i]) out[3] = i;
+    }
 }
 
 // ==================== Basic Statistics ====================
 
 double StatisticsCalculator::sum(const std::vector<double>& data) {
     if (data.empty()) return 0.0;
-    return std::accumulate(data.begin(), data.end(), 0.0);
+    return kernels::sum(data.data(), data.size());
 }
 
 double StatisticsCalculator::mean(const std::vector<double>& data) {
@@ -80,12 +367,13 @@ double StatisticsCalculator::mean(const std::vector<double>& data) {
 double StatisticsCalculator::median(std::vector<double> data) {
     if (data.empty()) return 0.0;
     
-    std::sort(data.begin(), data.end());
     size_t n = data.size();
     
     if (n % 2 == 0) {
+        select_ranks(data, 0, n, {n/2 - 1, n/2}, 0, 2);
         return (data[n/2 - 1] + data[n/2]) / 2.0;
     } else {
+        std::nth_element(data.begin(), data.begin() + n/2, data.end());
         return data[n/2];
     }
 }
@@ -115,12 +403,7 @@ double StatisticsCalculator::variance(const std::vector<double>& data) {
     if (data.size() < 2) return 0.0;
     
     double m = mean(data);
-    double sum_sq = 0.0;
-    
-    for (double val : data) {
-        double diff = val - m;
-        sum_sq += diff * diff;
-    }
+    double sum_sq = kernels::sum_sq_dev(data.data(), data.size(), m);
     
     return sum_sq / static_cast<double>(data.size());
 }
@@ -129,12 +412,7 @@ double StatisticsCalculator::sample_variance(const std::vector<double>& data) {
     if (data.size() < 2) return 0.0;
     
     double m = mean(data);
-    double sum_sq = 0.0;
-    
-    for (double val : data) {
-        double diff = val - m;
-        sum_sq += diff * diff;
-    }
+    double sum_sq = kernels::sum_sq_dev(data.data(), data.size(), m);
     
     return sum_sq / static_cast<double>(data.size() - 1);
 }
@@ -149,70 +427,103 @@ double StatisticsCalculator::sample_stddev(const std::vector<double>& data) {
 
 double StatisticsCalculator::percentile(std::vector<double> data, double p) {
     if (data.empty()) return 0.0;
-    if (p < 0 || p > 100) {
-        throw std::invalid_argument("Percentile must be between 0 and 100");
-    }
     
-    std::sort(data.begin(), data.end());
-    
-    if (p == 0) return data.front();
-    if (p == 100) return data.back();
+    select_percentiles(data, {p});
+    return read_percentile(data, p);
+}
+
+std::vector<double> StatisticsCalculator::quantiles(
+    const std::vector<double>& data, const std::vector<double>& percentiles) {
+    return quantiles(data.data(), data.size(), percentiles);
+}
+
+std::vector<double> StatisticsCalculator::quantiles(
+    const double* data, size_t n, const std::vector<double>& percentiles) {
     
-    double index = (p / 100.0) * (data.size() - 1);
-    size_t lower = static_cast<size_t>(std::floor(index));
-    size_t upper = static_cast<size_t>(std::ceil(index));
+    std::vector<double> result(percentiles.size(), 0.0);
+    if (n == 0 || percentiles.empty()) return result;
     
-    if (lower == upper) return data[lower];
+    std::vector<double> buf(data, data + n);
+    select_percentiles(buf, percentiles);
     
-    double weight = index - lower;
-    return data[lower] * (1 - weight) + data[upper] * weight;
+    for (size_t i = 0; i < percentiles.size(); ++i) {
+        result[i] = read_percentile(buf, percentiles[i]);
+    }
+    return result;
 }
 
 // ==================== Comprehensive Statistics ====================
 
 StatisticsResult StatisticsCalculator::calculate_all(const std::vector<double>& data) {
-    StatisticsResult result;
-    
-    if (data.empty()) {
-        return result;
+    return fused_statistics(data.data(), data.size());
+}
+
+StatisticsResult StatisticsCalculator::calculate_all(const double* data, size_t n) {
+    return fused_statistics(data, n);
+}
+
+StatisticsResult StatisticsCalculator::calculate_all_in_place(double* data, size_t n) {
+    return fused_statistics_in_place(data, n);
+}
+
+StatisticsResult StatisticsCalculator::calculate_all(const std::vector<Money>& data) {
+    return fused_statistics(data.data(), data.size());
+}
+
+Money StatisticsCalculator::sum(const std::vector<Money>& data) {
+    // Plain int64 loop: exact, and the compiler vectorizes it.
+    int64_t total = 0;
+    for (Money m : data) {
+        total += m.paise();
+    }
+    return Money::from_paise(total);
+}
+
+Money StatisticsCalculator::mode(const std::vector<Money>& data) {
+    if (data.empty()) return Money();
+    
+    std::vector<Money> sorted(data);
+    std::sort(sorted.begin(), sorted.end());
+    
+    Money mode_val = sorted[0];
+    size_t max_count = 0;
+    size_t run_start = 0;
+    
+    for (size_t i = 0; i < sorted.size(); ++i) {
+        if (i + 1 == sorted.size() || sorted[i + 1] != sorted[i]) {
+            if (i + 1 - run_start > max_count) {
+                max_count = i + 1 - run_start;
+                mode_val = sorted[i];
+            }
+            run_start = i + 1;
+        }
     }
     
-    result.count = data.size();
-    result.sum = sum(data);
-    result.mean = result.sum / static_cast<double>(result.count);
-    result.median = median(data);
-    result.mode = mode(data);
-    result.variance = variance(data);
-    result.stddev = std::sqrt(result.variance);
-    
-    auto minmax = std::minmax_element(data.begin(), data.end());
-    result.min = *minmax.first;
-    result.max = *minmax.second;
-    result.range = result.max - result.min;
-    
-    result.q1 = percentile(data, 25);
-    result.q3 = percentile(data, 75);
-    result.iqr = result.q3 - result.q1;
-    
-    return result;
+    return mode_val;
 }
 
 // ==================== Moving Averages ====================
 
 MovingAverageResult StatisticsCalculator::moving_average(
     const std::vector<double>& data, int window) {
+    return moving_average(data.data(), data.size(), window);
+}
+
+MovingAverageResult StatisticsCalculator::moving_average(
+    const double* data, size_t n, int window) {
     
     MovingAverageResult result;
     result.window_size = window;
     
-    if (data.empty() || window <= 0) {
+    if (n == 0 || window <= 0) {
         return result;
     }
     
-    if (static_cast<size_t>(window) > data.size()) {
-        window = static_cast<int>(data.size());
+    if (static_cast<size_t>(window) > n) {
+        window = static_cast<int>(n);
         result.window_size = window;
     }
+    result.values.reserve(n - window + 1);
     
     // Calculate initial window sum
     double window_sum = 0.0;
@@ -222,7 +533,7 @@ MovingAverageResult StatisticsCalculator::moving_average(
     result.values.push_back(window_sum / window);
     
     // Sliding window - O(n) complexity
-    for (size_t i = window; i < data.size(); ++i) {
+    for (size_t i = window; i < n; ++i) {
         window_sum = window_sum - data[i - window] + data[i];
         result.values.push_back(window_sum / window);
     }
@@ -232,19 +543,105 @@ MovingAverageResult StatisticsCalculator::moving_average(
     return result;
 }
 
+// Rolling windows up to this size use a sorted buffer; shifting a few
+// cache lines beats the multiset's O(log n) random accesses.
+constexpr size_t SORTED_WINDOW_MAX = 128;
+
+MovingAverageResult StatisticsCalculator::rolling_median(
+    const std::vector<double>& data, int window) {
+    return rolling_quantile(data.data(), data.size(), window, 50);
+}
+
+MovingAverageResult StatisticsCalculator::rolling_median(
+    const double* data, size_t n, int window) {
+    return rolling_quantile(data, n, window, 50);
+}
+
+MovingAverageResult StatisticsCalculator::rolling_quantile(
+    const std::vector<double>& data, int window, double percentile) {
+    return rolling_quantile(data.data(), data.size(), window, percentile);
+}
+
+MovingAverageResult StatisticsCalculator::rolling_quantile(
+    const double* data, size_t n, int window, double percentile) {
+    
+    if (percentile < 0 || percentile > 100) {
+        throw std::invalid_argument("Percentile must be between 0 and 100");
+    }
+    
+    MovingAverageResult result;
+    result.window_size = window;
+    
+    if (n == 0 || window <= 0) {
+        return result;
+    }
+    
+    if (static_cast<size_t>(window) > n) {
+        window = static_cast<int>(n);
+        result.window_size = window;
+    }
+    const size_t w = static_cast<size_t>(window);
+    result.values.reserve(n - w + 1);
+    
+    // Window size is fixed, so the interpolation ranks are too
+    size_t lower, upper;
+    percentile_ranks(w, percentile, lower, upper);
+    double weight = (percentile / 100.0) * (w - 1) - lower;
+    
+    auto interpolate = [&](double lo, double hi) {
+        return lower == upper ? lo : lo * (1 - weight) + hi * weight;
+    };
+    
+    if (w <= SORTED_WINDOW_MAX) {
+        // Small windows: sorted buffer, binary search + shift per step
+        std::vector<double> sorted(data, data + w);
+        std::sort(sorted.begin(), sorted.end());
+        result.values.push_back(interpolate(sorted[lower], sorted[upper]));
+        for (size_t i = w; i < n; ++i) {
+            sorted.erase(std::lower_bound(sorted.begin(), sorted.end(), data[i - w]));
+            sorted.insert(std::upper_bound(sorted.begin(), sorted.end(), data[i]), data[i]);
+            result.values.push_back(interpolate(sorted[lower], sorted[upper]));
+        }
+    } else {
+        // Large windows: order-statistic multiset over value ranks
+        detail::RankMultiset window_set(data, n);
+        std::vector<size_t> ranks(n);
+        for (size_t i = 0; i < n; ++i) {
+            ranks[i] = window_set.rank_of(data[i]);
+        }
+        for (size_t i = 0; i < n; ++i) {
+            window_set.insert(ranks[i]);
+            if (i >= w) window_set.erase(ranks[i - w]);
+            if (i + 1 < w) continue;
+            double lo = window_set.kth(lower);
+            result.values.push_back(interpolate(lo, lower == upper ? lo : window_set.kth(upper)));
+        }
+    }
+    
+    result.current_average = result.values.back();
+    
+    return result;
+}
+
 MovingAverageResult StatisticsCalculator::exponential_moving_average(
     const std::vector<double>& data, double alpha) {
+    return exponential_moving_average(data.data(), data.size(), alpha);
+}
+
+MovingAverageResult StatisticsCalculator::exponential_moving_average(
+    const double* data, size_t n, double alpha) {
     
     MovingAverageResult result;
     result.window_size = -1; // Indicates EMA
     
-    if (data.empty() || alpha <= 0 || alpha > 1) {
+    if (n == 0 || alpha <= 0 || alpha > 1) {
         return result;
     }
     
+    result.values.reserve(n);
     result.values.push_back(data[0]);
     
-    for (size_t i = 1; i < data.size(); ++i) {
+    for (size_t i = 1; i < n; ++i) {
         double ema = alpha * data[i] + (1 - alpha) * result.values.back();
         result.values.push_back(ema);
     }
@@ -259,84 +656,64 @@ MovingAverageResult StatisticsCalculator::exponential_moving_average(
 CorrelationResult StatisticsCalculator::correlation(
     const std::vector<double>& x, const std::vector<double>& y) {
     
+    if (x.size() != y.size()) {
+        CorrelationResult result;
+        result.strength = "invalid";
+        result.direction = "none";
+        return result;
+    }
+    return correlation(x.data(), y.data(), x.size());
+}
+
+CorrelationResult StatisticsCalculator::correlation(
+    const double* x, const double* y, size_t n) {
+    
     CorrelationResult result;
     
-    if (x.size() != y.size() || x.size() < 2) {
+    if (n < 2) {
         result.strength = "invalid";
         result.direction = "none";
         return result;
     }
     
-    double mean_x = mean(x);
-    double mean_y = mean(y);
+    double mean_x = kernels::sum(x, n) / static_cast<double>(n);
+    double mean_y = kernels::sum(y, n) / static_cast<double>(n);
     
     double numerator = 0.0;
     double sum_sq_x = 0.0;
     double sum_sq_y = 0.0;
     
-    for (size_t i = 0; i < x.size(); ++i) {
-        double dx = x[i] - mean_x;
-        double dy = y[i] - mean_y;
-        numerator += dx * dy;
-        sum_sq_x += dx * dx;
-        sum_sq_y += dy * dy;
-    }
-    
-    double denominator = std::sqrt(sum_sq_x * sum_sq_y);
-    
-    if (denominator == 0) {
-        result.pearson_coefficient = 0;
-    } else {
-        result.pearson_coefficient = numerator / denominator;
-    }
-    
-    result.r_squared = result.pearson_coefficient * result.pearson_coefficient;
-    
-    // Classify correlation strength
-    double abs_r = std::abs(result.pearson_coefficient);
-    if (abs_r >= 0.8) {
-        result.strength = "very_strong";
-    } else if (abs_r >= 0.6) {
-        result.strength = "strong";
-    } else if (abs_r >= 0.4) {
-        result.strength = "moderate";
-    } else if (abs_r >= 0.2) {
-        result.strength = "weak";
-    } else {
-        result.strength = "very_weak";
-    }
-    
-    // Direction
-    if (result.pearson_coefficient > 0.1) {
-        result.direction = "positive";
-    } else if (result.pearson_coefficient < -0.1) {
-        result.direction = "negative";
-    } else {
-        result.direction = "none";
-    }
+    kernels::co_moments(x, y, n, mean_x, mean_y,
+                        &sum_sq_x, &sum_sq_y, &numerator);
     
-    return result;
+    return correlation_from_moments(sum_sq_x, sum_sq_y, numerator);
 }
 
 // ==================== Outlier Detection ====================
 
 std::vector<size_t> StatisticsCalculator::detect_outliers(
     const std::vector<double>& data, double threshold) {
+    return detect_outliers(data.data(), data.size(), threshold);
+}
+
+std::vector<size_t> StatisticsCalculator::detect_outliers(
+    const double* data, size_t n, double threshold) {
     
     std::vector<size_t> outliers;
     
-    if (data.size() < 4) {
+    if (n < 4) {
         return outliers;
     }
     
-    double q1 = percentile(data, 25);
-    double q3 = percentile(data, 75);
+    std::vector<double> quartiles = quantiles(data, n, {25, 75});
+    double q1 = quartiles[0];
+    double q3 = quartiles[1];
     double iqr = q3 - q1;
     
     double lower_bound = q1 - threshold * iqr;
     double upper_bound = q3 + threshold * iqr;
     
-    for (size_t i = 0; i < data.size(); ++i) {
+    for (size_t i = 0; i < n; ++i) {
         if (data[i] < lower_bound || data[i] > upper_bound) {
             outliers.push_back(i);
         }
@@ -369,4 +746,219 @@ std::vector<double> StatisticsCalculator::monthly_totals(
     return totals;
 }
 
+// ==================== Parallel Overloads ====================
+
+void StatisticsCalculator::sort(const ExecutionPolicy& policy, double* data, size_t n) {
+    policy.for_each_chunk(n, [&](size_t, size_t first, size_t last) {
+        std::sort(data + first, data + last);
+    });
+    if (policy.chunks(n) <= 1) return;
+    
+    // Merge sorted runs pairwise, doubling the run width each round
+    std::unique_ptr<double[]> scratch(new double[n]);
+    double* src = data;
+    double* dst = scratch.get();
+    for (size_t width = policy.chunk(); width < n; width *= 2) {
+        size_t pairs = (n + 2 * width - 1) / (2 * width);
+        policy.executor().parallel_for(pairs, [&](size_t p) {
+            size_t first = p * 2 * width;
+            size_t mid = std::min(n, first + width);
+            size_t last = std::min(n, first + 2 * width);
+            std::merge(src + first, src + mid, src + mid, src + last, dst + first);
+        });
+        std::swap(src, dst);
+    }
+    if (src != data) {
+        policy.for_each_chunk(n, [&](size_t, size_t first, size_t last) {
+            std::copy(src + first, src + last, data + first);
+        });
+    }
+}
+
+double StatisticsCalculator::sum(const ExecutionPolicy& policy, const double* data, size_t n) {
+    std::vector<double> partial(policy.chunks(n), 0.0);
+    policy.for_each_chunk(n, [&](size_t c, size_t first, size_t last) {
+        partial[c] = kernels::sum(data + first, last - first);
+    });
+    double total = 0.0;
+    for (double p : partial) total += p;
+    return total;
+}
+
+double StatisticsCalculator::variance(const ExecutionPolicy& policy, const double* data, size_t n) {
+    if (n < 2) return 0.0;
+    
+    double m = sum(policy, data, n) / static_cast<double>(n);
+    std::vector<double> partial(policy.chunks(n), 0.0);
+    policy.for_each_chunk(n, [&](size_t c, size_t first, size_t last) {
+        partial[c] = kernels::sum_sq_dev(data + first, last - first, m);
+    });
+    double sum_sq = 0.0;
+    for (double p : partial) sum_sq += p;
+    
+    return sum_sq / static_cast<double>(n);
+}
+
+StatisticsResult StatisticsCalculator::calculate_all(const ExecutionPolicy& policy,
+                                                     const std::vector<double>& data) {
+    return calculate_all(policy, data.data(), data.size());
+}
+
+StatisticsResult StatisticsCalculator::calculate_all(const ExecutionPolicy& policy,
+                                                     const double* data, size_t n) {
+    StatisticsResult result;
+    if (n == 0) return result;
+    
+    std::unique_ptr<double[]> buffer(new double[n]);
+    double* sorted = buffer.get();
+    policy.for_each_chunk(n, [&](size_t, size_t first, size_t last) {
+        std::copy(data + first, data + last, sorted + first);
+    });
+    sort(policy, sorted, n);
+    
+    result.count = n;
+    result.min = sorted[0];
+    result.max = sorted[n - 1];
+    result.range = result.max - result.min;
+    result.median = n % 2 == 0 ? (sorted[n/2 - 1] + sorted[n/2]) / 2.0 : sorted[n/2];
+    result.q1 = read_percentile(sorted, n, 25);
+    result.q3 = read_percentile(sorted, n, 75);
+    result.iqr = result.q3 - result.q1;
+    
+    // Chunk starts moved forward to the next new value, so no run of
+    // equal values straddles two chunks and each chunk's mode is final.
+    const size_t chunks = policy.chunks(n);
+    std::vector<size_t> bounds(chunks + 1, n);
+    bounds[0] = 0;
+    for (size_t c = 1; c < chunks; ++c) {
+        size_t b = std::max(bounds[c - 1], c * policy.chunk());
+        if (b > 0 && b < n && sorted[b] == sorted[b - 1]) {
+            b = static_cast<size_t>(std::upper_bound(sorted + b, sorted + n, sorted[b - 1]) - sorted);
+        }
+        bounds[c] = b;
+    }
+    
+    struct Partial {
+        double total = 0.0;
+        double shifted_sum = 0.0;
+        double shifted_sq = 0.0;
+        double mode = 0.0;
+        size_t mode_count = 0;
+    };
+    std::vector<Partial> partial(chunks);
+    const double shift = sorted[n/2];
+    
+    policy.executor().parallel_for(chunks, [&](size_t c) {
+        Partial& p = partial[c];
+        size_t run_start = bounds[c];
+        for (size_t i = bounds[c]; i < bounds[c + 1]; ++i) {
+            double val = sorted[i];
+            p.total += val;
+            double d = val - shift;
+            p.shifted_sum += d;
+            p.shifted_sq += d * d;
+            if (i + 1 == bounds[c + 1] || sorted[i + 1] != val) {
+                size_t run = i + 1 - run_start;
+                if (run > p.mode_count) {
+                    p.mode_count = run;
+                    p.mode = val;
+                }
+                run_start = i + 1;
+            }
+        }
+    });
+    
+    // Combine in chunk order; ties keep the earlier (smaller) mode
+    double total = 0.0;
+    double shifted_sum = 0.0;
+    double shifted_sq = 0.0;
+    size_t mode_count = 0;
+    for (const Partial& p : partial) {
+        total += p.total;
+        shifted_sum += p.shifted_sum;
+        shifted_sq += p.shifted_sq;
+        if (p.mode_count > mode_count) {
+            mode_count = p.mode_count;
+            result.mode = p.mode;
+        }
+    }
+    
+    result.sum = total;
+    result.mean = total / static_cast<double>(n);
+    if (n >= 2) {
+        double dn = static_cast<double>(n);
+        result.variance = (shifted_sq - shifted_sum * shifted_sum / dn) / dn;
+        if (result.variance < 0) result.variance = 0.0;
+    }
+    result.stddev = std::sqrt(result.variance);
+    
+    return result;
+}
+
+CorrelationResult StatisticsCalculator::correlation(const ExecutionPolicy& policy,
+                                                    const double* x, const double* y, size_t n) {
+    if (n < 2) {
+        CorrelationResult result;
+        result.strength = "invalid";
+        result.direction = "none";
+        return result;
+    }
+    
+    double mean_x = sum(policy, x, n) / static_cast<double>(n);
+    double mean_y = sum(policy, y, n) / static_cast<double>(n);
+    
+    struct Moments {
+        double sxx = 0.0;
+        double syy = 0.0;
+        double sxy = 0.0;
+    };
+    std::vector<Moments> partial(policy.chunks(n));
+    policy.for_each_chunk(n, [&](size_t c, size_t first, size_t last) {
+        Moments& m = partial[c];
+        kernels::co_moments(x + first, y + first, last - first, mean_x, mean_y,
+                            &m.sxx, &m.syy, &m.sxy);
+    });
+    
+    Moments total;
+    for (const Moments& m : partial) {
+        total.sxx += m.sxx;
+        total.syy += m.syy;
+        total.sxy += m.sxy;
+    }
+    return correlation_from_moments(total.sxx, total.syy, total.sxy);
+}
+
+std::vector<size_t> StatisticsCalculator::detect_outliers(const ExecutionPolicy& policy,
+                                                          const double* data, size_t n,
+                                                          double threshold) {
+    std::vector<size_t> outliers;
+    
+    if (n < 4) {
+        return outliers;
+    }
+    
+    std::vector<double> quartiles = quantiles(data, n, {25, 75});
+    double iqr = quartiles[1] - quartiles[0];
+    double lower_bound = quartiles[0] - threshold * iqr;
+    double upper_bound = quartiles[1] + threshold * iqr;
+    
+    std::vector<std::vector<size_t>> hits(policy.chunks(n));
+    policy.for_each_chunk(n, [&](size_t c, size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            if (data[i] < lower_bound || data[i] > upper_bound) {
+                hits[c].push_back(i);
+            }
+        }
+    });
+    
+    size_t total = 0;
+    for (const auto& h : hits) total += h.size();
+    outliers.reserve(total);
+    for (const auto& h : hits) {
+        outliers.insert(outliers.end(), h.begin(), h.end());
+    }
+    
+    return outliers;
+}
+
 } // namespace expense
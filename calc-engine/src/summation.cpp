@@ -0,0 +1,151 @@
+/**
+ * Summation Policies Implementation
+ *
+ * Pairwise recursion and the bin selection for Binned; the inner loops
+ * are the dispatched kernels in simd_kernels.hpp.
+ *
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#include "summation.hpp"
+#include "simd_kernels.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace expense {
+namespace summation {
+
+namespace {
+
+// Beyond this many elements the bins would hold too few bits each
+constexpr int MAX_BINNED_LOG2_N = 40;
+
+/**
+ * Halve [data, data + n) at block-aligned points until a block remains,
+ * so the split tree depends only on n.
+ */
+template <typename Base>
+double pairwise(const double* data, size_t n, Base base) {
+    const size_t block = Pairwise::PAIRWISE_BLOCK;
+    if (n <= block) return base(data, n);
+
+    size_t half = (n / 2 + block - 1) / block * block;
+    return pairwise(data, half, base) + pairwise(data + half, n - half, base);
+}
+
+/**
+ * Bin anchors for n terms with |term| <= bound. sigma = 1.5 * 2^(e+L+1)
+ * keeps sigma + x in one binade, so (sigma + x) - sigma is x rounded to a
+ * multiple of 2^(e+L-51) and the remainder is below 2^(e+L-52). n such
+ * multiples sum to at most 2^(e+L), well inside 53 bits: bin adds are
+ * exact in any order. Each fold drops 52 - L bits.
+ *
+ * @return false if the bins cannot be placed (overflow or huge n)
+ */
+bool bin_anchors(double bound, size_t n, double* sigma) {
+    int log2_n = 1;
+    while (log2_n <= MAX_BINNED_LOG2_N && (size_t(1) << log2_n) < n) ++log2_n;
+    if (log2_n > MAX_BINNED_LOG2_N) return false;
+
+    int exponent;
+    std::frexp(bound, &exponent);      // bound < 2^exponent
+    if (exponent + log2_n + 2 > std::numeric_limits<double>::max_exponent) return false;
+
+    for (size_t f = 0; f < kernels::BINNED_FOLDS; ++f) {
+        sigma[f] = std::ldexp(3.0, exponent + log2_n);
+        exponent += log2_n - 52;
+    }
+    return true;
+}
+
+/**
+ * Bins are added smallest first; each add rounds at most once.
+ */
+double combine_bins(const double* bins) {
+    double total = bins[kernels::BINNED_FOLDS - 1];
+    for (size_t f = kernels::BINNED_FOLDS - 1; f-- > 0;) {
+        total += bins[f];
+    }
+    return total;
+}
+
+} // namespace
+
+// ==================== Naive ====================
+
+double Naive::sum(const double* data, size_t n) {
+    return kernels::sum(data, n);
+}
+
+double Naive::sum_sq_dev(const double* data, size_t n, double center) {
+    return kernels::sum_sq_dev(data, n, center);
+}
+
+// ==================== Pairwise ====================
+
+double Pairwise::sum(const double* data, size_t n) {
+    return pairwise(data, n, [](const double* p, size_t m) {
+        return kernels::sum(p, m);
+    });
+}
+
+double Pairwise::sum_sq_dev(const double* data, size_t n, double center) {
+    return pairwise(data, n, [center](const double* p, size_t m) {
+        return kernels::sum_sq_dev(p, m, center);
+    });
+}
+
+// ==================== Neumaier ====================
+
+double Neumaier::sum(const double* data, size_t n) {
+    return kernels::compensated_sum(data, n);
+}
+
+double Neumaier::sum_sq_dev(const double* data, size_t n, double center) {
+    return kernels::compensated_sum_sq_dev(data, n, center);
+}
+
+// ==================== Binned ====================
+
+double Binned::sum(const double* data, size_t n) {
+    if (n == 0) return 0.0;
+
+    double lo, hi;
+    kernels::min_max(data, n, &lo, &hi);
+    double bound = std::max(std::abs(lo), std::abs(hi));
+    if (!std::isfinite(bound)) return Naive::sum(data, n);
+    if (bound == 0.0) return 0.0;
+
+    double sigma[kernels::BINNED_FOLDS];
+    if (!bin_anchors(bound, n, sigma)) return Neumaier::sum(data, n);
+
+    double bins[kernels::BINNED_FOLDS];
+    kernels::binned_sum(data, n, sigma, bins);
+    return combine_bins(bins);
+}
+
+double Binned::sum_sq_dev(const double* data, size_t n, double center) {
+    if (n == 0) return 0.0;
+
+    // Rounding is monotonic, so the largest computed term comes from an
+    // extreme value
+    double lo, hi;
+    kernels::min_max(data, n, &lo, &hi);
+    double d_lo = lo - center;
+    double d_hi = hi - center;
+    double bound = std::max(d_lo * d_lo, d_hi * d_hi);
+    if (!std::isfinite(bound)) return Naive::sum_sq_dev(data, n, center);
+    if (bound == 0.0) return 0.0;
+
+    double sigma[kernels::BINNED_FOLDS];
+    if (!bin_anchors(bound, n, sigma)) return Neumaier::sum_sq_dev(data, n, center);
+
+    double bins[kernels::BINNED_FOLDS];
+    kernels::binned_sum_sq_dev(data, n, center, sigma, bins);
+    return combine_bins(bins);
+}
+
+} // namespace summation
+} // namespace expense
@@ -0,0 +1,206 @@
+/**
+ * Thread Pool Implementation
+ *
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#include "thread_pool.hpp"
+#include <algorithm>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace expense {
+
+namespace {
+
+// Blocks dealt per thread: enough slack for stealing to even out skew
+constexpr size_t BLOCKS_PER_THREAD = 4;
+
+// Set while this thread runs a task, so nested parallel_for runs inline
+thread_local bool in_task = false;
+
+std::mutex shared_mutex;
+ThreadPoolOptions shared_options;
+bool shared_created = false;
+
+bool pin_to_cpu(std::thread& thread, unsigned cpu) {
+#if defined(__linux__)
+    if (cpu >= CPU_SETSIZE) return false;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set) == 0;
+#else
+    (void)thread;
+    (void)cpu;
+    return false;
+#endif
+}
+
+} // namespace
+
+ThreadPool::ThreadPool(unsigned threads) {
+    ThreadPoolOptions options;
+    options.threads = threads;
+    start(options);
+}
+
+ThreadPool::ThreadPool(const ThreadPoolOptions& options) {
+    start(options);
+}
+
+void ThreadPool::start(const ThreadPoolOptions& options) {
+    unsigned threads = options.threads;
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    queues_.reserve(threads);
+    for (unsigned t = 0; t < threads; ++t) {
+        queues_.push_back(std::make_unique<Queue>());
+    }
+    workers_.reserve(threads - 1);
+    for (unsigned t = 1; t < threads; ++t) {
+        workers_.emplace_back(&ThreadPool::worker_loop, this, static_cast<size_t>(t));
+        if (options.pin_threads) {
+            unsigned cpu = options.cpus.empty()
+                ? t : options.cpus[t % options.cpus.size()];
+            if (pin_to_cpu(workers_.back(), cpu)) ++pinned_;
+        }
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(state_mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread& t : workers_) t.join();
+}
+
+ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool([] {
+        std::lock_guard<std::mutex> lock(shared_mutex);
+        shared_created = true;
+        return shared_options;
+    }());
+    return pool;
+}
+
+bool ThreadPool::configure_shared(const ThreadPoolOptions& options) {
+    std::lock_guard<std::mutex> lock(shared_mutex);
+    if (shared_created) return false;
+    shared_options = options;
+    return true;
+}
+
+void ThreadPool::parallel_for(size_t count, const std::function<void(size_t)>& fn, size_t grain) {
+    if (count == 0) return;
+    if (grain == 0) grain = 1;
+    if (size() == 1 || in_task || count <= grain) {
+        for (size_t i = 0; i < count; ++i) fn(i);
+        return;
+    }
+
+    std::lock_guard<std::mutex> submit(submit_mutex_);
+
+    const size_t threads = size();
+    size_t block_len = std::max(grain, (count + threads * BLOCKS_PER_THREAD - 1) /
+                                           (threads * BLOCKS_PER_THREAD));
+    size_t blocks = (count + block_len - 1) / block_len;
+
+    job_ = &fn;
+    error_ = nullptr;
+    failed_.store(false);
+    pending_.store(blocks);
+
+    // Contiguous runs of blocks per thread, in index order
+    for (size_t t = 0; t < threads; ++t) {
+        size_t first = blocks * t / threads;
+        size_t last = blocks * (t + 1) / threads;
+        std::lock_guard<std::mutex> lock(queues_[t]->mutex);
+        for (size_t b = first; b < last; ++b) {
+            queues_[t]->blocks.push_back({b * block_len, std::min(count, (b + 1) * block_len)});
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(state_mutex_);
+        ++generation_;
+    }
+    wake_.notify_all();
+
+    run_blocks(0);
+
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(state_mutex_);
+        done_.wait(lock, [this] { return pending_.load() == 0; });
+        error = error_;
+        error_ = nullptr;
+    }
+    job_ = nullptr;
+    if (error) std::rethrow_exception(error);
+}
+
+void ThreadPool::worker_loop(size_t self) {
+    uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(state_mutex_);
+            wake_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+            if (stopping_) return;
+            seen = generation_;
+        }
+        run_blocks(self);
+    }
+}
+
+void ThreadPool::run_blocks(size_t self) {
+    in_task = true;
+    Block block;
+    while (pop_or_steal(self, block)) {
+        // After a failure the remaining blocks are drained without running
+        if (!failed_.load(std::memory_order_relaxed)) {
+            try {
+                for (size_t i = block.begin; i < block.end; ++i) (*job_)(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(state_mutex_);
+                if (!error_) error_ = std::current_exception();
+                failed_.store(true);
+            }
+        }
+        if (pending_.fetch_sub(1) == 1) {
+            std::lock_guard<std::mutex> lock(state_mutex_);
+            done_.notify_all();
+        }
+    }
+    in_task = false;
+}
+
+bool ThreadPool::pop_or_steal(size_t self, Block& block) {
+    {
+        Queue& own = *queues_[self];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.blocks.empty()) {
+            block = own.blocks.front();
+            own.blocks.pop_front();
+            return true;
+        }
+    }
+    const size_t threads = queues_.size();
+    for (size_t k = 1; k < threads; ++k) {
+        Queue& victim = *queues_[(self + k) % threads];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.blocks.empty()) {
+            block = victim.blocks.back();
+            victim.blocks.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace expense
@@ -0,0 +1,184 @@
+/**
+ * Zone Map Implementation
+ *
+ * @author Personal Project
+ * @version 1.0.0
+ */
+
+#include "zone_map.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace expense {
+
+namespace {
+
+constexpr double PAISE_LIMIT = 9e16;   // |rupees| beyond which paise overflow int64
+
+int64_t to_paise(double amount) {
+    return Money::from_double(amount).paise();
+}
+
+/**
+ * Inclusive paise bounds of the query's amount range; lo > hi when the
+ * range is empty (or NaN).
+ */
+void amount_bounds(const RangeQuery& query, int64_t* lo, int64_t* hi) {
+    *lo = std::numeric_limits<int64_t>::min();
+    *hi = std::numeric_limits<int64_t>::max();
+    if (std::isnan(query.amount_min) || std::isnan(query.amount_max) ||
+        query.amount_min > query.amount_max) {
+        *lo = 1;
+        *hi = 0;
+        return;
+    }
+    if (query.amount_min >= PAISE_LIMIT) *lo = std::numeric_limits<int64_t>::max();
+    else if (query.amount_min > -PAISE_LIMIT) *lo = to_paise(query.amount_min);
+    if (query.amount_max <= -PAISE_LIMIT) *hi = std::numeric_limits<int64_t>::min();
+    else if (query.amount_max < PAISE_LIMIT) *hi = to_paise(query.amount_max);
+}
+
+} // namespace
+
+ZoneMap::ZoneMap(const ExpenseTable& table, size_t zone_rows)
+    : amounts_(table.amounts()), dates_(table.dates()), zone_rows_(zone_rows),
+      sorted_(table.sorted_by_date()) {
+    if (zone_rows == 0) {
+        throw std::invalid_argument("Zone rows must be positive");
+    }
+
+    const size_t n = amounts_.size;
+    const size_t count = (n + zone_rows - 1) / zone_rows;
+    zones_.resize(count);
+    prefix_.assign(count + 1, 0);
+    for (size_t z = 0; z < count; ++z) {
+        Zone& zone = zones_[z];
+        const size_t begin = zone_begin(z);
+        const size_t end = zone_end(z);
+        zone.date_min = zone.date_max = dates_[begin];
+        zone.amount_min = zone.amount_max = to_paise(amounts_[begin]);
+        for (size_t i = begin; i < end; ++i) {
+            const int64_t paise = to_paise(amounts_[i]);
+            zone.date_min = std::min(zone.date_min, dates_[i]);
+            zone.date_max = std::max(zone.date_max, dates_[i]);
+            zone.amount_min = std::min(zone.amount_min, paise);
+            zone.amount_max = std::max(zone.amount_max, paise);
+            zone.sum += paise;
+        }
+        prefix_[z + 1] = prefix_[z] + zone.sum;
+    }
+}
+
+size_t ZoneMap::zone_end(size_t z) const {
+    return std::min(zone_begin(z) + zone_rows_, amounts_.size);
+}
+
+ZoneMap::Overlap ZoneMap::classify(const Zone& zone, const RangeQuery& query,
+                                   int64_t lo, int64_t hi) const {
+    if (zone.date_max < query.date_from || zone.date_min > query.date_to ||
+        zone.amount_max < lo || zone.amount_min > hi) {
+        return Overlap::None;
+    }
+    if (zone.date_min >= query.date_from && zone.date_max <= query.date_to &&
+        zone.amount_min >= lo && zone.amount_max <= hi) {
+        return Overlap::Full;
+    }
+    return Overlap::Partial;
+}
+
+void ZoneMap::candidate_zones(const RangeQuery& query, size_t* first, size_t* last) const {
+    *first = 0;
+    *last = zones_.size();
+    if (query.date_from > query.date_to) {
+        *last = 0;
+        return;
+    }
+    if (!sorted_) return;
+
+    // Dates are non-decreasing, so zone minima and maxima are too
+    *first = static_cast<size_t>(std::partition_point(zones_.begin(), zones_.end(),
+        [&](const Zone& zone) { return zone.date_max < query.date_from; }) - zones_.begin());
+    *last = static_cast<size_t>(std::partition_point(zones_.begin() + static_cast<std::ptrdiff_t>(*first),
+        zones_.end(), [&](const Zone& zone) { return zone.date_min <= query.date_to; }) - zones_.begin());
+}
+
+RangeTotal ZoneMap::total(const RangeQuery& query) const {
+    RangeTotal result;
+    size_t first, last;
+    candidate_zones(query, &first, &last);
+    result.zones_skipped = zones_.size() - (last - first);
+
+    int64_t lo, hi;
+    amount_bounds(query, &lo, &hi);
+    const bool all_amounts = lo == std::numeric_limits<int64_t>::min() &&
+                             hi == std::numeric_limits<int64_t>::max();
+
+    int64_t sum = 0;
+    auto visit = [&](size_t z) {
+        switch (classify(zones_[z], query, lo, hi)) {
+        case Overlap::None:
+            ++result.zones_skipped;
+            break;
+        case Overlap::Full:
+            ++result.zones_summed;
+            sum += zones_[z].sum;
+            result.count += zone_end(z) - zone_begin(z);
+            break;
+        case Overlap::Partial:
+            ++result.zones_scanned;
+            for (size_t i = zone_begin(z); i < zone_end(z); ++i) {
+                if (dates_[i] < query.date_from || dates_[i] > query.date_to) continue;
+                const int64_t paise = to_paise(amounts_[i]);
+                if (paise < lo || paise > hi) continue;
+                sum += paise;
+                ++result.count;
+            }
+            break;
+        }
+    };
+
+    if (sorted_ && all_amounts && last - first > 2) {
+        // Zones strictly inside the candidate run lie wholly in the range
+        visit(first);
+        sum += prefix_[last - 1] - prefix_[first + 1];
+        result.count += zone_begin(last - 1) - zone_begin(first + 1);
+        result.zones_summed += last - first - 2;
+        visit(last - 1);
+    } else {
+        for (size_t z = first; z < last; ++z) visit(z);
+    }
+    result.total = Money::from_paise(sum);
+    return result;
+}
+
+RangeTotal ZoneMap::total(int32_t date_from, int32_t date_to) const {
+    RangeQuery query;
+    query.date_from = date_from;
+    query.date_to = date_to;
+    return total(query);
+}
+
+std::vector<size_t> ZoneMap::select(const RangeQuery& query) const {
+    std::vector<size_t> rows;
+    size_t first, last;
+    candidate_zones(query, &first, &last);
+
+    int64_t lo, hi;
+    amount_bounds(query, &lo, &hi);
+    for (size_t z = first; z < last; ++z) {
+        Overlap overlap = classify(zones_[z], query, lo, hi);
+        if (overlap == Overlap::None) continue;
+        for (size_t i = zone_begin(z); i < zone_end(z); ++i) {
+            if (overlap == Overlap::Partial) {
+                if (dates_[i] < query.date_from || dates_[i] > query.date_to) continue;
+                const int64_t paise = to_paise(amounts_[i]);
+                if (paise < lo || paise > hi) continue;
+            }
+            rows.push_back(i);
+        }
+    }
+    return rows;
+}
+
+} // namespace expense
@@ -0,0 +1,33 @@
+/**
+ * Shared test helper: row-by-row ExpenseTable comparison.
+ */
+
+#ifndef EXPENSE_TESTS_TABLE_COMPARE_HPP
+#define EXPENSE_TESTS_TABLE_COMPARE_HPP
+
+#include "expense_table.hpp"
+
+namespace expense {
+
+/**
+ * Same rows in the same order; merchants and payment methods compare by
+ * name, since dictionary ids depend on insertion order.
+ */
+inline bool same_tables(const ExpenseTable& a, const ExpenseTable& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        ExpenseRecord x = a.row(i);
+        ExpenseRecord y = b.row(i);
+        if (x.amount != y.amount || x.date != y.date || x.category != y.category ||
+            x.recurring != y.recurring ||
+            a.merchants().name(x.merchant) != b.merchants().name(y.merchant) ||
+            a.payment_methods().name(x.payment_method) != b.payment_methods().name(y.payment_method)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace expense
+
+#endif // EXPENSE_TESTS_TABLE_COMPARE_HPP
@@ -0,0 +1,166 @@
+/**
+ * CSV Ingestion Unit Tests
+ *
+ * Validates quoting, header mapping, error positions and that parallel
+ * chunked parsing matches a single-chunk parse.
+ */
+
+#include "csv_ingest.hpp"
+#include "ingest.hpp"
+#include "table_compare.hpp"
+#include "thread_pool.hpp"
+#include <iostream>
+#include <random>
+#include <string>
+
+using namespace expense;
+
+#define TEST(name) std::cout << "Testing: " << #name << "... ";
+#define PASS() std::cout << "PASSED\n"; passed++;
+#define FAIL(msg) std::cout << "FAILED: " << msg << "\n"; failed++;
+
+namespace {
+
+ExpenseTable parse(const std::string& text, const ExecutionPolicy& policy = execution::par) {
+    return parse_expense_csv(text.data(), text.data() + text.size(), policy);
+}
+
+/**
+ * Error message of a parse expected to fail, or "" if it succeeded.
+ */
+std::string parse_error(const std::string& text, size_t* line = nullptr) {
+    try {
+        parse(text);
+    } catch (const ParseError& e) {
+        if (line) *line = e.line();
+        return e.what();
+    }
+    return "";
+}
+
+const char* const HEADER =
+    "\"ID\",\"Amount\",\"Category\",\"Description\",\"Date\",\"Merchant\",\"Payment Method\",\"Recurring\"\n";
+
+} // namespace
+
+int main() {
+    int passed = 0;
+    int failed = 0;
+
+    // Test the OpenCSV export format: quoting, commas, newlines, CRLF
+    TEST(export_format)
+    std::string text = std::string(HEADER) +
+        "\"1\",\"250.00\",\"FOOD\",\"Lunch, with \"\"team\"\"\",\"2024-01-15\",\"Cafe \"\"Blue\"\"\",\"UPI\",\"false\"\n"
+        "\"2\",\"1200.50\",\"RENT\",\"January\nrent\",\"2024-01-01\",\"Landlord\",\"NEFT\",\"true\"\r\n"
+        "\n"
+        "\"3\",\"80\",\"OTHER\",\"\",\"2024-02-29\",\"\",\"\",\"false\"";
+    ExpenseTable table = parse(text);
+    ExpenseRecord lunch = table.row(0);
+    ExpenseRecord rent = table.row(1);
+    ExpenseRecord other = table.row(2);
+    if (table.size() == 3 && lunch.amount == 250.0 && lunch.category == Category::Food &&
+        lunch.date == parse_iso_date("2024-01-15") &&
+        table.merchants().name(lunch.merchant) == "Cafe \"Blue\"" &&
+        table.payment_methods().name(lunch.payment_method) == "UPI" && !lunch.recurring &&
+        rent.amount == 1200.5 && rent.category == Category::Rent && rent.recurring &&
+        other.date == parse_iso_date("2024-02-29") &&
+        table.merchants().name(other.merchant).empty()) {
+        PASS()
+    } else {
+        FAIL("Parsed rows incorrect (" << table.size() << " rows)")
+    }
+
+    // Test header-mapped column order, missing optional columns, no header
+    TEST(header_mapping)
+    ExpenseTable reordered = parse("Date,Category,Amount\n2024-03-01,TRAVEL,99.5\n");
+    ExpenseTable headerless = parse("7,12.25,GROCERIES,milk,2024-03-02,Store,Card,true\n");
+    if (reordered.size() == 1 && reordered.row(0).amount == 99.5 &&
+        reordered.row(0).category == Category::Travel &&
+        reordered.merchants().name(reordered.row(0).merchant).empty() &&
+        headerless.size() == 1 && headerless.row(0).amount == 12.25 &&
+        headerless.row(0).recurring && parse("").empty() && parse(HEADER).empty()) {
+        PASS()
+    } else {
+        FAIL("Header mapping incorrect")
+    }
+
+    // Test errors report the physical line of the bad field
+    TEST(error_positions)
+    size_t line = 0;
+    std::string bad_amount = parse_error(std::string(HEADER) +
+        "\"1\",\"5\",\"FOOD\",\"two\nlines\",\"2024-01-01\",\"\",\"\",\"false\"\n"
+        "\"2\",\"abc\",\"FOOD\",\"\",\"2024-01-01\",\"\",\"\",\"false\"\n", &line);
+    bool ok = bad_amount.find("Invalid amount") != std::string::npos && line == 4;
+    ok = ok && parse_error("1,5,SNACKS,,2024-01-01\n").find("Unknown category") != std::string::npos;
+    ok = ok && parse_error("1,5,FOOD,,2023-02-29\n").find("Invalid date") != std::string::npos;
+    ok = ok && parse_error("1,5,FOOD\n").find("Expected 5 fields") != std::string::npos;
+    ok = ok && parse_error("1,5,FOOD,\"open,2024-01-01\n").find("Unterminated") != std::string::npos;
+    ok = ok && parse_error("Amount,Date\n5,2024-01-01\n").find("no Category") != std::string::npos;
+    if (ok) {
+        PASS()
+    } else {
+        FAIL("Unexpected error: " << bad_amount << " (line " << line << ")")
+    }
+
+    // Test that small parallel chunks give the same table as one chunk
+    TEST(parallel_chunks_match)
+    std::mt19937_64 rng(3);
+    std::uniform_int_distribution<int> pick(0, 13);
+    std::uniform_int_distribution<int> cents(100, 500000);
+    const char* descriptions[] = {"plain", "comma, inside", "quote \"\"x\"\"", "multi\nline\nnote", ""};
+    const char* merchants[] = {"Swiggy", "Uber", "Big \"\"B\"\" Mart", "Amazon, India"};
+    std::string big = HEADER;
+    for (int i = 0; i < 20000; ++i) {
+        int day = 1 + i % 28;
+        big += "\"" + std::to_string(i) + "\",\"" + std::to_string(cents(rng) / 100) + "." +
+               std::to_string(10 + cents(rng) % 90) + "\",\"" +
+               category_name(static_cast<Category>(pick(rng))) + "\",\"" +
+               descriptions[i % 5] + "\",\"2024-05-" + (day < 10 ? "0" : "") + std::to_string(day) +
+               "\",\"" + merchants[i % 4] + "\",\"UPI\",\"" + (i % 3 ? "false" : "true") + "\"\n";
+    }
+    ThreadPool four_threads(4);
+    ExecutionPolicy small_chunks;
+    small_chunks.pool = &four_threads;
+    small_chunks.chunk_size = 1000;
+    ExecutionPolicy one_chunk;
+    one_chunk.pool = &four_threads;
+    one_chunk.chunk_size = big.size() + 1;
+    ExpenseTable chunked = parse(big, small_chunks);
+    ExpenseTable whole = parse(big, one_chunk);
+    if (chunked.size() == 20000 && same_tables(chunked, whole) && chunked.merchants().size() == 4 &&
+        chunked.merchants().name(chunked.row(2).merchant) == "Big \"B\" Mart") {
+        PASS()
+    } else {
+        FAIL("Chunked parse differs (" << chunked.size() << " vs " << whole.size() << " rows)")
+    }
+
+    // Test exact amounts come from the field text, in row order across chunks
+    TEST(exact_amounts)
+    std::vector<Money> exact;
+    ExpenseTable exact_table = parse_expense_csv(big.data(), big.data() + big.size(), exact, small_chunks);
+    ok = exact.size() == exact_table.size() && exact_table.size() == 20000;
+    for (size_t i = 0; ok && i < exact.size(); ++i) {
+        ok = exact[i] == Money::from_double(exact_table.amounts()[i]);
+    }
+    std::string rounded = std::string(HEADER) + "\"1\",\"250.105\",\"FOOD\",\"\",\"2024-01-15\",\"\",\"\",\"false\"\n";
+    ok = ok && parse(rounded).size() == 1;
+    try {
+        parse_expense_csv(rounded.data(), rounded.data() + rounded.size(), exact);
+        ok = false;
+    } catch (const ParseError& e) {
+        ok = ok && e.line() == 2 && std::string(e.what()).find("2 decimal places") != std::string::npos;
+    }
+    if (ok) {
+        PASS()
+    } else {
+        FAIL("Exact amounts differ or over-precise amount accepted")
+    }
+
+    // Summary
+    std::cout << "\n========================================\n";
+    std::cout << "Tests passed: " << passed << "\n";
+    std::cout << "Tests failed: " << failed << "\n";
+    std::cout << "========================================\n";
+
+    return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,139 @@
+/**
+ * Execution Policy Unit Tests
+ *
+ * Validates the parallel StatisticsCalculator overloads against the
+ * sequential versions and checks that results do not depend on the
+ * thread count.
+ */
+
+#include "execution.hpp"
+#include "statistics.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace expense;
+
+#define TEST(name) std::cout << "Testing: " << #name << "... ";
+#define PASS() std::cout << "PASSED\n"; passed++;
+#define FAIL(msg) std::cout << "FAILED: " << msg << "\n"; failed++;
+
+namespace {
+
+bool close(double a, double b) {
+    return std::abs(a - b) <= 1e-9 * std::max(1.0, std::abs(b));
+}
+
+bool bit_identical(const StatisticsResult& a, const StatisticsResult& b) {
+    double x[StatisticsResult::FIELD_COUNT];
+    double y[StatisticsResult::FIELD_COUNT];
+    a.to_array(x);
+    b.to_array(y);
+    return std::memcmp(x, y, sizeof(x)) == 0;
+}
+
+} // namespace
+
+int main() {
+    int passed = 0;
+    int failed = 0;
+
+    std::mt19937_64 rng(11);
+    std::lognormal_distribution<double> dist(4.0, 1.0);
+    std::vector<double> data(200003);
+    for (double& v : data) v = std::round(dist(rng) * 100.0) / 100.0;
+    std::vector<double> other(data.size());
+    for (size_t i = 0; i < data.size(); ++i) other[i] = data[i] * 0.5 + dist(rng);
+
+    // Small chunks so the test crosses many chunk boundaries and merge rounds
+    ThreadPool four_threads(4);
+    ExecutionPolicy four;
+    four.pool = &four_threads;
+    four.chunk_size = 1000;
+
+    ThreadPool one_thread(1);
+    ExecutionPolicy one = four;
+    one.pool = &one_thread;
+
+    // Test calculate_all against the sequential version
+    TEST(calculate_all_matches_sequential)
+    StatisticsResult seq = StatisticsCalculator::calculate_all(data);
+    StatisticsResult par = StatisticsCalculator::calculate_all(four, data);
+    if (par.count == seq.count && par.min == seq.min && par.max == seq.max &&
+        par.median == seq.median && par.q1 == seq.q1 && par.q3 == seq.q3 &&
+        par.mode == seq.mode && close(par.sum, seq.sum) && close(par.mean, seq.mean) &&
+        close(par.variance, seq.variance) && close(par.stddev, seq.stddev)) {
+        PASS()
+    } else {
+        FAIL("Parallel calculate_all diverges from sequential")
+    }
+
+    // Test that 1 and 4 threads give bit-identical results
+    TEST(deterministic_across_threads)
+    StatisticsResult single = StatisticsCalculator::calculate_all(one, data);
+    CorrelationResult c1 = StatisticsCalculator::correlation(one, data.data(), other.data(), data.size());
+    CorrelationResult c4 = StatisticsCalculator::correlation(four, data.data(), other.data(), data.size());
+    if (bit_identical(single, par) &&
+        StatisticsCalculator::sum(one, data.data(), data.size()) ==
+            StatisticsCalculator::sum(four, data.data(), data.size()) &&
+        StatisticsCalculator::variance(one, data.data(), data.size()) ==
+            StatisticsCalculator::variance(four, data.data(), data.size()) &&
+        c1.pearson_coefficient == c4.pearson_coefficient) {
+        PASS()
+    } else {
+        FAIL("Results depend on thread count")
+    }
+
+    // Test the parallel sort, including a ragged last chunk and duplicates
+    TEST(parallel_sort)
+    std::vector<double> sorted = data;
+    StatisticsCalculator::sort(four, sorted.data(), sorted.size());
+    std::vector<double> expected = data;
+    std::sort(expected.begin(), expected.end());
+    std::vector<double> few = {3, 1, 2};
+    StatisticsCalculator::sort(four, few.data(), few.size());
+    if (sorted == expected && few == std::vector<double>({1, 2, 3})) {
+        PASS()
+    } else {
+        FAIL("Parallel sort output not sorted")
+    }
+
+    // Test correlation and outliers against the sequential versions
+    TEST(correlation_and_outliers)
+    CorrelationResult cs = StatisticsCalculator::correlation(data, other);
+    bool outliers_same = StatisticsCalculator::detect_outliers(four, data.data(), data.size()) ==
+                         StatisticsCalculator::detect_outliers(data);
+    if (close(c4.pearson_coefficient, cs.pearson_coefficient) && c4.strength == cs.strength &&
+        c4.direction == cs.direction && outliers_same) {
+        PASS()
+    } else {
+        FAIL("Parallel correlation or outliers diverge")
+    }
+
+    // Test edge cases: empty, tiny and constant inputs
+    TEST(edge_cases)
+    std::vector<double> flat(5000, 42.0);
+    StatisticsResult empty = StatisticsCalculator::calculate_all(four, std::vector<double>());
+    StatisticsResult constant = StatisticsCalculator::calculate_all(four, flat);
+    StatisticsResult tiny = StatisticsCalculator::calculate_all(execution::par, std::vector<double>({5.0}));
+    if (empty.count == 0 && constant.mode == 42.0 && constant.variance == 0.0 &&
+        constant.median == 42.0 && tiny.count == 1 && tiny.mean == 5.0 &&
+        StatisticsCalculator::variance(four, flat.data(), 1) == 0.0 &&
+        StatisticsCalculator::correlation(four, flat.data(), flat.data(), 1).strength == "invalid") {
+        PASS()
+    } else {
+        FAIL("Edge cases incorrect")
+    }
+
+    // Summary
+    std::cout << "\n========================================\n";
+    std::cout << "Tests passed: " << passed << "\n";
+    std::cout << "Tests failed: " << failed << "\n";
+    std::cout << "========================================\n";
+
+    return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,207 @@
+/**
+ * Expense Cube Unit Tests
+ *
+ * Validates roll-ups against brute-force scans, delta maintenance against
+ * rebuilds, and the binary round trip.
+ */
+
+#include "expense_cube.hpp"
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+
+using namespace expense;
+
+#define TEST(name) std::cout << "Testing: " << #name << "... ";
+#define PASS() std::cout << "PASSED\n"; passed++;
+#define FAIL(msg) std::cout << "FAILED: " << msg << "\n"; failed++;
+
+namespace {
+
+struct Row {
+    int64_t user;
+    int32_t date;
+    Category category;
+    int64_t paise;
+};
+
+/**
+ * Brute-force count / sum / mean / variance of the rows in a slice.
+ */
+bool matches(const std::vector<Row>& rows, const CubeQuery& query, const CubeCell& cell) {
+    int64_t count = 0;
+    int64_t sum = 0;
+    double squares = 0.0;
+    for (const Row& row : rows) {
+        const int32_t month = month_index(row.date);
+        if ((query.user != ALL_USERS && row.user != query.user) ||
+            (query.category != ALL_CATEGORIES && static_cast<int>(row.category) != query.category) ||
+            month < query.month_from || month > query.month_to) {
+            continue;
+        }
+        ++count;
+        sum += row.paise;
+        squares += static_cast<double>(row.paise) * static_cast<double>(row.paise);
+    }
+    if (cell.count != count || cell.sum != sum) return false;
+    if (count == 0) return cell.variance() == 0.0;
+    const double mean = static_cast<double>(sum) / static_cast<double>(count);
+    const double mean_square = squares / static_cast<double>(count) / 10000.0;
+    const double variance = mean_square - mean * mean / 10000.0;
+    return std::abs(cell.variance() - variance) <= 1e-9 * std::max(1.0, mean_square);
+}
+
+} // namespace
+
+int main() {
+    int passed = 0;
+    int failed = 0;
+    std::mt19937 rng(25);
+
+    // Test month indexing and basic roll-ups
+    TEST(rollups)
+    ExpenseCube cube;
+    cube.add(7, parse_iso_date("2024-01-15"), Category::Food, Money::parse("100"));
+    cube.add(7, parse_iso_date("2024-01-20"), Category::Food, Money::parse("300"));
+    cube.add(7, parse_iso_date("2024-03-01"), Category::Rent, Money::parse("15000"));
+    cube.add(9, parse_iso_date("2023-12-31"), Category::Food, Money::parse("50.50"));
+    CubeQuery query;
+    query.user = 7;
+    query.month_from = month_index(2024, 1);
+    query.month_to = month_index(2024, 1);
+    CubeCell january = cube.total(query);
+    std::array<CubeCell, CATEGORY_COUNT> categories = cube.by_category(CubeQuery());
+    CubeQuery user7;
+    user7.user = 7;
+    user7.month_from = month_index(2023, 12);
+    user7.month_to = month_index(2024, 3);
+    MonthlyCells months = cube.by_month(user7);
+    std::vector<std::pair<int64_t, CubeCell>> users = cube.by_user(CubeQuery());
+    CubeQuery stranger;
+    stranger.user = 42;
+    bool ok = month_index(parse_iso_date("2024-03-31")) == month_index(2024, 3) &&
+              month_index(parse_iso_date("1969-12-31")) == month_index(1969, 12) &&
+              january.count == 2 && january.total() == Money::parse("400") &&
+              january.mean() == 200.0 && january.variance() == 10000.0 &&
+              categories[static_cast<size_t>(Category::Food)].total() == Money::parse("450.50") &&
+              categories[static_cast<size_t>(Category::Rent)].count == 1 &&
+              months.first_month == month_index(2023, 12) && months.cells.size() == 4 &&
+              months.cells[0].count == 0 && months.cells[1].count == 2 && months.cells[3].count == 1 &&
+              users.size() == 2 && users[0].first == 7 && users[0].second.count == 3 &&
+              users[1].first == 9 && cube.total(stranger).count == 0 && cube.user_count() == 2;
+    if (ok) {
+        PASS()
+    } else {
+        FAIL("Roll-ups incorrect")
+    }
+
+    // Test random adds and removes against brute force and a rebuild
+    TEST(delta_maintenance)
+    ExpenseCube live;
+    std::vector<Row> rows;
+    ok = true;
+    for (int step = 0; step < 4000; ++step) {
+        if (rows.empty() || rng() % 4 != 0) {
+            Row row{static_cast<int64_t>(rng() % 6) - 2, 19000 + static_cast<int32_t>(rng() % 1500),
+                    static_cast<Category>(rng() % CATEGORY_COUNT),
+                    static_cast<int64_t>(rng() % 10000000) - 100000};
+            live.add(row.user, row.date, row.category, Money::from_paise(row.paise));
+            rows.push_back(row);
+        } else {
+            size_t k = rng() % rows.size();
+            const Row& row = rows[k];
+            live.remove(row.user, row.date, row.category, Money::from_paise(row.paise));
+            rows[k] = rows.back();
+            rows.pop_back();
+        }
+    }
+    ExpenseCube rebuilt;
+    for (const Row& row : rows) rebuilt.add(row.user, row.date, row.category, Money::from_paise(row.paise));
+    for (int q = 0; q < 300 && ok; ++q) {
+        CubeQuery random;
+        random.user = rng() % 7 == 0 ? ALL_USERS : static_cast<int64_t>(rng() % 7) - 2;
+        random.category = rng() % 3 == 0 ? ALL_CATEGORIES : static_cast<int>(rng() % CATEGORY_COUNT);
+        random.month_from = month_index(19000) + static_cast<int32_t>(rng() % 52) - 2;
+        random.month_to = random.month_from + static_cast<int32_t>(rng() % 20);
+        ok = matches(rows, random, live.total(random)) && live.total(random) == rebuilt.total(random);
+    }
+    try {
+        live.remove(99, 19000, Category::Food, Money::parse("1"));
+        ok = false;
+    } catch (const std::invalid_argument&) {
+    }
+    try {
+        live.add(ALL_USERS, 19000, Category::Food, Money::parse("1"));
+        ok = false;
+    } catch (const std::invalid_argument&) {
+    }
+    if (ok) {
+        PASS()
+    } else {
+        FAIL("Delta-maintained cube diverged from brute force")
+    }
+
+    // Test bulk table loads and edits
+    TEST(table_load)
+    ExpenseTable table;
+    table.append(120.0, parse_iso_date("2024-05-02"), Category::Transport, "", "");
+    table.append(80.25, parse_iso_date("2024-05-30"), Category::Transport, "", "");
+    table.append(999.99, parse_iso_date("2025-02-14"), Category::Shopping, "", "");
+    ExpenseCube loaded;
+    loaded.add(1, table);
+    loaded.update(1, parse_iso_date("2024-05-30"), Category::Transport, Money::parse("80.25"),
+                  parse_iso_date("2024-06-01"), Category::Food, Money::parse("90"));
+    CubeQuery may;
+    may.month_from = may.month_to = month_index(2024, 5);
+    CubeQuery june = may;
+    june.month_from = june.month_to = month_index(2024, 6);
+    ok = loaded.total(may).total() == Money::parse("120") && loaded.total(june).total() == Money::parse("90") &&
+         loaded.total(CubeQuery()).total() == Money::parse("1209.99") &&
+         loaded.first_month() <= month_index(2024, 5) && loaded.months() >= 10;
+    if (ok) {
+        PASS()
+    } else {
+        FAIL("Table load or update incorrect")
+    }
+
+    // Test the binary round trip and corrupt input
+    TEST(serialization)
+    const std::string bytes = live.serialize();
+    ExpenseCube restored = ExpenseCube::deserialize(bytes.data(), bytes.size());
+    ok = restored.user_count() == live.user_count() && restored.months() == live.months() &&
+         restored.total(CubeQuery()) == live.total(CubeQuery()) &&
+         restored.by_user(CubeQuery()) == live.by_user(CubeQuery()) &&
+         restored.by_category(CubeQuery()) == live.by_category(CubeQuery()) &&
+         bytes.size() < live.months() * CATEGORY_COUNT * (live.user_count() + 1) * sizeof(CubeCell) / 4;
+    const std::string empty = ExpenseCube().serialize();
+    ok = ok && ExpenseCube::deserialize(empty.data(), empty.size()).user_count() == 0;
+    for (size_t cut : {size_t(4), size_t(30), bytes.size() - 1}) {
+        try {
+            ExpenseCube::deserialize(bytes.data(), cut);
+            ok = false;
+        } catch (const std::runtime_error&) {
+        }
+    }
+    std::string bad_version = bytes;
+    bad_version[8] = 9;
+    try {
+        ExpenseCube::deserialize(bad_version.data(), bad_version.size());
+        ok = false;
+    } catch (const std::runtime_error& e) {
+        ok = ok && std::string(e.what()).find("version") != std::string::npos;
+    }
+    if (ok) {
+        PASS()
+    } else {
+        FAIL("Round trip lost data or accepted corrupt input")
+    }
+
+    // Summary
+    std::cout << "\n========================================\n";
+    std::cout << "Tests passed: " << passed << "\n";
+    std::cout << "Tests failed: " << failed << "\n";
+    std::cout << "========================================\n";
+
+    return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,108 @@
+/**
+ * Expense Table Unit Tests
+ * 
+ * Validates column storage, dictionary encoding, dates and date ordering.
+ */
+
+#include "expense_table.hpp"
+#include "statistics.hpp"
+#include <iostream>
+#include <stdexcept>
+
+using namespace expense;
+
+#define TEST(name) std::cout << "Testing: " << #name << "... "; 
+#define PASS() std::cout << "PASSED\n"; passed++;
+#define FAIL(msg) std::cout << "FAILED: " << msg << "\n"; failed++;
+
+int main() {
+    int passed = 0;
+    int failed = 0;
+    
+    // Test epoch-day conversion round trip
+    TEST(dates)
+    int year;
+    unsigned month, day;
+    civil_from_days(parse_iso_date("2024-02-29"), &year, &month, &day);
+    bool dates_ok = days_from_civil(1970, 1, 1) == 0 &&
+                    parse_iso_date("2000-03-01") == 11017 &&
+                    year == 2024 && month == 2 && day == 29;
+    bool rejected = false;
+    try {
+        parse_iso_date("2023-02-29");
+    } catch (const std::invalid_argument&) {
+        rejected = true;
+    }
+    if (dates_ok && rejected) {
+        PASS()
+    } else {
+        FAIL("Date conversion incorrect")
+    }
+    
+    // Test categories mirror the Java enum names
+    TEST(categories)
+    if (parse_category("GROCERIES") == Category::Groceries &&
+        std::string(category_name(Category::Other)) == "OTHER" &&
+        static_cast<int>(Category::Savings) == 12) {
+        PASS()
+    } else {
+        FAIL("Category mapping incorrect")
+    }
+    
+    // Test append, dictionary encoding and column views
+    TEST(append_columns)
+    ExpenseTable table;
+    table.append(250.0, parse_iso_date("2024-01-15"), Category::Food, "Swiggy", "UPI");
+    table.append(1200.0, parse_iso_date("2024-01-01"), Category::Rent, "Landlord", "NEFT", true);
+    table.append(80.5, parse_iso_date("2024-01-10"), Category::Food, "Swiggy", "Card");
+    
+    ColumnView<double> amounts = table.amounts();
+    if (table.size() == 3 && amounts.size == 3 && amounts[2] == 80.5 &&
+        table.merchants().size() == 2 && table.merchant_ids()[2] == 0 &&
+        table.payment_methods().size() == 3 && !table.sorted_by_date() &&
+        StatisticsCalculator::calculate_all(amounts.data, amounts.size).sum == 1530.5) {
+        PASS()
+    } else {
+        FAIL("Column contents incorrect")
+    }
+    
+    // Test sort by date keeps rows aligned
+    TEST(sort_by_date)
+    table.sort_by_date();
+    ExpenseRecord first = table.row(0);
+    ExpenseRecord last = table.row(2);
+    if (table.sorted_by_date() && first.amount == 1200.0 && first.recurring &&
+        first.category == Category::Rent &&
+        table.merchants().name(first.merchant) == "Landlord" &&
+        last.amount == 250.0 && table.payment_methods().name(last.payment_method) == "UPI") {
+        PASS()
+    } else {
+        FAIL("Rows misaligned after sort")
+    }
+    
+    // Test appending a table re-interns its dictionary ids
+    TEST(append_table)
+    ExpenseTable other;
+    other.append(99.0, parse_iso_date("2023-12-31"), Category::Travel, "Uber", "Card");
+    other.append(45.0, parse_iso_date("2024-02-01"), Category::Food, "Swiggy", "UPI");
+    table.append(other);
+    ExpenseRecord uber = table.row(3);
+    ExpenseRecord swiggy = table.row(4);
+    if (table.size() == 5 && !table.sorted_by_date() && table.merchants().size() == 3 &&
+        table.merchants().name(uber.merchant) == "Uber" && uber.category == Category::Travel &&
+        swiggy.merchant == table.row(1).merchant &&
+        table.merchants().name(swiggy.merchant) == "Swiggy" &&
+        table.payment_methods().name(swiggy.payment_method) == "UPI") {
+        PASS()
+    } else {
+        FAIL("Appended rows or dictionaries incorrect")
+    }
+    
+    // Summary
+    std::cout << "\n========================================\n";
+    std::cout << "Tests passed: " << passed << "\n";
+    std::cout << "Tests failed: " << failed << "\n";
+    std::cout << "========================================\n";
+    
+    return failed > 0 ? 1 : 0;
+}
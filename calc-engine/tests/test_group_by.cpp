@@ -0,0 +1,128 @@
+/**
+ * Group-By Unit Tests
+ * 
+ * Validates per-category aggregation, the binary layout and the C API.
+ */
+
+#include "group_by.hpp"
+#include "expense_c_api.h"
+#include "ingest.hpp"
+#include <iostream>
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace expense;
+
+#define TEST(name) std::cout << "Testing: " << #name << "... "; 
+#define PASS() std::cout << "PASSED\n"; passed++;
+#define FAIL(msg) std::cout << "FAILED: " << msg << "\n"; failed++;
+
+bool approx_equal(double a, double b, double epsilon = 0.0001) {
+    return std::abs(a - b) < epsilon;
+}
+
+int main() {
+    int passed = 0;
+    int failed = 0;
+    
+    const uint8_t food = static_cast<uint8_t>(Category::Food);
+    const uint8_t rent = static_cast<uint8_t>(Category::Rent);
+    std::vector<double> amounts = {100.0, 1200.0, 300.0, 200.0};
+    std::vector<uint8_t> codes = {food, rent, food, food};
+    
+    // Test core aggregates
+    TEST(core_aggregates)
+    GroupByResult r = group_by_category(amounts.data(), codes.data(), amounts.size());
+    const GroupStats& f = r.groups[food];
+    if (r.groups.size() == CATEGORY_COUNT && approx_equal(r.total, 1800.0) &&
+        f.count == 3 && approx_equal(f.sum, 600.0) && approx_equal(f.mean, 200.0) &&
+        f.min == 100.0 && f.max == 300.0 && approx_equal(f.percentage, 100.0 / 3.0) &&
+        r.groups[rent].count == 1 && r.groups[0 + 1].count == 0) {
+        PASS()
+    } else {
+        FAIL("Aggregates incorrect")
+    }
+    
+    // Test variance and per-group quantiles
+    TEST(variance_quantiles)
+    GroupByOptions options;
+    options.variance = true;
+    options.percentiles = {50, 100, 99.9, 99};
+    GroupByResult q = group_by_category(amounts.data(), codes.data(), amounts.size(),
+                                        CATEGORY_COUNT, options);
+    std::string quantile_json = q.to_json();
+    if (approx_equal(q.groups[food].variance, 20000.0 / 3.0) &&
+        q.groups[food].quantiles[0] == 200.0 && q.groups[food].quantiles[1] == 300.0 &&
+        q.groups[rent].quantiles[0] == 1200.0 &&
+        quantile_json.find("\"p50\":200.00,\"p100\":300.00,\"p99.9\":") != std::string::npos &&
+        quantile_json.find("\"p99\":") != std::string::npos) {
+        PASS()
+    } else {
+        FAIL("Variance or quantiles incorrect")
+    }
+    
+    // Test JSON uses analytics-engine keys and omits empty groups
+    TEST(json)
+    std::string json = r.to_json();
+    if (json.find("\"FOOD\":{\"total\":600.00,\"count\":3,\"average\":200.00") != std::string::npos &&
+        json.find("\"TRANSPORT\"") == std::string::npos) {
+        PASS()
+    } else {
+        FAIL("Got " << json)
+    }
+    
+    // Test out-of-range codes are rejected
+    TEST(invalid_code)
+    bool rejected = false;
+    try {
+        group_by_category(amounts.data(), codes.data(), amounts.size(), 5);
+    } catch (const std::invalid_argument&) {
+        rejected = true;
+    }
+    if (rejected) {
+        PASS()
+    } else {
+        FAIL("Out-of-range code accepted")
+    }
+    
+    // Test C API matches the C++ layout
+    TEST(c_api)
+    const double pct[] = {50};
+    std::vector<double> out(CATEGORY_COUNT * (EXPENSE_GROUP_FIELDS + 1));
+    int status = expense_group_by_category(amounts.data(), codes.data(), amounts.size(),
+                                           CATEGORY_COUNT, pct, 1, EXPENSE_GROUP_VARIANCE,
+                                           out.data(), out.size());
+    const double* rent_block = out.data() + rent * (EXPENSE_GROUP_FIELDS + 1);
+    int too_small = expense_group_by_category(amounts.data(), codes.data(), amounts.size(),
+                                              CATEGORY_COUNT, pct, 1, 0, out.data(), 10);
+    if (status == EXPENSE_OK && rent_block[0] == 1.0 && rent_block[1] == 1200.0 &&
+        rent_block[7] == 1200.0 && too_small == EXPENSE_ERR_BUFFER &&
+        std::string(expense_last_error()) == "Output buffer too small") {
+        PASS()
+    } else {
+        FAIL("C API result incorrect")
+    }
+    
+    // Test pair parsing with a count line
+    TEST(parse_pairs)
+    std::string text = "2\n250.50 FOOD\n99 TRAVEL\n";
+    CategorizedBatch batch = parse_categorized(text.data(), text.data() + text.size());
+    std::string headerless = "250 FOOD 3 GROCERIES";
+    CategorizedBatch plain = parse_categorized(headerless.data(), headerless.data() + headerless.size());
+    if (batch.had_count && batch.amounts.size() == 2 && batch.amounts[0] == 250.5 &&
+        batch.codes[1] == static_cast<uint8_t>(Category::Travel) &&
+        !plain.had_count && plain.amounts.size() == 2 && plain.amounts[1] == 3.0) {
+        PASS()
+    } else {
+        FAIL("Pairs parsed incorrectly")
+    }
+    
+    // Summary
+    std::cout << "\n========================================\n";
+    std::cout << "Tests passed: " << passed << "\n";
+    std::cout << "Tests failed: " << failed << "\n";
+    std::cout << "========================================\n";
+    
+    return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,103 @@
+/**
+ * Ingestion Unit Tests
+ * 
+ * Validates from_chars parsing, count-header detection and diagnostics.
+ */
+
+#include "ingest.hpp"
+#include <iostream>
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace expense;
+
+#define TEST(name) std::cout << "Testing: " << #name << "... "; 
+#define PASS() std::cout << "PASSED\n"; passed++;
+#define FAIL(msg) std::cout << "FAILED: " << msg << "\n"; failed++;
+
+AmountBatch parse(const std::string& text, bool exact = false,
+                  CountHeader header = CountHeader::Auto) {
+    return parse_amounts(text.data(), text.data() + text.size(), exact, header);
+}
+
+int main() {
+    int passed = 0;
+    int failed = 0;
+    
+    // Test count header is consumed when it matches
+    TEST(count_header)
+    AmountBatch with_count = parse("3\n10.5\n+20\n-5e1\n");
+    if (with_count.had_count && with_count.amounts.size() == 3 &&
+        with_count.amounts[0] == 10.5 && with_count.amounts[1] == 20.0 &&
+        with_count.amounts[2] == -50.0) {
+        PASS()
+    } else {
+        FAIL("Count header not detected")
+    }
+    
+    // Test headerless input
+    TEST(no_header)
+    AmountBatch headerless = parse("1\r\n20.25 30\n");
+    AmountBatch forced = parse("2\n5\n7\n", false, CountHeader::None);
+    if (!headerless.had_count && headerless.amounts.size() == 3 &&
+        forced.amounts.size() == 3 && forced.amounts[0] == 2.0) {
+        PASS()
+    } else {
+        FAIL("Headerless input misread")
+    }
+    
+    // Test exact mode keeps paise
+    TEST(exact)
+    AmountBatch exact = parse("2\n85.30\n0.1\n", true);
+    if (exact.exact.size() == 2 && exact.exact[0].paise() == 8530 &&
+        exact.exact[1].paise() == 10) {
+        PASS()
+    } else {
+        FAIL("Exact amounts incorrect")
+    }
+    
+    // Test line/column of a bad token
+    TEST(error_position)
+    bool located = false;
+    try {
+        parse("3\n10\n  12.x5\n7\n");
+    } catch (const ParseError& e) {
+        located = e.line() == 3 && e.column() == 3;
+    }
+    if (located) {
+        PASS()
+    } else {
+        FAIL("Error position incorrect")
+    }
+    
+    // Test a count that does not match is read as data
+    TEST(mismatched_count)
+    AmountBatch larger = parse("1500\n200\n300\n");
+    AmountBatch smaller = parse("3\n1\n2\n3\n4\n");
+    if (!larger.had_count && larger.amounts.size() == 3 && larger.amounts[0] == 1500.0 &&
+        !smaller.had_count && smaller.amounts.size() == 5) {
+        PASS()
+    } else {
+        FAIL("Mismatched count misread")
+    }
+    
+    // Test one segment per line, with a blank line as an empty segment
+    TEST(segmented)
+    std::string lines = "10 20.5\n\n7\n1 2 3\n\n";
+    SegmentedBatch segmented = parse_segmented(lines.data(), lines.data() + lines.size());
+    if (segmented.segments() == 4 && segmented.amounts.size() == 6 &&
+        segmented.offsets == std::vector<size_t>{0, 2, 2, 3, 6} && segmented.amounts[1] == 20.5) {
+        PASS()
+    } else {
+        FAIL("Segmented parse incorrect")
+    }
+    
+    // Summary
+    std::cout << "\n========================================\n";
+    std::cout << "Tests passed: " << passed << "\n";
+    std::cout << "Tests failed: " << failed << "\n";
+    std::cout << "========================================\n";
+    
+    return failed > 0 ? 1 : 0;
+}
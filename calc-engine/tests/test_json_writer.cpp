@@ -0,0 +1,87 @@
+/**
+ * JSON Writer Unit Tests
+ * 
+ * Validates number formatting, escaping and descriptor streaming.
+ */
+
+#include "json_writer.hpp"
+#include "statistics.hpp"
+#include <iostream>
+#include <cstdio>
+#include <string>
+
+using namespace expense;
+
+#define TEST(name) std::cout << "Testing: " << #name << "... "; 
+#define PASS() std::cout << "PASSED\n"; passed++;
+#define FAIL(msg) std::cout << "FAILED: " << msg << "\n"; failed++;
+
+int main() {
+    int passed = 0;
+    int failed = 0;
+    
+    // Test fixed precision matches std::fixed rounding
+    TEST(numbers)
+    JsonWriter out;
+    out.number(1234.5, 2).raw(',').number(-0.125, 2).raw(',').number(0.66666, 4)
+       .raw(',').integer(-42).raw(',').integer(18446744073709551615ULL);
+    if (out.str() == "1234.50,-0.12,0.6667,-42,18446744073709551615") {
+        PASS()
+    } else {
+        FAIL("Got " << out.str())
+    }
+    
+    // Test string escaping
+    TEST(escaping)
+    out.clear();
+    out.string(std::string("a\"b\\c\n\x01", 7));
+    if (out.str() == "\"a\\\"b\\\\c\\u000a\\u0001\"") {
+        PASS()
+    } else {
+        FAIL("Got " << out.str())
+    }
+    
+    // Test result rendering
+    TEST(result_json)
+    MovingAverageResult ma;
+    ma.window_size = 3;
+    ma.current_average = 2.5;
+    ma.values = {1.0, 2.5};
+    if (ma.to_json() == "{\"window_size\":3,\"current_average\":2.50,\"values\":[1.00,2.50]}") {
+        PASS()
+    } else {
+        FAIL("Got " << ma.to_json())
+    }
+    
+    // Test streaming through a buffer much smaller than the output
+    TEST(streaming)
+    std::FILE* file = std::tmpfile();
+    std::string expected;
+    {
+        JsonWriter stream = JsonWriter::stream(fileno(file), 16);
+        for (int i = 0; i < 5000; ++i) {
+            stream.number(i * 0.5, 2).raw(',');
+            expected += std::to_string(i / 2) + (i % 2 ? ".50," : ".00,");
+        }
+        std::string big(100000, 'x');
+        stream.raw(big.data(), big.size());
+        expected += big;
+    }
+    std::string actual(expected.size() + 1, '\0');
+    std::rewind(file);
+    actual.resize(std::fread(&actual[0], 1, actual.size(), file));
+    std::fclose(file);
+    if (actual == expected) {
+        PASS()
+    } else {
+        FAIL("Streamed output differs")
+    }
+    
+    // Summary
+    std::cout << "\n========================================\n";
+    std::cout << "Tests passed: " << passed << "\n";
+    std::cout << "Tests failed: " << failed << "\n";
+    std::cout << "========================================\n";
+    
+    return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,115 @@
+/**
+ * Money Unit Tests
+ * 
+ * Validates fixed-point parsing, formatting and exact aggregation.
+ */
+
+#include "money.hpp"
+#include "statistics.hpp"
+#include <iostream>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+using namespace expense;
+
+#define TEST(name) std::cout << "Testing: " << #name << "... "; 
+#define PASS() std::cout << "PASSED\n"; passed++;
+#define FAIL(msg) std::cout << "FAILED: " << msg << "\n"; failed++;
+
+bool nearly_equal(double a, double b, double epsilon = 0.001) {
+    return std::abs(a - b) < epsilon;
+}
+
+int main() {
+    int passed = 0;
+    int failed = 0;
+    
+    // Test parsing
+    TEST(parse)
+    if (Money::parse("85.30").paise() == 8530 &&
+        Money::parse("1500").paise() == 150000 &&
+        Money::parse("12.5").paise() == 1250 &&
+        Money::parse("-0.05").paise() == -5 &&
+        Money::parse(".99").paise() == 99 &&
+        Money::parse("92233720368547758.07").paise() == std::numeric_limits<int64_t>::max()) {
+        PASS()
+    } else {
+        FAIL("Decimal parsing incorrect")
+    }
+    
+    // Test rejection of invalid input
+    TEST(parse_invalid)
+    int rejected = 0;
+    for (const char* bad : {"", "abc", "1.234", "12.3x", "-", ".", "92233720368547758.99"}) {
+        try {
+            Money::parse(bad);
+        } catch (const std::invalid_argument&) {
+            rejected++;
+        }
+    }
+    if (rejected == 7) {
+        PASS()
+    } else {
+        FAIL("Accepted " + std::to_string(7 - rejected) + " invalid amounts")
+    }
+    
+    // Test formatting
+    TEST(to_string)
+    if (Money::from_paise(8530).to_string() == "85.30" &&
+        Money::from_paise(-5).to_string() == "-0.05" &&
+        Money::from_double(9.99).to_string() == "9.99") {
+        PASS()
+    } else {
+        FAIL("Formatting incorrect")
+    }
+    
+    // Test exact sum where doubles drift
+    TEST(sum_exact)
+    std::vector<Money> dimes(1000000, Money::parse("0.10"));
+    Money total = StatisticsCalculator::sum(dimes);
+    if (total.paise() == 10000000) {
+        PASS()
+    } else {
+        FAIL("Expected 100000.00, got " + total.to_string())
+    }
+    
+    // Test mode
+    TEST(mode)
+    std::vector<Money> amounts = {
+        Money::parse("15.50"), Money::parse("45.00"), Money::parse("9.99"),
+        Money::parse("45.00"), Money::parse("1500.00"), Money::parse("15.50")
+    };
+    if (StatisticsCalculator::mode(amounts) == Money::parse("15.50")) {
+        PASS()
+    } else {
+        FAIL("Mode tie should resolve to the smallest amount")
+    }
+    
+    // Test calculate_all agrees with the double path
+    TEST(calculate_all)
+    std::vector<double> as_double;
+    for (Money m : amounts) as_double.push_back(m.to_double());
+    StatisticsResult exact = StatisticsCalculator::calculate_all(amounts);
+    StatisticsResult approx = StatisticsCalculator::calculate_all(as_double);
+    if (exact.count == approx.count &&
+        exact.sum == 1630.99 &&
+        nearly_equal(exact.mean, approx.mean) &&
+        nearly_equal(exact.median, approx.median) &&
+        nearly_equal(exact.variance, approx.variance) &&
+        nearly_equal(exact.q1, approx.q1) &&
+        nearly_equal(exact.q3, approx.q3) &&
+        exact.min == 9.99 && exact.max == 1500.0) {
+        PASS()
+    } else {
+        FAIL("Exact statistics disagree with double statistics")
+    }
+    
+    // Summary
+    std::cout << "\n========================================\n";
+    std::cout << "Tests passed: " << passed << "\n";
+    std::cout << "Tests failed: " << failed << "\n";
+    std::cout << "========================================\n";
+    
+    return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,122 @@
+/**
+ * Parallel Scan Unit Tests
+ *
+ * Validates the parallel SMA/EMA against the sequential versions and
+ * checks that the output does not depend on the thread count.
+ */
+
+#include "parallel_scan.hpp"
+#include "statistics.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace expense;
+
+#define TEST(name) std::cout << "Testing: " << #name << "... ";
+#define PASS() std::cout << "PASSED\n"; passed++;
+#define FAIL(msg) std::cout << "FAILED: " << msg << "\n"; failed++;
+
+namespace {
+
+double max_relative_error(const std::vector<double>& a, const std::vector<double>& b) {
+    if (a.size() != b.size()) return 1e300;
+    double worst = 0.0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        double err = std::abs(a[i] - b[i]) / std::max(1.0, std::abs(b[i]));
+        worst = std::max(worst, err);
+    }
+    return worst;
+}
+
+} // namespace
+
+int main() {
+    int passed = 0;
+    int failed = 0;
+
+    std::mt19937_64 rng(7);
+    std::lognormal_distribution<double> dist(4.0, 1.0);
+    std::vector<double> data(300000);
+    for (double& v : data) v = std::round(dist(rng) * 100.0) / 100.0;
+
+    // Small chunks so the test crosses many chunk boundaries
+    ThreadPool four_threads(4);
+    ExecutionPolicy four;
+    four.pool = &four_threads;
+    four.chunk_size = 1000;
+
+    // Test SMA against the sequential version
+    TEST(sma_matches_sequential)
+    bool ok = true;
+    for (int window : {1, 7, 30, 365, 5000}) {
+        MovingAverageResult seq = StatisticsCalculator::moving_average(data, window);
+        MovingAverageResult par = parallel_moving_average(data, window, four);
+        if (par.window_size != seq.window_size || max_relative_error(par.values, seq.values) > 1e-10) {
+            ok = false;
+        }
+    }
+    if (ok) {
+        PASS()
+    } else {
+        FAIL("Parallel SMA diverges from moving_average")
+    }
+
+    // Test EMA against the sequential version, including slow decay
+    TEST(ema_matches_sequential)
+    ok = true;
+    for (double alpha : {1.0, 0.3, 0.01, 1e-5}) {
+        MovingAverageResult seq = StatisticsCalculator::exponential_moving_average(data, alpha);
+        MovingAverageResult par = parallel_exponential_moving_average(data, alpha, four);
+        double err = max_relative_error(par.values, seq.values);
+        if (par.values.front() != data.front() || err > 1e-9) {
+            std::cout << "(alpha=" << alpha << " err=" << err << ") ";
+            ok = false;
+        }
+    }
+    if (ok) {
+        PASS()
+    } else {
+        FAIL("Parallel EMA diverges from exponential_moving_average")
+    }
+
+    // Test that 1 and 4 threads give bit-identical output
+    TEST(deterministic_across_threads)
+    ThreadPool one_thread(1);
+    ExecutionPolicy one = four;
+    one.pool = &one_thread;
+    bool same_sma = parallel_moving_average(data, 30, one).values ==
+                    parallel_moving_average(data, 30, four).values;
+    bool same_ema = parallel_exponential_moving_average(data, 0.05, one).values ==
+                    parallel_exponential_moving_average(data, 0.05, four).values;
+    if (same_sma && same_ema) {
+        PASS()
+    } else {
+        FAIL("Output depends on thread count")
+    }
+
+    // Test edge cases: empty, clamped window, invalid alpha
+    TEST(edge_cases)
+    std::vector<double> tiny = {1.0, 2.0, 3.0};
+    MovingAverageResult clamped = parallel_moving_average(tiny, 10, four);
+    MovingAverageResult single = parallel_exponential_moving_average(tiny.data(), 1, 0.5, four);
+    if (parallel_moving_average(std::vector<double>(), 5).values.empty() &&
+        parallel_exponential_moving_average(tiny, 0.0).values.empty() &&
+        clamped.window_size == 3 && clamped.values.size() == 1 && clamped.values[0] == 2.0 &&
+        single.values.size() == 1 && single.values[0] == 1.0) {
+        PASS()
+    } else {
+        FAIL("Edge cases incorrect")
+    }
+
+    // Summary
+    std::cout << "\n========================================\n";
+    std::cout << "Tests passed: " << passed << "\n";
+    std::cout << "Tests failed: " << failed << "\n";
+    std::cout << "========================================\n";
+
+    return failed > 0 ? 1 : 0;
+}
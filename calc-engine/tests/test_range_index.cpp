@@ -0,0 +1,148 @@
+/**
+ * Range Index Unit Tests
+ *
+ * Validates the Fenwick tree, the min/max segment tree and DailyTotals
+ * against brute-force rescans under random updates.
+ */
+
+#include "range_index.hpp"
+#include <iostream>
+#include <random>
+#include <stdexcept>
+
+using namespace expense;
+
+#define TEST(name) std::cout << "Testing: " << #name << "... ";
+#define PASS() std::cout << "PASSED\n"; passed++;
+#define FAIL(msg) std::cout << "FAILED: " << msg << "\n"; failed++;
+
+int main() {
+    int passed = 0;
+    int failed = 0;
+    std::mt19937 rng(9);
+
+    // Test Fenwick prefix and range sums under point updates
+    TEST(fenwick_tree)
+    std::vector<int64_t> values(1000);
+    for (int64_t& v : values) v = static_cast<int64_t>(rng() % 1000) - 200;
+    FenwickTree<int64_t> fenwick(values);
+    bool ok = fenwick.size() == 1000 && fenwick.sum(5, 5) == 0 && fenwick.sum(9, 3) == 0;
+    for (int step = 0; step < 2000 && ok; ++step) {
+        size_t i = rng() % values.size();
+        int64_t delta = static_cast<int64_t>(rng() % 101) - 50;
+        values[i] += delta;
+        fenwick.add(i, delta);
+        size_t a = rng() % (values.size() + 1);
+        size_t b = rng() % (values.size() + 1);
+        if (a > b) std::swap(a, b);
+        int64_t expected = 0;
+        for (size_t k = a; k < b; ++k) expected += values[k];
+        ok = fenwick.sum(a, b) == expected;
+    }
+    if (ok) {
+        PASS()
+    } else {
+        FAIL("Fenwick sums differ from rescan")
+    }
+
+    // Test range min/max under point assignment, odd sizes included
+    TEST(min_max_tree)
+    ok = true;
+    for (size_t n : {1u, 2u, 7u, 100u, 1001u}) {
+        std::vector<double> data(n);
+        for (double& v : data) v = static_cast<double>(rng() % 10000) / 7.0;
+        MinMaxTree<double> tree(data);
+        for (int step = 0; step < 500 && ok; ++step) {
+            size_t i = rng() % n;
+            data[i] = static_cast<double>(rng() % 10000) / 3.0 - 500.0;
+            tree.set(i, data[i]);
+            size_t a = rng() % n;
+            size_t b = a + 1 + rng() % (n - a);
+            MinMax<double> got = tree.range(a, b);
+            ok = got.min == *std::min_element(data.begin() + a, data.begin() + b) &&
+                 got.max == *std::max_element(data.begin() + a, data.begin() + b);
+        }
+    }
+    try {
+        MinMaxTree<double>(std::vector<double>{1.0, 2.0}).range(1, 1);
+        ok = false;
+    } catch (const std::out_of_range&) {
+    }
+    if (ok) {
+        PASS()
+    } else {
+        FAIL("Min/max differs from rescan")
+    }
+
+    // Test daily totals through creates, edits and deletes
+    TEST(daily_totals_updates)
+    ExpenseTable table;
+    table.append(100.0, 19000, Category::Food, "", "");
+    table.append(50.25, 19000, Category::Food, "", "");
+    table.append(300.0, 19003, Category::Rent, "", "");
+    DailyTotals days(table);
+    ok = days.days() == 4 && days.total(19000, 19003) == Money::parse("450.25") &&
+         days.count(18000, 20000) == 3 && days.day(19001) == Money();
+    days.update(19003, Money::parse("300"), 19001, Money::parse("310"));
+    days.remove(19000, Money::parse("50.25"));
+    days.add(19010, Money::parse("5"));                  // grows the span
+    days.add(18990, Money::parse("7"));
+    MinMax<Money> extremes = days.day_extremes(19000, 19003);
+    MinMax<Money> beyond = days.day_extremes(19009, 19030);
+    ok = ok && days.total(19000, 19003) == Money::parse("410") && days.count(19000, 19003) == 2 &&
+         days.total(18000, 20000) == Money::parse("422") && days.first_day() <= 18990 &&
+         extremes.min == Money() && extremes.max == Money::parse("310") &&
+         beyond.min == Money() && beyond.max == Money::parse("5");
+    if (ok) {
+        PASS()
+    } else {
+        FAIL("Daily totals incorrect after updates")
+    }
+
+    // Test random edits against recomputing every day
+    TEST(daily_totals_random)
+    DailyTotals random_days;
+    std::vector<int64_t> expected(200, 0);
+    std::vector<std::pair<int32_t, int64_t>> live;
+    ok = random_days.total(0, 100) == Money() && random_days.day_extremes(0, 5).max == Money();
+    for (int step = 0; step < 3000 && ok; ++step) {
+        if (live.empty() || rng() % 3 != 0) {
+            int32_t date = static_cast<int32_t>(rng() % 200);
+            int64_t paise = static_cast<int64_t>(rng() % 100000);
+            random_days.add(date, Money::from_paise(paise));
+            live.emplace_back(date, paise);
+            expected[date] += paise;
+        } else {
+            size_t k = rng() % live.size();
+            random_days.remove(live[k].first, Money::from_paise(live[k].second));
+            expected[live[k].first] -= live[k].second;
+            live[k] = live.back();
+            live.pop_back();
+        }
+        int32_t a = static_cast<int32_t>(rng() % 200);
+        int32_t b = a + static_cast<int32_t>(rng() % (200 - a));
+        int64_t sum = 0;
+        for (int32_t d = a; d <= b; ++d) sum += expected[d];
+        ok = random_days.total(a, b).paise() == sum &&
+             random_days.day_extremes(a, b).max.paise() ==
+                 *std::max_element(expected.begin() + a, expected.begin() + b + 1);
+    }
+    try {
+        random_days.day_extremes(10, 9);
+        ok = false;
+    } catch (const std::invalid_argument&) {
+    }
+    if (ok) {
+        PASS()
+    } else {
+        FAIL("Random edits diverged from rescan")
+    }
+
+    // Summary
+    std::cout << "\n========================================\n";
+    std::cout << "Tests passed: " << passed << "\n";
+    std::cout << "Tests failed: " << failed << "\n";
+    std::cout << "========================================\n";
+
+    return failed > 0 ? 1 : 0;
+}
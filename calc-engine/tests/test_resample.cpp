@@ -0,0 +1,141 @@
+/**
+ * Resampling Unit Tests
+ * 
+ * Validates calendar bucketing, zero fill and strategy equivalence.
+ */
+
+#include "resample.hpp"
+#include "expense_c_api.h"
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace expense;
+
+#define TEST(name) std::cout << "Testing: " << #name << "... "; 
+#define PASS() std::cout << "PASSED\n"; passed++;
+#define FAIL(msg) std::cout << "FAILED: " << msg << "\n"; failed++;
+
+int main() {
+    int passed = 0;
+    int failed = 0;
+    
+    // Sparse, unordered transactions spanning a leap February
+    std::vector<int32_t> dates = {
+        parse_iso_date("2024-03-01"), parse_iso_date("2024-01-31"),
+        parse_iso_date("2024-02-29"), parse_iso_date("2024-01-01"),
+        parse_iso_date("2024-03-01")
+    };
+    std::vector<double> amounts = {10.0, 20.0, 30.0, 40.0, 5.0};
+    
+    // Test monthly buckets with leap-year month lengths
+    TEST(monthly)
+    ResampleResult months = resample(dates.data(), amounts.data(), dates.size());
+    if (months.size() == 3 && months.label(0) == "2024-01" && months.label(2) == "2024-03" &&
+        months.totals[0] == 60.0 && months.totals[1] == 30.0 && months.totals[2] == 15.0 &&
+        months.counts[2] == 2) {
+        PASS()
+    } else {
+        FAIL("Monthly buckets incorrect: " << months.to_json())
+    }
+    
+    // Test zero fill for empty months
+    TEST(zero_fill)
+    std::vector<int32_t> gap_dates = {parse_iso_date("2023-11-15"), parse_iso_date("2024-02-02")};
+    std::vector<double> gap_amounts = {1.0, 2.0};
+    ResampleResult filled = resample(gap_dates.data(), gap_amounts.data(), 2);
+    ResampleOptions sparse;
+    sparse.zero_fill = false;
+    ResampleResult unfilled = resample(gap_dates.data(), gap_amounts.data(), 2, sparse);
+    if (filled.size() == 4 && filled.label(1) == "2023-12" && filled.counts[1] == 0 &&
+        filled.totals[2] == 0.0 && unfilled.size() == 2) {
+        PASS()
+    } else {
+        FAIL("Zero fill incorrect: " << filled.to_json())
+    }
+    
+    // Test ISO weeks across a year boundary
+    TEST(iso_weeks)
+    ResampleOptions weekly;
+    weekly.period = Period::IsoWeek;
+    std::vector<int32_t> week_dates = {parse_iso_date("2020-12-31"), parse_iso_date("2021-01-03"),
+                                       parse_iso_date("2021-01-04")};
+    std::vector<double> week_amounts = {1.0, 2.0, 4.0};
+    ResampleResult weeks = resample(week_dates.data(), week_amounts.data(), 3, weekly);
+    if (weeks.size() == 2 && weeks.label(0) == "2020-W53" && weeks.totals[0] == 3.0 &&
+        weeks.label(1) == "2021-W01" && weeks.starts[1] == parse_iso_date("2021-01-04")) {
+        PASS()
+    } else {
+        FAIL("ISO weeks incorrect: " << weeks.to_json())
+    }
+    
+    // Test daily and yearly labels
+    TEST(day_year)
+    ResampleOptions daily;
+    daily.period = Period::Day;
+    ResampleResult days = resample(dates.data(), amounts.data(), dates.size(), daily);
+    ResampleOptions yearly;
+    yearly.period = Period::Year;
+    ResampleResult years = resample(dates.data(), amounts.data(), dates.size(), yearly);
+    if (days.size() == 61 && days.label(59) == "2024-02-29" && days.totals[60] == 15.0 &&
+        years.size() == 1 && years.label(0) == "2024" && years.totals[0] == 105.0) {
+        PASS()
+    } else {
+        FAIL("Daily or yearly buckets incorrect")
+    }
+    
+    // Test counting and sorted strategies agree bit for bit
+    TEST(strategies_match)
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int32_t> day_dist(19000, 19900);
+    std::uniform_real_distribution<double> amount_dist(1.0, 5000.0);
+    std::vector<int32_t> random_dates(20000);
+    std::vector<double> random_amounts(20000);
+    for (size_t i = 0; i < random_dates.size(); ++i) {
+        random_dates[i] = day_dist(rng);
+        random_amounts[i] = amount_dist(rng);
+    }
+    bool same = true;
+    for (Period period : {Period::Day, Period::IsoWeek, Period::Month, Period::Year}) {
+        ResampleOptions counting;
+        counting.period = period;
+        counting.strategy = ResampleStrategy::Counting;
+        ResampleOptions sorted = counting;
+        sorted.strategy = ResampleStrategy::Sorted;
+        ResampleResult a = resample(random_dates.data(), random_amounts.data(), random_dates.size(), counting);
+        ResampleResult b = resample(random_dates.data(), random_amounts.data(), random_dates.size(), sorted);
+        same = same && a.starts == b.starts && a.totals == b.totals && a.counts == b.counts;
+    }
+    if (same) {
+        PASS()
+    } else {
+        FAIL("Strategies disagree")
+    }
+    
+    // Test C API buffer contract
+    TEST(c_api)
+    size_t produced = 0;
+    int32_t starts[2];
+    double totals[2];
+    uint32_t counts[2];
+    int small = expense_resample(gap_dates.data(), gap_amounts.data(), 2, EXPENSE_PERIOD_MONTH, 1,
+                                 starts, totals, counts, 2, &produced);
+    size_t needed = produced;
+    int ok = expense_resample(gap_dates.data(), gap_amounts.data(), 2, EXPENSE_PERIOD_MONTH, 0,
+                              starts, totals, counts, 2, &produced);
+    if (small == EXPENSE_ERR_BUFFER && needed == 4 && ok == EXPENSE_OK && produced == 2 &&
+        totals[1] == 2.0 && starts[1] == parse_iso_date("2024-02-01")) {
+        PASS()
+    } else {
+        FAIL("C API result incorrect")
+    }
+    
+    // Summary
+    std::cout << "\n========================================\n";
+    std::cout << "Tests passed: " << passed << "\n";
+    std::cout << "Tests failed: " << failed << "\n";
+    std::cout << "========================================\n";
+    
+    return failed > 0 ? 1 : 0;
+}
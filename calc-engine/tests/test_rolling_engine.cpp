@@ -0,0 +1,172 @@
+/**
+ * Rolling Engine Unit Tests
+ *
+ * Validates each rolling statistic against a direct per-window computation.
+ */
+
+#include "rolling_engine.hpp"
+#include "statistics.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace expense;
+
+#define TEST(name) std::cout << "Testing: " << #name << "... ";
+#define PASS() std::cout << "PASSED\n"; passed++;
+#define FAIL(msg) std::cout << "FAILED: " << msg << "\n"; failed++;
+
+namespace {
+
+bool approx_equal(double a, double b, double epsilon = 1e-9) {
+    return std::abs(a - b) <= epsilon * std::max(1.0, std::abs(b));
+}
+
+// Reference value of one statistic over data[start, start + w)
+double direct(const std::vector<double>& data, size_t start, size_t w, RollingStat stat) {
+    auto first = data.begin() + static_cast<std::ptrdiff_t>(start);
+    auto last = first + static_cast<std::ptrdiff_t>(w);
+    double sum = 0.0;
+    for (auto it = first; it != last; ++it) sum += *it;
+    double mean = sum / static_cast<double>(w);
+    double sq = 0.0;
+    for (auto it = first; it != last; ++it) sq += (*it - mean) * (*it - mean);
+    switch (stat) {
+        case RollingStat::Sum: return sum;
+        case RollingStat::Mean: return mean;
+        case RollingStat::Variance: return sq / static_cast<double>(w);
+        case RollingStat::Stddev: return std::sqrt(sq / static_cast<double>(w));
+        case RollingStat::Min: return *std::min_element(first, last);
+        case RollingStat::Max: return *std::max_element(first, last);
+    }
+    return 0.0;
+}
+
+} // namespace
+
+int main() {
+    int passed = 0;
+    int failed = 0;
+
+    const std::vector<RollingStat> all = {
+        RollingStat::Sum, RollingStat::Mean, RollingStat::Variance,
+        RollingStat::Stddev, RollingStat::Min, RollingStat::Max
+    };
+
+    std::vector<double> data = {3.0, 1.0, 4.0, 1.0, 5.0, 9.0, 2.0, 6.0};
+
+    // Test a small hand-checked window
+    TEST(small_window)
+    RollingResult small = RollingEngine().add(3, {RollingStat::Min, RollingStat::Max}).run(data);
+    const RollingSeries* mins = small.find(3, RollingStat::Min);
+    const RollingSeries* maxs = small.find(3, RollingStat::Max);
+    if (mins && maxs && mins->values == std::vector<double>{1, 1, 1, 1, 2, 2} &&
+        maxs->values == std::vector<double>{4, 4, 5, 9, 9, 9}) {
+        PASS()
+    } else {
+        FAIL("Rolling min/max incorrect: " << small.to_json())
+    }
+
+    // Test every stat over several windows against direct computation
+    TEST(matches_direct)
+    std::mt19937_64 rng(42);
+    std::lognormal_distribution<double> dist(3.5, 1.0);
+    std::vector<double> amounts(2000);
+    for (double& v : amounts) v = std::round(dist(rng) * 100.0) / 100.0;
+
+    RollingEngine engine({{7, all}, {30, all}, {365, all}});
+    RollingResult rolling = engine.run(amounts);
+    bool ok = rolling.series.size() == 18;
+    for (const RollingSeries& s : rolling.series) {
+        size_t w = static_cast<size_t>(s.window);
+        if (s.values.size() != amounts.size() - w + 1) {
+            ok = false;
+            break;
+        }
+        for (size_t i = 0; i < s.values.size() && ok; ++i) {
+            double epsilon = s.stat == RollingStat::Variance || s.stat == RollingStat::Stddev ? 1e-7 : 1e-9;
+            if (!approx_equal(s.values[i], direct(amounts, i, w, s.stat), epsilon)) {
+                ok = false;
+            }
+        }
+    }
+    if (ok) {
+        PASS()
+    } else {
+        FAIL("Rolling series diverge from direct computation")
+    }
+
+    // Test that the mean agrees with moving_average
+    TEST(matches_moving_average)
+    MovingAverageResult ma = StatisticsCalculator::moving_average(amounts, 30);
+    const RollingSeries* means = rolling.find(30, RollingStat::Mean);
+    ok = means && means->values.size() == ma.values.size();
+    for (size_t i = 0; ok && i < ma.values.size(); ++i) {
+        if (!approx_equal(means->values[i], ma.values[i])) ok = false;
+    }
+    if (ok) {
+        PASS()
+    } else {
+        FAIL("Rolling mean differs from moving_average")
+    }
+
+    // Test that a long run does not drift (large offset, small spread)
+    TEST(no_drift)
+    std::vector<double> offset(200000);
+    for (size_t i = 0; i < offset.size(); ++i) {
+        offset[i] = 1e6 + static_cast<double>(i % 5);
+    }
+    RollingResult drift = RollingEngine().add(5, {RollingStat::Mean, RollingStat::Variance}).run(offset);
+    const RollingSeries* tail_mean = drift.find(5, RollingStat::Mean);
+    const RollingSeries* tail_var = drift.find(5, RollingStat::Variance);
+    if (approx_equal(tail_mean->values.back(), 1e6 + 2.0, 1e-15) &&
+        std::abs(tail_var->values.back() - 2.0) < 1e-9) {
+        PASS()
+    } else {
+        FAIL("Drift detected: mean=" << tail_mean->values.back() << " var=" << tail_var->values.back())
+    }
+
+    // Test window clamping and empty input
+    TEST(clamping)
+    RollingResult clamped = RollingEngine().add(50, {RollingStat::Sum}).run(data);
+    RollingResult empty = RollingEngine().add(5, {RollingStat::Sum}).run(std::vector<double>());
+    if (clamped.series[0].effective_window == 8 && clamped.series[0].values.size() == 1 &&
+        clamped.series[0].values[0] == 31.0 && empty.series.size() == 1 &&
+        empty.series[0].values.empty()) {
+        PASS()
+    } else {
+        FAIL("Clamping incorrect: " << clamped.to_json())
+    }
+
+    // Test JSON output
+    TEST(json)
+    std::string json = RollingEngine().add(7, {RollingStat::Max}).run(data).to_json();
+    if (json == "[{\"window_size\":7,\"stat\":\"max\",\"values\":[9.00,9.00]}]") {
+        PASS()
+    } else {
+        FAIL("Unexpected JSON: " << json)
+    }
+
+    // Test invalid specs
+    TEST(invalid_specs)
+    int throws = 0;
+    try { RollingEngine().add(0, {RollingStat::Mean}); } catch (const std::invalid_argument&) { ++throws; }
+    try { RollingEngine().add(5, {}); } catch (const std::invalid_argument&) { ++throws; }
+    try { parse_rolling_stat("median"); } catch (const std::invalid_argument&) { ++throws; }
+    if (throws == 3 && parse_rolling_stat("stddev") == RollingStat::Stddev) {
+        PASS()
+    } else {
+        FAIL("Expected invalid_argument for bad specs")
+    }
+
+    // Summary
+    std::cout << "\n========================================\n";
+    std::cout << "Tests passed: " << passed << "\n";
+    std::cout << "Tests failed: " << failed << "\n";
+    std::cout << "========================================\n";
+
+    return failed > 0 ? 1 : 0;
+}
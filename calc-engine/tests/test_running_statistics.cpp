@@ -0,0 +1,138 @@
+/**
+ * Running Statistics Unit Tests
+ * 
+ * Validates the streaming accumulator against StatisticsCalculator.
+ */
+
+#include "running_statistics.hpp"
+#include "statistics.hpp"
+#include <algorithm>
+#include <iostream>
+#include <cmath>
+#include <stdexcept>
+
+using namespace expense;
+
+#define TEST(name) std::cout << "Testing: " << #name << "... "; 
+#define PASS() std::cout << "PASSED\n"; passed++;
+#define FAIL(msg) std::cout << "FAILED: " << msg << "\n"; failed++;
+
+bool nearly_equal(double a, double b, double epsilon = 0.001) {
+    return std::abs(a - b) < epsilon;
+}
+
+int main() {
+    int passed = 0;
+    int failed = 0;
+    
+    std::vector<double> data = {15.5, 85.3, 45.0, 35.0, 1500.0, 9.99, 45.0, 120.0};
+    
+    // Test push against batch statistics
+    TEST(push)
+    RunningStatistics rs;
+    for (double v : data) rs.push(v);
+    if (rs.count() == data.size() &&
+        nearly_equal(rs.sum(), StatisticsCalculator::sum(data)) &&
+        nearly_equal(rs.mean(), StatisticsCalculator::mean(data)) &&
+        nearly_equal(rs.variance(), StatisticsCalculator::variance(data)) &&
+        nearly_equal(rs.sample_variance(), StatisticsCalculator::sample_variance(data)) &&
+        rs.min() == 9.99 && rs.max() == 1500.0) {
+        PASS()
+    } else {
+        FAIL("Streaming statistics differ from batch")
+    }
+    
+    // Test merge of two halves
+    TEST(merge)
+    RunningStatistics left, right;
+    for (size_t i = 0; i < data.size(); ++i) {
+        (i < 3 ? left : right).push(data[i]);
+    }
+    left.merge(right);
+    if (left.count() == rs.count() &&
+        nearly_equal(left.mean(), rs.mean()) &&
+        nearly_equal(left.variance(), rs.variance()) &&
+        left.min() == rs.min() && left.max() == rs.max()) {
+        PASS()
+    } else {
+        FAIL("Merged accumulator differs from sequential")
+    }
+    
+    // Test remove restores the earlier state
+    TEST(remove)
+    RunningStatistics removed = rs;
+    removed.remove(45.0);
+    removed.remove(120.0);
+    std::vector<double> rest = {15.5, 85.3, 35.0, 1500.0, 9.99, 45.0};
+    if (removed.count() == rest.size() &&
+        nearly_equal(removed.mean(), StatisticsCalculator::mean(rest)) &&
+        nearly_equal(removed.variance(), StatisticsCalculator::variance(rest)) &&
+        removed.extrema_exact()) {
+        PASS()
+    } else {
+        FAIL("Removal did not invert push")
+    }
+    
+    // Test removing the only max marks extrema stale
+    TEST(remove_extreme)
+    removed.remove(1500.0);
+    if (!removed.extrema_exact()) {
+        PASS()
+    } else {
+        FAIL("Removing the last max should invalidate extrema")
+    }
+    
+    // Test removing a stale extreme again leaves its count at zero
+    TEST(remove_stale_extreme)
+    RunningStatistics stale;
+    stale.push(1.0);
+    stale.push(5.0);
+    stale.push(5.0);
+    stale.remove(1.0);
+    stale.remove(1.0);
+    std::vector<uint8_t> stale_blob = stale.serialize();
+    // min_count is the u64 after the 4-byte header and count
+    if (!stale.extrema_exact() &&
+        std::all_of(stale_blob.begin() + 12, stale_blob.begin() + 20, [](uint8_t b) { return b == 0; })) {
+        PASS()
+    } else {
+        FAIL("Stale extreme count wrapped around")
+    }
+    
+    // Test serialization round trip
+    TEST(serialize_roundtrip)
+    std::vector<uint8_t> blob = rs.serialize();
+    RunningStatistics restored = RunningStatistics::deserialize(blob);
+    if (blob.size() == RunningStatistics::SERIALIZED_SIZE &&
+        restored.count() == rs.count() &&
+        restored.mean() == rs.mean() &&
+        restored.variance() == rs.variance() &&
+        restored.min() == rs.min() && restored.max() == rs.max()) {
+        PASS()
+    } else {
+        FAIL("Deserialized accumulator differs")
+    }
+    
+    // Test malformed blob is rejected
+    TEST(deserialize_invalid)
+    bool threw = false;
+    try {
+        blob[0] = 'X';
+        RunningStatistics::deserialize(blob);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    if (threw) {
+        PASS()
+    } else {
+        FAIL("Malformed blob was accepted")
+    }
+    
+    // Summary
+    std::cout << "\n========================================\n";
+    std::cout << "Tests passed: " << passed << "\n";
+    std::cout << "Tests failed: " << failed << "\n";
+    std::cout << "========================================\n";
+    
+    return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,117 @@
+/**
+ * Segmented Statistics Unit Tests
+ *
+ * Validates per-segment results against calculate_all, the field-major
+ * layout, thread-count independence and the C API.
+ */
+
+#include "segmented_stats.hpp"
+#include "thread_pool.hpp"
+#include "expense_c_api.h"
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace expense;
+
+#define TEST(name) std::cout << "Testing: " << #name << "... ";
+#define PASS() std::cout << "PASSED\n"; passed++;
+#define FAIL(msg) std::cout << "FAILED: " << msg << "\n"; failed++;
+
+int main() {
+    int passed = 0;
+    int failed = 0;
+
+    // Ragged users: mostly small, a few large, some empty
+    std::mt19937_64 rng(11);
+    std::lognormal_distribution<double> amount(4.0, 1.0);
+    std::geometric_distribution<size_t> size(0.02);
+    std::vector<double> amounts;
+    std::vector<size_t> offsets = {0};
+    for (int user = 0; user < 3000; ++user) {
+        size_t count = user % 97 == 0 ? 20000 : size(rng);
+        for (size_t k = 0; k < count; ++k) {
+            amounts.push_back(std::round(amount(rng) * 100.0) / 100.0);
+        }
+        offsets.push_back(amounts.size());
+    }
+
+    ThreadPool four(4);
+    SegmentedStats batch = calculate_segmented(amounts, offsets, &four);
+
+    // Test every segment against calculate_all on that segment alone
+    TEST(matches_calculate_all)
+    bool ok = batch.segments == 3000 &&
+              batch.values.size() == 3000 * StatisticsResult::FIELD_COUNT;
+    double expected[StatisticsResult::FIELD_COUNT];
+    double actual[StatisticsResult::FIELD_COUNT];
+    for (size_t s = 0; ok && s < batch.segments; ++s) {
+        StatisticsCalculator::calculate_all(amounts.data() + offsets[s], offsets[s + 1] - offsets[s])
+            .to_array(expected);
+        batch.at(s).to_array(actual);
+        ok = std::memcmp(expected, actual, sizeof(expected)) == 0;
+    }
+    if (ok) {
+        PASS()
+    } else {
+        FAIL("Segment statistics differ from calculate_all")
+    }
+
+    // Test the field-major layout and empty segments
+    TEST(field_major_layout)
+    std::vector<double> small = {1.0, 2.0, 3.0, 10.0};
+    std::vector<size_t> small_offsets = {0, 3, 3, 4};
+    SegmentedStats three = calculate_segmented(small, small_offsets);
+    const double* sums = three.field(0);
+    const double* counts = three.field(StatisticsResult::FIELD_COUNT - 1);
+    if (three.segments == 3 && sums[0] == 6.0 && sums[1] == 0.0 && sums[2] == 10.0 &&
+        counts[0] == 3.0 && counts[1] == 0.0 && three.at(0).median == 2.0) {
+        PASS()
+    } else {
+        FAIL("Unexpected layout: " << three.to_json())
+    }
+
+    // Test that results do not depend on the thread count
+    TEST(thread_count_independent)
+    ThreadPool one(1);
+    SegmentedStats serial = calculate_segmented(amounts, offsets, &one);
+    if (serial.values == batch.values) {
+        PASS()
+    } else {
+        FAIL("Serial and parallel results differ")
+    }
+
+    // Test offset validation
+    TEST(invalid_offsets)
+    int throws = 0;
+    try { calculate_segmented(small, {0, 3, 2}); } catch (const std::invalid_argument&) { ++throws; }
+    try { calculate_segmented(small, {0, 5}); } catch (const std::invalid_argument&) { ++throws; }
+    if (throws == 2 && calculate_segmented(small, {0}).segments == 0) {
+        PASS()
+    } else {
+        FAIL("Expected invalid_argument for bad offsets")
+    }
+
+    // Test the C API buffer contract
+    TEST(c_api)
+    std::vector<double> out(3 * EXPENSE_STATS_FIELDS);
+    int short_buffer = expense_calculate_segmented(small.data(), small.size(), small_offsets.data(),
+                                                   small_offsets.size(), out.data(), out.size() - 1);
+    int status = expense_calculate_segmented(small.data(), small.size(), small_offsets.data(),
+                                             small_offsets.size(), out.data(), out.size());
+    if (short_buffer == EXPENSE_ERR_BUFFER && status == EXPENSE_OK && out == three.values) {
+        PASS()
+    } else {
+        FAIL("C API result incorrect")
+    }
+
+    // Summary
+    std::cout << "\n========================================\n";
+    std::cout << "Tests passed: " << passed << "\n";
+    std::cout << "Tests failed: " << failed << "\n";
+    std::cout << "========================================\n";
+
+    return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,124 @@
+/**
+ * SIMD Kernel Unit Tests
+ * 
+ * Every supported instruction set must match the scalar kernels bit for
+ * bit, and the scalar kernels must match a naive loop within tolerance.
+ */
+
+#include "simd_kernels.hpp"
+#include <iostream>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace expense;
+
+#define TEST(name) std::cout << "Testing: " << #name << "... "; 
+#define PASS() std::cout << "PASSED\n"; passed++;
+#define FAIL(msg) std::cout << "FAILED: " << msg << "\n"; failed++;
+
+bool nearly_equal(double a, double b, double epsilon = 1e-6) {
+    return std::abs(a - b) <= epsilon * std::max(1.0, std::abs(b));
+}
+
+int main() {
+    int passed = 0;
+    int failed = 0;
+    
+    std::mt19937_64 rng(7);
+    std::lognormal_distribution<double> dist(4.0, 1.2);
+    
+    // Sizes straddling the 16-lane block boundary
+    const std::vector<size_t> sizes = {1, 2, 15, 16, 17, 31, 100, 1027, 65543};
+    const kernels::Isa all_isas[] = {
+        kernels::Isa::Scalar, kernels::Isa::SSE2, kernels::Isa::AVX2, kernels::Isa::AVX512
+    };
+    
+    std::cout << "Detected ISA: " << kernels::isa_name(kernels::detect_isa()) << "\n";
+    
+    // Test scalar kernels against naive loops
+    TEST(scalar_vs_naive)
+    const kernels::KernelTable& scalar = kernels::table(kernels::Isa::Scalar);
+    bool naive_ok = true;
+    for (size_t n : sizes) {
+        std::vector<double> x(n), y(n);
+        for (size_t i = 0; i < n; ++i) { x[i] = dist(rng); y[i] = dist(rng); }
+        
+        double s = 0, sq = 0, d = 0, mn = x[0], mx = x[0];
+        for (size_t i = 0; i < n; ++i) {
+            s += x[i];
+            sq += (x[i] - 50.0) * (x[i] - 50.0);
+            d += x[i] * y[i];
+            mn = std::min(mn, x[i]);
+            mx = std::max(mx, x[i]);
+        }
+        double kmn, kmx;
+        scalar.min_max(x.data(), n, &kmn, &kmx);
+        naive_ok = naive_ok &&
+            nearly_equal(scalar.sum(x.data(), n), s) &&
+            nearly_equal(scalar.sum_sq_dev(x.data(), n, 50.0), sq) &&
+            nearly_equal(scalar.dot(x.data(), y.data(), n), d) &&
+            kmn == mn && kmx == mx;
+    }
+    if (naive_ok) {
+        PASS()
+    } else {
+        FAIL("Scalar kernels disagree with naive loops")
+    }
+    
+    // Test every supported ISA is bit-identical to scalar
+    for (kernels::Isa isa : all_isas) {
+        std::cout << "Testing: bit_identical_" << kernels::isa_name(isa) << "... ";
+        if (!kernels::isa_supported(isa)) {
+            std::cout << "SKIPPED (not supported)\n";
+            continue;
+        }
+        
+        const kernels::KernelTable& t = kernels::table(isa);
+        bool identical = true;
+        for (size_t n : sizes) {
+            std::vector<double> x(n), y(n);
+            for (size_t i = 0; i < n; ++i) { x[i] = dist(rng); y[i] = dist(rng); }
+            
+            double a_mn, a_mx, b_mn, b_mx;
+            t.min_max(x.data(), n, &a_mn, &a_mx);
+            scalar.min_max(x.data(), n, &b_mn, &b_mx);
+            
+            // Anchors as summation::Binned picks them for |x| < 2^16, n < 2^17
+            const double sigma[kernels::BINNED_FOLDS] = {
+                std::ldexp(3.0, 33), std::ldexp(3.0, -2), std::ldexp(3.0, -37)
+            };
+            double a_bins[kernels::BINNED_FOLDS], b_bins[kernels::BINNED_FOLDS];
+            t.binned_sum(x.data(), n, sigma, a_bins);
+            scalar.binned_sum(x.data(), n, sigma, b_bins);
+            
+            double a_xx, a_yy, a_xy, b_xx, b_yy, b_xy;
+            t.co_moments(x.data(), y.data(), n, 40.0, 60.0, &a_xx, &a_yy, &a_xy);
+            scalar.co_moments(x.data(), y.data(), n, 40.0, 60.0, &b_xx, &b_yy, &b_xy);
+            
+            identical = identical &&
+                t.sum(x.data(), n) == scalar.sum(x.data(), n) &&
+                t.sum_sq_dev(x.data(), n, 33.0) == scalar.sum_sq_dev(x.data(), n, 33.0) &&
+                t.dot(x.data(), y.data(), n) == scalar.dot(x.data(), y.data(), n) &&
+                a_mn == b_mn && a_mx == b_mx &&
+                a_xx == b_xx && a_yy == b_yy && a_xy == b_xy &&
+                t.compensated_sum(x.data(), n) == scalar.compensated_sum(x.data(), n) &&
+                t.compensated_sum_sq_dev(x.data(), n, 33.0) ==
+                    scalar.compensated_sum_sq_dev(x.data(), n, 33.0) &&
+                a_bins[0] == b_bins[0] && a_bins[1] == b_bins[1] && a_bins[2] == b_bins[2];
+        }
+        if (identical) {
+            PASS()
+        } else {
+            FAIL("Results differ from scalar kernels")
+        }
+    }
+    
+    // Summary
+    std::cout << "\n========================================\n";
+    std::cout << "Tests passed: " << passed << "\n";
+    std::cout << "Tests failed: " << failed << "\n";
+    std::cout << "========================================\n";
+    
+    return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,156 @@
+/**
+ * Snapshot Format Unit Tests
+ *
+ * Validates round trips across chunk boundaries, footer statistics,
+ * zero-copy amount columns and rejection of truncated or corrupt files.
+ */
+
+#include "snapshot.hpp"
+#include "table_compare.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+using namespace expense;
+
+#define TEST(name) std::cout << "Testing: " << #name << "... ";
+#define PASS() std::cout << "PASSED\n"; passed++;
+#define FAIL(msg) std::cout << "FAILED: " << msg << "\n"; failed++;
+
+namespace {
+
+/**
+ * Unsorted dates, 300 merchants (9-bit ids), two payment methods.
+ */
+ExpenseTable make_table(size_t rows) {
+    ExpenseTable table;
+    const char* methods[] = {"UPI", "Card"};
+    for (size_t i = 0; i < rows; ++i) {
+        table.append(static_cast<double>(i % 977) + 0.25 * static_cast<double>(i % 4),
+                     days_from_civil(2024, 1, 1) + static_cast<int32_t>((i * 37) % 400) - 30,
+                     static_cast<Category>(i % CATEGORY_COUNT),
+                     "merchant-" + std::to_string(i % 300), methods[i % 7 == 0],
+                     i % 5 == 0);
+    }
+    return table;
+}
+
+/**
+ * Message of the exception thrown when opening and decoding bytes, or "".
+ */
+std::string open_error(const std::string& bytes) {
+    try {
+        SnapshotReader(bytes.data(), bytes.size()).read();
+    } catch (const std::exception& e) {
+        return e.what();
+    }
+    return "";
+}
+
+} // namespace
+
+int main() {
+    int passed = 0;
+    int failed = 0;
+
+    // Test a round trip across several chunks, including a partial last one
+    TEST(round_trip)
+    ExpenseTable table = make_table(2500);
+    std::string bytes = encode_snapshot(table, 1000);
+    SnapshotReader reader(bytes.data(), bytes.size());
+    ExpenseTable middle = reader.read(1, 2);
+    if (reader.rows() == 2500 && reader.chunk_count() == 3 && reader.chunk(2).rows == 500 &&
+        same_tables(reader.read(), table) && middle.size() == 1000 &&
+        middle.row(0).amount == table.row(1000).amount &&
+        reader.merchants().size() == 300 && bytes.size() < table.size() * 14) {
+        PASS()
+    } else {
+        FAIL("Round trip mismatch (" << bytes.size() << " bytes)")
+    }
+
+    // Test footer statistics against a full scan
+    TEST(footer_statistics)
+    SnapshotChunk total = reader.summary();
+    int64_t sum = 0;
+    int64_t amount_max = 0;
+    int32_t date_min = table.dates()[0];
+    for (size_t i = 0; i < table.size(); ++i) {
+        int64_t paise = static_cast<int64_t>(table.amounts()[i] * 100.0);
+        sum += paise;
+        amount_max = std::max(amount_max, paise);
+        date_min = std::min(date_min, table.dates()[i]);
+    }
+    std::vector<int64_t> scratch;
+    ColumnView<int64_t> first_paise = reader.amount_paise(0, scratch);
+    int64_t chunk_sum = 0;
+    for (int64_t paise : first_paise) chunk_sum += paise;
+    if (total.rows == 2500 && total.amount_sum == sum && total.amount_min == 0 &&
+        total.amount_max == amount_max && total.date_min == date_min &&
+        chunk_sum == reader.chunk(0).amount_sum && first_paise.size == 1000) {
+        PASS()
+    } else {
+        FAIL("Footer sum " << total.amount_sum << " vs " << sum)
+    }
+
+    // Test that a mapped file serves amounts in place and sub-paisa rounding
+    TEST(mapped_file_zero_copy)
+    ExpenseTable small;
+    small.append(10.004, 19000, Category::Food, "Cafe", "UPI");
+    small.append(-2.5, 19001, Category::Rent, "Cafe", "UPI", true);
+    const std::string path = "test_snapshot.tmp";
+    write_snapshot(small, path);
+    bool in_place = false;
+    ExpenseTable loaded;
+    {
+        SnapshotReader file(path);
+        ColumnView<int64_t> paise = file.amount_paise(0, scratch);
+        in_place = paise.data != scratch.data() && paise[0] == 1000 && paise[1] == -250;
+        loaded = file.read();
+    }
+    std::remove(path.c_str());
+    if (in_place && loaded.size() == 2 && loaded.row(0).amount == 10.0 &&
+        loaded.row(1).amount == -2.5 && loaded.row(1).recurring) {
+        PASS()
+    } else {
+        FAIL("Mapped read incorrect")
+    }
+
+    // Test empty tables, bad input tables and corrupt files
+    TEST(rejects_invalid)
+    std::string empty = encode_snapshot(ExpenseTable());
+    bool ok = SnapshotReader(empty.data(), empty.size()).read().empty();
+    ExpenseTable huge;
+    huge.append(1e14, 0, Category::Other, "", "");
+    try {
+        encode_snapshot(huge);
+        ok = false;
+    } catch (const std::invalid_argument&) {
+    }
+    std::string truncated = bytes.substr(0, bytes.size() - 1);
+    std::string wrong_version = bytes;
+    wrong_version[8] = 9;
+    // Shrink chunk 0's encoded column size in the directory by one byte
+    std::string short_chunk = bytes;
+    size_t directory = static_cast<unsigned char>(bytes[bytes.size() - 16]) |
+                       static_cast<size_t>(static_cast<unsigned char>(bytes[bytes.size() - 15])) << 8;
+    short_chunk[directory + 8] = static_cast<char>(short_chunk[directory + 8] - 1);
+    ok = ok && open_error("plain text").find("Not an expense snapshot") != std::string::npos;
+    ok = ok && open_error(truncated).find("Corrupt snapshot") != std::string::npos;
+    ok = ok && open_error(wrong_version).find("version 9") != std::string::npos;
+    ok = ok && open_error(short_chunk).find("overruns") != std::string::npos;
+    if (ok) {
+        PASS()
+    } else {
+        FAIL("Invalid input accepted")
+    }
+
+    // Summary
+    std::cout << "\n========================================\n";
+    std::cout << "Tests passed: " << passed << "\n";
+    std::cout << "Tests failed: " << failed << "\n";
+    std::cout << "========================================\n";
+
+    return failed > 0 ? 1 : 0;
+}
@@ -99,6 +99,21 @@ int main() {
         FAIL("Expected 20, got " + std::to_string(p25))
     }
     
+    // Test multi-quantile selection matches single percentile calls
+    TEST(quantiles_multi)
+    std::vector<double> spread = {42.0, 7.5, 1500.0, 15.0, 99.99, 15.0, 300.0, 8.25, 61.0, 120.0, 33.3};
+    std::vector<double> levels = {99, 0, 50, 25, 90, 100, 95, 75};
+    std::vector<double> qs = StatisticsCalculator::quantiles(spread, levels);
+    bool quantiles_ok = qs.size() == levels.size();
+    for (size_t i = 0; quantiles_ok && i < levels.size(); ++i) {
+        quantiles_ok = qs[i] == StatisticsCalculator::percentile(spread, levels[i]);
+    }
+    if (quantiles_ok && nearly_equal(qs[2], 42.0) && nearly_equal(qs[1], 7.5)) {
+        PASS()
+    } else {
+        FAIL("quantiles() disagrees with percentile()")
+    }
+    
     // Test moving average
     TEST(moving_average)
     MovingAverageResult ma = StatisticsCalculator::moving_average(data, 3);
@@ -142,6 +157,22 @@ int main() {
         FAIL("Comprehensive stats calculation incorrect")
     }
     
+    // Test fused calculate_all against the individual functions
+    TEST(calculate_all_fused)
+    std::vector<double> mixed = {120.5, 15.0, 15.0, 1500.0, 42.25, 15.0, 9.99, 42.25, 300.0, 75.0};
+    StatisticsResult fused = StatisticsCalculator::calculate_all(mixed);
+    if (nearly_equal(fused.sum, StatisticsCalculator::sum(mixed)) &&
+        nearly_equal(fused.median, StatisticsCalculator::median(mixed)) &&
+        nearly_equal(fused.variance, StatisticsCalculator::variance(mixed)) &&
+        nearly_equal(fused.q1, StatisticsCalculator::percentile(mixed, 25)) &&
+        nearly_equal(fused.q3, StatisticsCalculator::percentile(mixed, 75)) &&
+        nearly_equal(fused.mode, 15.0) &&
+        nearly_equal(fused.min, 9.99) && nearly_equal(fused.max, 1500.0)) {
+        PASS()
+    } else {
+        FAIL("Fused statistics differ from individual calculations")
+    }
+    
     // Test correlation
     TEST(correlation_positive)
     std::vector<double> x = {1, 2, 3, 4, 5};
@@ -162,6 +193,57 @@ int main() {
         FAIL("JSON output format incorrect")
     }
     
+    // Test binary layouts
+    TEST(binary_layout)
+    double stat_fields[StatisticsResult::FIELD_COUNT];
+    stats.to_array(stat_fields);
+    double corr_fields[CorrelationResult::FIELD_COUNT];
+    corr.to_array(corr_fields);
+    if (stat_fields[0] == stats.sum && stat_fields[2] == stats.median &&
+        stat_fields[11] == stats.iqr && stat_fields[12] == 5.0 &&
+        corr_fields[0] == corr.pearson_coefficient &&
+        CorrelationResult::STRENGTH_NAMES[static_cast<int>(corr_fields[2])] == corr.strength &&
+        CorrelationResult::DIRECTION_NAMES[static_cast<int>(corr_fields[3])] == corr.direction) {
+        PASS()
+    } else {
+        FAIL("Binary layout does not match result fields")
+    }
+    
+    // Test rolling median resists a one-off large expense
+    TEST(rolling_median)
+    std::vector<double> spiky = {100, 120, 15000, 110, 90, 130, 105};
+    MovingAverageResult rm = StatisticsCalculator::rolling_median(spiky, 3);
+    if (rm.values.size() == 5 && rm.window_size == 3 &&
+        rm.values[0] == 120 && rm.values[1] == 120 && rm.values[2] == 110 &&
+        rm.values[3] == 110 && rm.values[4] == 105 && rm.current_average == 105) {
+        PASS()
+    } else {
+        FAIL("Rolling median incorrect")
+    }
+    
+    // Test rolling percentile against per-window percentile()
+    TEST(rolling_quantile)
+    std::vector<double> series;
+    for (int i = 0; i < 400; ++i) {
+        series.push_back(static_cast<double>((i * 37) % 101) + (i % 3) * 0.25);
+    }
+    bool rolling_ok = true;
+    for (int w : {12, 150}) {   // sorted-buffer and multiset paths
+        for (double p : {0.0, 10.0, 50.0, 90.0, 100.0}) {
+            MovingAverageResult rq = StatisticsCalculator::rolling_quantile(series, w, p);
+            rolling_ok = rolling_ok && rq.values.size() == series.size() - w + 1;
+            for (size_t i = 0; rolling_ok && i < rq.values.size(); ++i) {
+                std::vector<double> window(series.begin() + i, series.begin() + i + w);
+                rolling_ok = nearly_equal(rq.values[i], StatisticsCalculator::percentile(window, p), 1e-9);
+            }
+        }
+    }
+    if (rolling_ok) {
+        PASS()
+    } else {
+        FAIL("Rolling quantile differs from per-window percentile")
+    }
+    
     // Summary
     std::cout << "\n========================================\n";
     std::cout << "Tests passed: " << passed << "\n";
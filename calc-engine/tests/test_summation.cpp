@@ -0,0 +1,171 @@
+/**
+ * Summation Policy Unit Tests
+ *
+ * Validates accuracy on ill-conditioned sums, order independence of the
+ * binned policy and the StatisticsCalculator policy templates.
+ */
+
+#include "statistics.hpp"
+#include "summation.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace expense;
+
+#define TEST(name) std::cout << "Testing: " << #name << "... ";
+#define PASS() std::cout << "PASSED\n"; passed++;
+#define FAIL(msg) std::cout << "FAILED: " << msg << "\n"; failed++;
+
+namespace {
+
+/**
+ * Small exact amounts hidden under +big/-big pairs; exact_sum is known.
+ */
+std::vector<double> make_cancelling(size_t pairs, std::mt19937_64& rng, double* exact_sum) {
+    std::uniform_int_distribution<int64_t> small(1, int64_t(1) << 20);
+    std::uniform_int_distribution<int64_t> big(int64_t(1) << 30, int64_t(1) << 40);
+    std::vector<double> out;
+    int64_t scaled_total = 0;
+    for (size_t i = 0; i < pairs; ++i) {
+        int64_t s = small(rng);
+        double b = static_cast<double>(big(rng));
+        scaled_total += s;
+        out.push_back(b + static_cast<double>(s) / 128.0);
+        out.push_back(-b);
+    }
+    std::shuffle(out.begin(), out.end(), rng);
+    *exact_sum = static_cast<double>(scaled_total) / 128.0;
+    return out;
+}
+
+} // namespace
+
+int main() {
+    int passed = 0;
+    int failed = 0;
+
+    std::mt19937_64 rng(5);
+    double exact = 0.0;
+    std::vector<double> cancelling = make_cancelling(50001, rng, &exact);
+    const double* c = cancelling.data();
+    const size_t cn = cancelling.size();
+
+    // Test that compensated policies recover the exact sum
+    TEST(ill_conditioned_accuracy)
+    double naive_err = std::abs(summation::Naive::sum(c, cn) - exact);
+    double pairwise_err = std::abs(summation::Pairwise::sum(c, cn) - exact);
+    if (summation::Binned::sum(c, cn) == exact &&
+        summation::Neumaier::sum(c, cn) == exact &&
+        pairwise_err <= naive_err && naive_err > 0.0) {
+        PASS()
+    } else {
+        FAIL("naive err " << naive_err << ", pairwise err " << pairwise_err)
+    }
+
+    // Test that Binned gives bit-identical results in any order
+    TEST(binned_order_independent)
+    std::lognormal_distribution<double> dist(4.0, 1.5);
+    std::vector<double> amounts(100003);
+    for (double& v : amounts) v = std::round(dist(rng) * 100.0) / 100.0;
+    double forward = summation::Binned::sum(amounts.data(), amounts.size());
+    double forward_sq = summation::Binned::sum_sq_dev(amounts.data(), amounts.size(), 75.0);
+    bool same = true;
+    for (int trial = 0; trial < 3; ++trial) {
+        std::shuffle(amounts.begin(), amounts.end(), rng);
+        same = same && summation::Binned::sum(amounts.data(), amounts.size()) == forward &&
+               summation::Binned::sum_sq_dev(amounts.data(), amounts.size(), 75.0) == forward_sq;
+    }
+    // And once more reversed
+    std::reverse(amounts.begin(), amounts.end());
+    if (same && summation::Binned::sum(amounts.data(), amounts.size()) == forward) {
+        PASS()
+    } else {
+        FAIL("Binned sum depends on element order")
+    }
+
+    // Test every policy on small exact inputs and tails of every length
+    TEST(exact_small_inputs)
+    bool exact_ok = true;
+    for (size_t n = 0; n <= 40; ++n) {
+        std::vector<double> ints(n);
+        for (size_t i = 0; i < n; ++i) ints[i] = static_cast<double>(i + 1);
+        double expected = static_cast<double>(n * (n + 1) / 2);
+        exact_ok = exact_ok &&
+            summation::Naive::sum(ints.data(), n) == expected &&
+            summation::Pairwise::sum(ints.data(), n) == expected &&
+            summation::Neumaier::sum(ints.data(), n) == expected &&
+            summation::Binned::sum(ints.data(), n) == expected;
+    }
+    std::vector<double> big(1000, 3.0);
+    if (exact_ok && summation::Pairwise::sum(big.data(), big.size()) == 3000.0 &&
+        summation::Binned::sum_sq_dev(big.data(), big.size(), 1.0) == 4000.0 &&
+        summation::Neumaier::sum_sq_dev(big.data(), big.size(), 1.0) == 4000.0) {
+        PASS()
+    } else {
+        FAIL("Policies disagree on exact inputs")
+    }
+
+    // Test non-finite inputs and all-zero data
+    TEST(special_values)
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<double> with_inf = {1.0, inf, 2.0};
+    std::vector<double> with_nan = {1.0, std::nan(""), 2.0};
+    std::vector<double> zeros(20, 0.0);
+    std::vector<double> huge = {1e308, 1e308, -1e308};
+    if (summation::Binned::sum(with_inf.data(), 3) == inf &&
+        std::isnan(summation::Binned::sum(with_nan.data(), 3)) &&
+        std::isnan(summation::Neumaier::sum(with_nan.data(), 3)) &&
+        summation::Binned::sum(zeros.data(), zeros.size()) == 0.0 &&
+        summation::Binned::sum(huge.data(), 3) == 1e308) {
+        PASS()
+    } else {
+        FAIL("Special values mishandled")
+    }
+
+    // Test the StatisticsCalculator policy templates
+    TEST(calculator_templates)
+    std::vector<double> shifted(10000);
+    for (size_t i = 0; i < shifted.size(); ++i) {
+        shifted[i] = 1e9 + static_cast<double>(i % 7);
+    }
+    double ref_var = 0.0;
+    {
+        // Exact population variance of i % 7 over 10000 values
+        double s = 0.0;
+        double sq = 0.0;
+        for (size_t i = 0; i < shifted.size(); ++i) {
+            double v = static_cast<double>(i % 7);
+            s += v;
+            sq += v * v;
+        }
+        double m = s / shifted.size();
+        ref_var = sq / shifted.size() - m * m;
+    }
+    StatisticsResult plain = StatisticsCalculator::calculate_all(shifted);
+    StatisticsResult binned = StatisticsCalculator::calculate_all<summation::Binned>(shifted);
+    double var_neumaier = StatisticsCalculator::variance<summation::Neumaier>(shifted);
+    if (binned.median == plain.median && binned.count == plain.count &&
+        std::abs(binned.variance - ref_var) < 1e-6 &&
+        std::abs(var_neumaier - ref_var) < 1e-6 &&
+        StatisticsCalculator::sum<summation::Pairwise>(shifted) ==
+            StatisticsCalculator::sum<summation::Binned>(shifted) &&
+        StatisticsCalculator::mean<summation::Neumaier>(std::vector<double>()) == 0.0 &&
+        StatisticsCalculator::stddev<summation::Binned>(std::vector<double>({5.0})) == 0.0) {
+        PASS()
+    } else {
+        FAIL("Template overloads incorrect (variance " << binned.variance << " vs " << ref_var << ")")
+    }
+
+    // Summary
+    std::cout << "\n========================================\n";
+    std::cout << "Tests passed: " << passed << "\n";
+    std::cout << "Tests failed: " << failed << "\n";
+    std::cout << "========================================\n";
+
+    return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,123 @@
+/**
+ * Thread Pool Unit Tests
+ *
+ * Validates coverage, skewed workloads, nesting, error propagation and
+ * CPU pinning.
+ */
+
+#include "thread_pool.hpp"
+#include <atomic>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace expense;
+
+#define TEST(name) std::cout << "Testing: " << #name << "... ";
+#define PASS() std::cout << "PASSED\n"; passed++;
+#define FAIL(msg) std::cout << "FAILED: " << msg << "\n"; failed++;
+
+int main() {
+    int passed = 0;
+    int failed = 0;
+
+    ThreadPool pool(4);
+
+    // Test that every index runs exactly once
+    TEST(covers_each_index_once)
+    std::vector<std::atomic<int>> hits(10007);
+    pool.parallel_for(hits.size(), [&](size_t i) { hits[i].fetch_add(1); });
+    bool once = pool.size() == 4;
+    for (const auto& h : hits) once = once && h.load() == 1;
+    if (once) {
+        PASS()
+    } else {
+        FAIL("Indices skipped or repeated")
+    }
+
+    // Test a skewed workload and repeated submissions on one pool
+    TEST(skewed_and_repeated)
+    bool ok = true;
+    for (int round = 0; round < 50 && ok; ++round) {
+        std::vector<double> out(257, 0.0);
+        pool.parallel_for(out.size(), [&](size_t i) {
+            size_t work = i == 0 ? 200000 : 10;
+            double acc = 0.0;
+            for (size_t k = 0; k < work; ++k) acc += 1.0;
+            out[i] = acc;
+        });
+        ok = out[0] == 200000.0 && out[256] == 10.0;
+    }
+    if (ok) {
+        PASS()
+    } else {
+        FAIL("Skewed results incorrect")
+    }
+
+    // Test that nested calls run inline instead of deadlocking
+    TEST(nested_inline)
+    std::atomic<int> inner{0};
+    pool.parallel_for(8, [&](size_t) {
+        pool.parallel_for(10, [&](size_t) { inner.fetch_add(1); });
+    });
+    if (inner.load() == 80) {
+        PASS()
+    } else {
+        FAIL("Nested count " << inner.load())
+    }
+
+    // Test that the first exception reaches the caller and the pool survives
+    TEST(exception_propagates)
+    std::string message;
+    try {
+        pool.parallel_for(1000, [](size_t i) {
+            if (i == 500) throw std::runtime_error("task 500");
+        });
+    } catch (const std::runtime_error& e) {
+        message = e.what();
+    }
+    std::atomic<int> after{0};
+    pool.parallel_for(100, [&](size_t) { after.fetch_add(1); });
+    if (message == "task 500" && after.load() == 100) {
+        PASS()
+    } else {
+        FAIL("Exception not propagated: '" << message << "'")
+    }
+
+    // Test the single-thread pool and empty ranges
+    TEST(single_thread)
+    ThreadPool serial(1);
+    int total = 0;
+    serial.parallel_for(100, [&](size_t i) { total += static_cast<int>(i); });
+    serial.parallel_for(0, [&](size_t) { total = -1; });
+    if (serial.size() == 1 && total == 4950) {
+        PASS()
+    } else {
+        FAIL("Serial pool total " << total)
+    }
+
+    // Test pinned workers: best effort, but never more than the workers
+    TEST(pinned_workers)
+    ThreadPoolOptions options;
+    options.threads = 3;
+    options.pin_threads = true;
+    options.cpus = {0};
+    ThreadPool pinned(options);
+    std::atomic<int> sum{0};
+    pinned.parallel_for(1000, [&](size_t i) { sum += static_cast<int>(i); });
+    if (pinned.size() == 3 && pinned.pinned() <= 2 && sum.load() == 499500 &&
+        ThreadPool(2).pinned() == 0) {
+        PASS()
+    } else {
+        FAIL("Pinned pool size " << pinned.size() << ", pinned " << pinned.pinned())
+    }
+
+    // Summary
+    std::cout << "\n========================================\n";
+    std::cout << "Tests passed: " << passed << "\n";
+    std::cout << "Tests failed: " << failed << "\n";
+    std::cout << "========================================\n";
+
+    return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,164 @@
+/**
+ * Zone Map Unit Tests
+ *
+ * Validates range totals and row selection against a brute-force scan,
+ * and that sorted tables only scan the boundary zones.
+ */
+
+#include "zone_map.hpp"
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+
+using namespace expense;
+
+#define TEST(name) std::cout << "Testing: " << #name << "... ";
+#define PASS() std::cout << "PASSED\n"; passed++;
+#define FAIL(msg) std::cout << "FAILED: " << msg << "\n"; failed++;
+
+namespace {
+
+/**
+ * About 8 expenses a day over three years, with paise amounts.
+ */
+ExpenseTable make_table(size_t rows, bool sorted, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> day(0, 1095);
+    std::uniform_int_distribution<int> paise(100, 500000);
+    ExpenseTable table;
+    for (size_t i = 0; i < rows; ++i) {
+        int32_t date = sorted ? static_cast<int32_t>(i / 8) : day(rng);
+        table.append(paise(rng) / 100.0, 19000 + date, Category::Food, "", "");
+    }
+    return table;
+}
+
+RangeTotal brute_force(const ExpenseTable& table, const RangeQuery& query) {
+    RangeTotal result;
+    for (size_t i = 0; i < table.size(); ++i) {
+        ExpenseRecord row = table.row(i);
+        Money amount = Money::from_double(row.amount);
+        if (row.date >= query.date_from && row.date <= query.date_to &&
+            (std::isinf(query.amount_min) || amount >= Money::from_double(query.amount_min)) &&
+            (std::isinf(query.amount_max) || amount <= Money::from_double(query.amount_max))) {
+            result.total += amount;
+            ++result.count;
+        }
+    }
+    return result;
+}
+
+/**
+ * Random date range, optionally with an amount range.
+ */
+RangeQuery random_query(std::mt19937& rng, bool amounts) {
+    std::uniform_int_distribution<int> day(-30, 1130);
+    std::uniform_int_distribution<int> rupees(0, 6000);
+    RangeQuery query;
+    int a = day(rng);
+    int b = day(rng);
+    query.date_from = 19000 + std::min(a, b);
+    query.date_to = 19000 + std::max(a, b);
+    query.amount_min = amounts ? rupees(rng) : -1e9;
+    query.amount_max = amounts ? query.amount_min + rupees(rng) : 1e9;
+    return query;
+}
+
+} // namespace
+
+int main() {
+    int passed = 0;
+    int failed = 0;
+
+    // Test date-range totals on a sorted table against a full scan
+    TEST(sorted_range_totals)
+    ExpenseTable sorted = make_table(9000, true, 1);
+    ZoneMap sorted_zones(sorted, 256);
+    std::mt19937 rng(7);
+    bool ok = sorted_zones.sorted_by_date() && sorted_zones.zones().size() == 36;
+    size_t max_scanned = 0;
+    for (int q = 0; q < 300 && ok; ++q) {
+        RangeQuery query = random_query(rng, false);
+        RangeTotal expected = brute_force(sorted, query);
+        RangeTotal got = sorted_zones.total(query.date_from, query.date_to);
+        ok = got.total == expected.total && got.count == expected.count &&
+             got.zones_skipped + got.zones_summed + got.zones_scanned == 36;
+        max_scanned = std::max(max_scanned, got.zones_scanned);
+    }
+    if (ok && max_scanned <= 2) {
+        PASS()
+    } else {
+        FAIL("Sorted totals differ (max zones scanned " << max_scanned << ")")
+    }
+
+    // Test amount predicates and unsorted tables against a full scan
+    TEST(predicates_and_unsorted)
+    ExpenseTable unsorted = make_table(5000, false, 2);
+    ZoneMap unsorted_zones(unsorted, 300);
+    ok = !unsorted_zones.sorted_by_date();
+    for (int q = 0; q < 300 && ok; ++q) {
+        bool amounts = q % 2 == 0;
+        RangeQuery query = random_query(rng, amounts);
+        RangeTotal expected = brute_force(unsorted, query);
+        RangeTotal got = unsorted_zones.total(query);
+        RangeTotal sorted_got = sorted_zones.total(query);
+        RangeTotal sorted_expected = brute_force(sorted, query);
+        ok = got.total == expected.total && got.count == expected.count &&
+             sorted_got.total == sorted_expected.total && sorted_got.count == sorted_expected.count;
+    }
+    if (ok) {
+        PASS()
+    } else {
+        FAIL("Predicate totals differ")
+    }
+
+    // Test row selection and amount-only pruning
+    TEST(select_rows)
+    RangeQuery window;
+    window.date_from = 19000 + 100;
+    window.date_to = 19000 + 104;
+    std::vector<size_t> rows = sorted_zones.select(window);
+    RangeQuery large;
+    large.amount_min = 4900.0;
+    std::vector<size_t> large_rows = unsorted_zones.select(large);
+    ok = rows.size() == 40 && rows.front() == 800 && rows.back() == 839;
+    for (size_t i : large_rows) ok = ok && unsorted.amounts()[i] >= 4900.0;
+    ok = ok && !large_rows.empty() && large_rows.size() == brute_force(unsorted, large).count;
+    if (ok) {
+        PASS()
+    } else {
+        FAIL("Selected " << rows.size() << " rows")
+    }
+
+    // Test empty tables, empty ranges and invalid zone sizes
+    TEST(edge_cases)
+    ExpenseTable empty;
+    RangeQuery inverted;
+    inverted.date_from = 19010;
+    inverted.date_to = 19000;
+    RangeQuery no_amounts;
+    no_amounts.amount_min = 10;
+    no_amounts.amount_max = 5;
+    ok = ZoneMap(empty).total(0, 100000).count == 0 &&
+         sorted_zones.total(inverted).count == 0 && sorted_zones.total(no_amounts).count == 0 &&
+         sorted_zones.total(RangeQuery()).count == 9000;
+    try {
+        ZoneMap(sorted, 0);
+        ok = false;
+    } catch (const std::invalid_argument&) {
+    }
+    if (ok) {
+        PASS()
+    } else {
+        FAIL("Edge cases incorrect")
+    }
+
+    // Summary
+    std::cout << "\n========================================\n";
+    std::cout << "Tests passed: " << passed << "\n";
+    std::cout << "Tests failed: " << failed << "\n";
+    std::cout << "========================================\n";
+
+    return failed > 0 ? 1 : 0;
+}
@@ -1,5 +1,14 @@
 package com.tracker.jni;
 
+import com.tracker.model.Category;
+
+import java.math.BigDecimal;
+import java.math.RoundingMode;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+import java.util.List;
+
 /**
  * StatsBridge - Java interface to the C++ statistics library.
  * 
@@ -51,6 +60,45 @@ public class StatsBridge {
      */
     public native String calculateStats(double[] amounts);
 
+    /**
+     * Calculate comprehensive statistics straight from off-heap memory.
+     * The native side reads the buffer in place without any copy.
+     * 
+     * @param amounts Direct buffer in native byte order (see allocateDirectAmounts)
+     * @param count   Number of values to read, starting at index 0
+     * @return JSON string with statistics
+     */
+    public native String calculateStatsDirect(DoubleBuffer amounts, int count);
+
+    /**
+     * Allocate a direct, native-order buffer suitable for calculateStatsDirect.
+     */
+    public static DoubleBuffer allocateDirectAmounts(int capacity) {
+        return ByteBuffer.allocateDirect(capacity * Double.BYTES)
+                .order(ByteOrder.nativeOrder())
+                .asDoubleBuffer();
+    }
+
+    /**
+     * Calculate comprehensive statistics over exact amounts in paise.
+     * Sums, min, max and mode are exact, matching DECIMAL(12,2) storage.
+     * 
+     * @param amountsInPaise Expense amounts scaled by 100 (see toPaise)
+     * @return JSON string with statistics
+     */
+    public native String calculateStatsExact(long[] amountsInPaise);
+
+    /**
+     * Convert BigDecimal amounts to paise for calculateStatsExact.
+     */
+    public static long[] toPaise(List<BigDecimal> amounts) {
+        long[] paise = new long[amounts.size()];
+        for (int i = 0; i < paise.length; i++) {
+            paise[i] = amounts.get(i).setScale(2, RoundingMode.HALF_UP).unscaledValue().longValueExact();
+        }
+        return paise;
+    }
+
     /**
      * Calculate simple moving average.
      * 
@@ -69,6 +117,28 @@ public class StatsBridge {
      */
     public native String calculateEMA(double[] amounts, double alpha);
 
+    /**
+     * Calculate a rolling percentile over a count window (50 for the
+     * rolling median). Unlike the moving average, one very large expense
+     * does not shift the whole window.
+     * 
+     * @param amounts    Array of expense amounts
+     * @param window     Window size
+     * @param percentile Percentile (0-100)
+     * @return JSON string with the same shape as calculateMovingAverage
+     */
+    public native String calculateRollingQuantile(double[] amounts, int window, double percentile);
+
+    /**
+     * Rolling mean, stddev, min and max for several window sizes at once
+     * (e.g. {7, 30, 90} for a dashboard), computed in one native pass.
+     * 
+     * @param amounts Array of expense amounts
+     * @param windows Window sizes (each positive)
+     * @return JSON array of {"window_size","stat","values"} series
+     */
+    public native String calculateRolling(double[] amounts, int[] windows);
+
     /**
      * Detect outliers in expense data.
      * 
@@ -87,6 +157,109 @@ public class StatsBridge {
      */
     public native String calculateCorrelation(double[] x, double[] y);
 
+    // ==================== Binary Result Methods ====================
+
+    /**
+     * Calculate statistics into a caller-provided array (no JSON).
+     * 
+     * @param amounts Array of expense amounts
+     * @param out     At least StatsLayout.STATS_FIELD_COUNT long; indexed by StatsLayout
+     * @return false if out is too small or the input is unavailable
+     */
+    public native boolean calculateStatsInto(double[] amounts, double[] out);
+
+    /**
+     * Direct-buffer variant of calculateStatsInto; both buffers are
+     * accessed in place (see allocateDirectAmounts).
+     */
+    public native boolean calculateStatsDirectInto(DoubleBuffer amounts, int count, DoubleBuffer out);
+
+    /**
+     * Write simple moving average values into out.
+     * 
+     * @return values written, or the negated required length if out is too small
+     */
+    public native int calculateMovingAverageInto(double[] amounts, int window, double[] out);
+
+    /**
+     * Write exponential moving average values into out.
+     * 
+     * @return values written, or the negated required length if out is too small
+     */
+    public native int calculateEMAInto(double[] amounts, double alpha, double[] out);
+
+    /**
+     * Write rolling percentile values into out.
+     * 
+     * @return values written, or the negated required length if out is too small
+     */
+    public native int calculateRollingQuantileInto(double[] amounts, int window, double percentile,
+                                                   double[] out);
+
+    /**
+     * Calculate correlation into a caller-provided array (no JSON).
+     * 
+     * @param out At least StatsLayout.CORRELATION_FIELD_COUNT long; indexed by StatsLayout
+     * @return false if lengths differ, out is too small or input is unavailable
+     */
+    public native boolean calculateCorrelationInto(double[] x, double[] y, double[] out);
+
+    // ==================== Category Breakdown ====================
+
+    /**
+     * Per-category sum, count, mean, min, max, percentage of total,
+     * variance and p50/p90 in one native pass.
+     * 
+     * @param amounts    Array of expense amounts
+     * @param categories Category ordinal per amount (see toCategoryCodes)
+     * @return JSON string keyed by Category name (non-empty categories only)
+     */
+    public native String calculateCategoryBreakdown(double[] amounts, byte[] categories);
+
+    /**
+     * Category breakdown into a caller-provided array: one block of
+     * StatsLayout.groupStride(percentiles.length) doubles per Category
+     * ordinal, indexed by StatsLayout.GROUP_*.
+     * 
+     * @param percentiles Per-category quantiles to compute (0-100), may be empty
+     * @param variance    Also compute per-category variance
+     * @return categories written, the negated required length if out is too
+     *         small, or 0 on invalid input
+     */
+    public native int calculateCategoryBreakdownInto(double[] amounts, byte[] categories,
+                                                     double[] percentiles, boolean variance,
+                                                     double[] out);
+
+    // ==================== Batch ====================
+
+    /**
+     * Statistics for many users in one native call. amounts holds every
+     * user's expenses back to back; user u owns
+     * amounts[offsets[u], offsets[u + 1]). Segments are processed in
+     * parallel.
+     * 
+     * out is field-major (see StatsLayout.batchIndex): all sums, then all
+     * means, and so on, each with one entry per user.
+     * 
+     * @param amounts Concatenated expense amounts
+     * @param offsets users + 1 non-decreasing boundaries into amounts
+     * @param out     At least StatsLayout.STATS_FIELD_COUNT * users doubles
+     * @return users written, the negated required length if out is too
+     *         small, or 0 on invalid input
+     */
+    public native int calculateStatsBatchInto(double[] amounts, int[] offsets, double[] out);
+
+    /**
+     * Encode categories as the ordinal codes used by the native kernels.
+     */
+    public static byte[] toCategoryCodes(List<Category> categories) {
+        byte[] codes = new byte[categories.size()];
+        for (int i = 0; i < codes.length; i++) {
+            codes[i] = (byte) categories.get(i).ordinal();
+        }
+        return codes;
+    }
+
     // ==================== Java Fallback Implementations ====================
 
     /**
@@ -0,0 +1,92 @@
+package com.tracker.jni;
+
+/**
+ * StatsLayout - Field indices for the binary results filled by the
+ * StatsBridge *Into native methods.
+ * 
+ * Mirrors StatisticsResult::to_array and CorrelationResult::to_array in
+ * calc-engine/include/statistics.hpp, and GroupByResult::to_array in
+ * calc-engine/include/group_by.hpp; keep both sides in sync.
+ * 
+ * Usage:
+ * double[] out = new double[StatsLayout.STATS_FIELD_COUNT];
+ * bridge.calculateStatsInto(amounts, out);
+ * double median = out[StatsLayout.MEDIAN];
+ */
+public final class StatsLayout {
+
+    // ==================== Statistics ====================
+
+    public static final int SUM = 0;
+    public static final int MEAN = 1;
+    public static final int MEDIAN = 2;
+    public static final int MODE = 3;
+    public static final int VARIANCE = 4;
+    public static final int STDDEV = 5;
+    public static final int MIN = 6;
+    public static final int MAX = 7;
+    public static final int RANGE = 8;
+    public static final int Q1 = 9;
+    public static final int Q3 = 10;
+    public static final int IQR = 11;
+    public static final int COUNT = 12;
+
+    public static final int STATS_FIELD_COUNT = 13;
+
+    // ==================== Correlation ====================
+
+    public static final int PEARSON_COEFFICIENT = 0;
+    public static final int R_SQUARED = 1;
+    public static final int STRENGTH = 2;
+    public static final int DIRECTION = 3;
+
+    public static final int CORRELATION_FIELD_COUNT = 4;
+
+    /**
+     * Names for the STRENGTH code, matching the JSON "strength" values.
+     */
+    public static final String[] STRENGTH_NAMES = {
+            "very_weak", "weak", "moderate", "strong", "very_strong", "invalid"
+    };
+
+    /**
+     * Names for the DIRECTION code, matching the JSON "direction" values.
+     */
+    public static final String[] DIRECTION_NAMES = {
+            "none", "positive", "negative"
+    };
+
+    // ==================== Category Breakdown ====================
+
+    public static final int GROUP_COUNT = 0;
+    public static final int GROUP_SUM = 1;
+    public static final int GROUP_MEAN = 2;
+    public static final int GROUP_MIN = 3;
+    public static final int GROUP_MAX = 4;
+    public static final int GROUP_PERCENTAGE = 5;
+    public static final int GROUP_VARIANCE = 6;
+    /** First requested quantile; the rest follow in request order. */
+    public static final int GROUP_QUANTILES = 7;
+
+    public static final int GROUP_FIELD_COUNT = 7;
+
+    /**
+     * Doubles per category block for the given number of quantiles.
+     */
+    public static int groupStride(int percentileCount) {
+        return GROUP_FIELD_COUNT + percentileCount;
+    }
+
+    // ==================== Batch ====================
+
+    /**
+     * Index of a statistics field (SUM..COUNT) for one segment in the
+     * field-major output of StatsBridge.calculateStatsBatchInto.
+     */
+    public static int batchIndex(int field, int segments, int segment) {
+        return field * segments + segment;
+    }
+
+    private StatsLayout() {
+    }
+}
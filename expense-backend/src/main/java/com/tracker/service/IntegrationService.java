@@ -7,10 +7,22 @@ import org.slf4j.LoggerFactory;
 import org.springframework.beans.factory.annotation.Value;
 import org.springframework.stereotype.Service;
 
+import jakarta.annotation.PostConstruct;
+import jakarta.annotation.PreDestroy;
 import java.io.*;
+import java.net.SocketTimeoutException;
+import java.net.StandardProtocolFamily;
+import java.net.UnixDomainSocketAddress;
+import java.nio.ByteBuffer;
+import java.nio.channels.SelectionKey;
+import java.nio.channels.Selector;
+import java.nio.channels.SocketChannel;
 import java.nio.charset.StandardCharsets;
 import java.util.HashMap;
 import java.util.Map;
+import java.util.concurrent.BlockingQueue;
+import java.util.concurrent.LinkedBlockingQueue;
+import java.util.concurrent.Semaphore;
 import java.util.concurrent.TimeUnit;
 
 /**
@@ -22,6 +34,7 @@ import java.util.concurrent.TimeUnit;
  * - ProcessBuilder for subprocess management
  * - Error handling and timeout management
  * - JSON-based inter-process communication
+ * - Pooled Unix domain socket connections to a persistent C++ daemon
  */
 @Service
 public class IntegrationService {
@@ -37,8 +50,39 @@ public class IntegrationService {
     @Value("${calculation.cpp.executable:../calc-engine/build/calc_engine.exe}")
     private String cppExecutable;
 
+    /**
+     * Socket of a running `calc_engine --serve` daemon. When set, requests
+     * reuse pooled connections instead of spawning a process each time.
+     */
+    @Value("${calculation.cpp.socket:}")
+    private String cppSocketPath;
+
+    /**
+     * Maximum open daemon connections; keep at or below the daemon's
+     * --workers so every in-flight request has a worker to serve it.
+     */
+    @Value("${calculation.cpp.pool-size:4}")
+    private int cppPoolSize;
+
+    /**
+     * Deadline for one daemon request (waiting for a connection, sending
+     * and receiving), matching the process path's wait.
+     */
+    @Value("${calculation.cpp.timeout-ms:10000}")
+    private long cppTimeoutMs;
+
     private final ObjectMapper objectMapper = new ObjectMapper();
 
+    private final BlockingQueue<SocketChannel> cppConnections = new LinkedBlockingQueue<>();
+
+    /** One permit per connection that may be open at a time. */
+    private Semaphore cppPermits;
+
+    @PostConstruct
+    void initCppPool() {
+        cppPermits = new Semaphore(Math.max(1, cppPoolSize));
+    }
+
     /**
      * Calls Python analytics script with expense data.
      * 
@@ -103,6 +147,10 @@ public class IntegrationService {
      * @return Map containing calculation results
      */
     public Map<String, Object> callCppCalculator(double[] amounts) {
+        if (cppSocketPath != null && !cppSocketPath.isBlank()) {
+            return callCppServer(amounts);
+        }
+
         Map<String, Object> result = new HashMap<>();
 
         try {
@@ -161,6 +209,146 @@ public class IntegrationService {
         return result;
     }
 
+    /**
+     * Calls the persistent C++ daemon over a pooled Unix domain socket.
+     * Frames are a 4-byte big-endian length followed by the payload; the
+     * request payload is the same text the CLI reads from stdin.
+     */
+    private Map<String, Object> callCppServer(double[] amounts) {
+        Map<String, Object> result = new HashMap<>();
+        SocketChannel channel = null;
+        boolean permitHeld = false;
+
+        try {
+            StringBuilder input = new StringBuilder();
+            input.append(amounts.length).append('\n');
+            for (double amount : amounts) {
+                input.append(amount).append('\n');
+            }
+
+            long deadline = System.nanoTime() + TimeUnit.MILLISECONDS.toNanos(cppTimeoutMs);
+            if (!cppPermits.tryAcquire(cppTimeoutMs, TimeUnit.MILLISECONDS)) {
+                throw new SocketTimeoutException("No C++ server connection available");
+            }
+            permitHeld = true;
+            channel = borrowCppConnection();
+            String response = exchangeFrame(channel, input.toString(), deadline);
+            releaseCppConnection(channel);
+            channel = null;
+
+            JsonNode jsonResult = objectMapper.readTree(response);
+            if (!jsonResult.path("success").asBoolean(false)) {
+                logger.error("C++ server returned error: {}", jsonResult.path("error").asText());
+                result.put("error", "Calculation failed");
+                return result;
+            }
+
+            result.put("calculations", jsonResult);
+            result.put("success", true);
+
+        } catch (InterruptedException e) {
+            Thread.currentThread().interrupt();
+            result.put("error", "Interrupted waiting for C++ server");
+            result.put("success", false);
+        } catch (Exception e) {
+            // A timed-out connection may still receive the late reply, so never reuse it
+            closeQuietly(channel);
+            logger.error("Error calling C++ server: {}", e.getMessage());
+            result.put("error", e.getMessage());
+            result.put("success", false);
+        } finally {
+            if (permitHeld) {
+                cppPermits.release();
+            }
+        }
+
+        return result;
+    }
+
+    private SocketChannel borrowCppConnection() throws IOException {
+        SocketChannel channel = cppConnections.poll();
+        if (channel != null && channel.isOpen()) {
+            return channel;
+        }
+        channel = SocketChannel.open(StandardProtocolFamily.UNIX);
+        channel.connect(UnixDomainSocketAddress.of(cppSocketPath));
+        channel.configureBlocking(false);
+        return channel;
+    }
+
+    private void releaseCppConnection(SocketChannel channel) {
+        if (cppConnections.size() >= cppPoolSize || !cppConnections.offer(channel)) {
+            closeQuietly(channel);
+        }
+    }
+
+    private String exchangeFrame(SocketChannel channel, String payload, long deadline) throws IOException {
+        byte[] body = payload.getBytes(StandardCharsets.UTF_8);
+        ByteBuffer request = ByteBuffer.allocate(4 + body.length);
+        request.putInt(body.length).put(body).flip();
+
+        try (Selector selector = Selector.open()) {
+            SelectionKey key = channel.register(selector, SelectionKey.OP_WRITE);
+            while (request.hasRemaining()) {
+                if (channel.write(request) == 0) {
+                    awaitReady(selector, deadline);
+                }
+            }
+
+            key.interestOps(SelectionKey.OP_READ);
+            ByteBuffer header = readFully(channel, selector, 4, deadline);
+            int length = header.getInt();
+            if (length < 0) {
+                throw new IOException("Invalid C++ server frame length: " + length);
+            }
+            // Closing the selector deregisters the channel for the next borrower
+            return new String(readFully(channel, selector, length, deadline).array(), StandardCharsets.UTF_8);
+        }
+    }
+
+    private ByteBuffer readFully(SocketChannel channel, Selector selector, int length, long deadline)
+            throws IOException {
+        ByteBuffer buffer = ByteBuffer.allocate(length);
+        while (buffer.hasRemaining()) {
+            int read = channel.read(buffer);
+            if (read < 0) {
+                throw new EOFException("C++ server closed the connection");
+            }
+            if (read == 0) {
+                awaitReady(selector, deadline);
+            }
+        }
+        buffer.flip();
+        return buffer;
+    }
+
+    private void awaitReady(Selector selector, long deadline) throws IOException {
+        long remainingMs = TimeUnit.NANOSECONDS.toMillis(deadline - System.nanoTime());
+        if (remainingMs <= 0 || (selector.select(remainingMs) == 0 && System.nanoTime() - deadline >= 0)) {
+            throw new SocketTimeoutException("C++ server did not respond within " + cppTimeoutMs + " ms");
+        }
+        selector.selectedKeys().clear();
+    }
+
+    private void closeQuietly(SocketChannel channel) {
+        if (channel == null) {
+            return;
+        }
+        try {
+            channel.close();
+        } catch (IOException ignored) {
+            // Connection is being discarded anyway
+        }
+    }
+
+    @PreDestroy
+    public void closeCppConnections() {
+        SocketChannel channel;
+        while ((channel = cppConnections.poll()) != null) {
+            closeQuietly(channel);
+        }
+    }
+
     /**
      * Gets advanced analytics by combining Python insights with C++ calculations.
      */